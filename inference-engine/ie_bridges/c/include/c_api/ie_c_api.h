@@ -218,7 +218,8 @@ typedef enum {
 typedef enum {
     NO_RESIZE = 0,
     RESIZE_BILINEAR,
-    RESIZE_AREA
+    RESIZE_AREA,
+    RESIZE_NEAREST
 }resize_alg_e;
 
 /**
@@ -3,7 +3,8 @@ package org.intel.openvino;
 public enum ResizeAlgorithm {
     NO_RESIZE(0),
     RESIZE_BILINEAR(1),
-    RESIZE_AREA(2);
+    RESIZE_AREA(2),
+    RESIZE_NEAREST(3);
 
     private int value;
 
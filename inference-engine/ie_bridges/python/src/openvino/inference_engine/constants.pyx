@@ -65,6 +65,7 @@ class ResizeAlgorithm(Enum):
     NO_RESIZE = 0
     RESIZE_BILINEAR = 1
     RESIZE_AREA = 2
+    RESIZE_NEAREST = 3
 
 
 class ColorFormat(Enum):
@@ -11,6 +11,8 @@
 
 #pragma once
 
+#include <vector>
+
 #include "ie_plugin_config.hpp"
 
 namespace InferenceEngine {
@@ -35,5 +37,54 @@ namespace HeteroConfigParams {
  */
 DECLARE_HETERO_CONFIG_KEY(DUMP_GRAPH_DOT);
 
+/**
+ * @brief The key to set a number of infer requests executed by subnetworks at the same time.
+ *
+ * If the value is greater than zero, all the infer requests of an executable network share a pool of requests of
+ * each subnetwork and a ring of the given number of intermediate blob sets, so consecutive infer requests stream
+ * through the subnetworks like through an assembly line. A subnetwork has as many requests as its device
+ * network reports in OPTIMAL_NUMBER_OF_INFER_REQUESTS, but not more than the value. The default value "0" means that
+ * each infer request owns one request per subnetwork.
+ */
+DECLARE_HETERO_CONFIG_KEY(PIPELINE_DEPTH);
+
+/**
+ * @brief The key to choose how layers are assigned to devices if affinities are not set by a user
+ */
+DECLARE_HETERO_CONFIG_KEY(PARTITIONING_POLICY);
+
+/**
+ * @brief A layer is assigned to the first device in TARGET_FALLBACK which supports it (default)
+ */
+DECLARE_HETERO_CONFIG_VALUE(PRIORITY);
+
+/**
+ * @brief Layers are assigned to minimize estimated latency of the network. The estimation is a sum of layer
+ * execution times measured on each device, and the costs of tensors transferred between devices. A device which
+ * cannot execute the whole network is measured on the layers it supports. The chosen assignment and its estimated cost are dumped to
+ * hetero_partition_<network name>.txt if HETERO_DUMP_GRAPH_DOT is set.
+ */
+DECLARE_HETERO_CONFIG_VALUE(MIN_LATENCY);
+
 }  // namespace HeteroConfigParams
+
+namespace Metrics {
+
+/**
+ * @brief Metric to get an average number of busy requests for each subnetwork of a HETERO executable network
+ * created with HETERO_PIPELINE_DEPTH. The subnetwork with the largest occupancy is a bottleneck of the pipeline.
+ *
+ * String value is "HETERO_STAGE_OCCUPANCY"
+ */
+DECLARE_METRIC_KEY(HETERO_STAGE_OCCUPANCY, std::vector<float>);
+
+/**
+ * @brief Metric to get an average latency in milliseconds of each subnetwork of a HETERO executable network
+ * created with HETERO_PIPELINE_DEPTH.
+ *
+ * String value is "HETERO_STAGE_AVERAGE_LATENCY"
+ */
+DECLARE_METRIC_KEY(HETERO_STAGE_AVERAGE_LATENCY, std::vector<float>);
+
+}  // namespace Metrics
 }  // namespace InferenceEngine
@@ -349,4 +349,87 @@ public:
 
     Blob::Ptr createROI(const ROI& roi) const override;
 };
+
+/**
+ * @brief This class represents a blob that contains other blobs - one per batch
+ *
+ * Each underlying blob is a single image: a memory blob with batch size 1, an NV12 or I420 blob.
+ * Images may have different sizes, e.g. be regions of interest of the same frame, and are
+ * pre-processed directly into the corresponding batch item of the network input.
+ */
+class INFERENCE_ENGINE_API_CLASS(BatchedBlob) : public CompoundBlob {
+public:
+    /**
+     * @brief A smart pointer to the BatchedBlob object
+     */
+    using Ptr = std::shared_ptr<BatchedBlob>;
+
+    /**
+     * @brief A smart pointer to the const BatchedBlob object
+     */
+    using CPtr = std::shared_ptr<const BatchedBlob>;
+
+    /**
+     * @brief A deleted default constructor
+     */
+    BatchedBlob() = delete;
+
+    /**
+     * @brief Constructs a batched blob from a vector of blobs
+     *
+     * All blobs must be of the same type, precision and layout.
+     *
+     * @param blobs A vector of blobs that is copied to this object
+     */
+    explicit BatchedBlob(const std::vector<Blob::Ptr>& blobs);
+
+    /**
+     * @brief Constructs a batched blob from a vector of blobs
+     *
+     * All blobs must be of the same type, precision and layout.
+     *
+     * @param blobs A vector of blobs that is moved to this object
+     */
+    explicit BatchedBlob(std::vector<Blob::Ptr>&& blobs);
+
+    /**
+     * @brief A virtual destructor. It is made out of line for RTTI to
+     * work correctly on some platforms.
+     */
+    virtual ~BatchedBlob();
+
+    /**
+     * @brief A copy constructor
+     */
+    BatchedBlob(const BatchedBlob& blob) = default;
+
+    /**
+     * @brief A copy assignment operator
+     */
+    BatchedBlob& operator=(const BatchedBlob& blob) = default;
+
+    /**
+     * @brief A move constructor
+     */
+    BatchedBlob(BatchedBlob&& blob) = default;
+
+    /**
+     * @brief A move assignment operator
+     */
+    BatchedBlob& operator=(BatchedBlob&& blob) = default;
+
+    Blob::Ptr createROI(const ROI& roi) const override;
+};
+
+/**
+ * @brief Creates a batch of ROI blobs which share the memory of the given blob
+ *
+ * No data is copied: the result can be passed as the pre-processing input to fill every batch
+ * item of the network input from the corresponding region of the same frame.
+ *
+ * @param inputBlob Original blob (a memory, an NV12 or an I420 blob)
+ * @param rois Regions of interest, one per batch item
+ * @return A BatchedBlob of ROI blobs
+ */
+INFERENCE_ENGINE_API_CPP(Blob::Ptr) make_shared_blob(const Blob::Ptr& inputBlob, const std::vector<ROI>& rois);
 }  // namespace InferenceEngine
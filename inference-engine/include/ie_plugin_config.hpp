@@ -10,6 +10,7 @@
  */
 #pragma once
 
+#include <cstdint>
 #include <string>
 #include <tuple>
 #include <vector>
@@ -151,6 +152,98 @@ DECLARE_EXEC_NETWORK_METRIC_KEY(NETWORK_NAME, std::string);
  */
 DECLARE_METRIC_KEY(DEVICE_THERMAL, float);
 
+/**
+ * @brief Metric which defines support of import/export functionality by plugin.
+ *
+ * String value is "IMPORT_EXPORT_SUPPORT"
+ */
+DECLARE_METRIC_KEY(IMPORT_EXPORT_SUPPORT, bool);
+
+/**
+ * @brief Metric to get a number of LoadNetwork calls served by importing a network from CONFIG_KEY(CACHE_DIR).
+ *
+ * String value is "NETWORK_CACHE_HITS". The metric is provided by Core for every device
+ */
+DECLARE_METRIC_KEY(NETWORK_CACHE_HITS, unsigned int);
+
+/**
+ * @brief Metric to get a number of LoadNetwork calls which compiled a network and stored it to CONFIG_KEY(CACHE_DIR).
+ *
+ * String value is "NETWORK_CACHE_MISSES". The metric is provided by Core for every device
+ */
+DECLARE_METRIC_KEY(NETWORK_CACHE_MISSES, unsigned int);
+
+/**
+ * @brief Metric to get a total time in milliseconds spent in LoadNetwork calls which hit CONFIG_KEY(CACHE_DIR).
+ *
+ * String value is "NETWORK_CACHE_HIT_LOAD_TIME". The metric is provided by Core for every device
+ */
+DECLARE_METRIC_KEY(NETWORK_CACHE_HIT_LOAD_TIME, float);
+
+/**
+ * @brief Metric to get a total time in milliseconds spent in LoadNetwork calls which missed CONFIG_KEY(CACHE_DIR),
+ * including export of the compiled network.
+ *
+ * String value is "NETWORK_CACHE_MISS_LOAD_TIME". The metric is provided by Core for every device
+ */
+DECLARE_METRIC_KEY(NETWORK_CACHE_MISS_LOAD_TIME, float);
+
+/**
+ * @brief Metric to get a number of bytes of unique weights stored by the device for all loaded networks.
+ *
+ * String value is "SHARED_WEIGHTS_STORED_BYTES"
+ */
+DECLARE_METRIC_KEY(SHARED_WEIGHTS_STORED_BYTES, uint64_t);
+
+/**
+ * @brief Metric to get a number of bytes which would be additionally allocated for weights of the loaded networks
+ * if identical weights were not shared between them.
+ *
+ * String value is "SHARED_WEIGHTS_SAVED_BYTES"
+ */
+DECLARE_METRIC_KEY(SHARED_WEIGHTS_SAVED_BYTES, uint64_t);
+
+/**
+ * @brief Metric to get a histogram of batch sizes the infer requests of an executable network were coalesced to.
+ *
+ * String value is "REQUESTS_BATCH_SIZE_HISTOGRAM". An element with index `i` is a number of inferences run
+ * for `i` coalesced requests. The metric is provided when the requests batching is enabled
+ */
+DECLARE_METRIC_KEY(REQUESTS_BATCH_SIZE_HISTOGRAM, std::vector<unsigned int>);
+
+/**
+ * @brief Metric to get an average time in milliseconds infer requests of an executable network wait to be
+ * coalesced into a batch.
+ *
+ * String value is "REQUESTS_QUEUEING_DELAY". The metric is provided when the requests batching is enabled
+ */
+DECLARE_METRIC_KEY(REQUESTS_QUEUEING_DELAY, float);
+
+/**
+ * @brief Metric to get a number of bytes infer requests of an executable network copied between user blobs and
+ * the device memory.
+ *
+ * String value is "INFER_REQUESTS_COPIED_BYTES". Blobs of layout, precision and alignment the device accepts
+ * are used by inference directly and are not copied. Bytes copied by an inference are added when it completes
+ */
+DECLARE_METRIC_KEY(INFER_REQUESTS_COPIED_BYTES, uint64_t);
+
+/**
+ * @brief Metric to get a size in bytes of the memory an executable network allocates per stream for intermediate
+ * tensors.
+ *
+ * String value is "MEMORY_ARENA_SIZE"
+ */
+DECLARE_METRIC_KEY(MEMORY_ARENA_SIZE, uint64_t);
+
+/**
+ * @brief Metric to get a size in bytes the memory for intermediate tensors of an executable network cannot be less
+ * than. It is a maximal total size of tensors which are alive at the same time.
+ *
+ * String value is "MEMORY_ARENA_LOWER_BOUND". Compare it with MEMORY_ARENA_SIZE to estimate the memory reuse
+ */
+DECLARE_METRIC_KEY(MEMORY_ARENA_LOWER_BOUND, uint64_t);
+
 /**
  * @brief Metric to get an unsigned integer value of optimal number of executable network infer requests.
  */
@@ -217,6 +310,67 @@ DECLARE_CONFIG_VALUE(CPU_THROUGHPUT_NUMA);
 DECLARE_CONFIG_VALUE(CPU_THROUGHPUT_AUTO);
 DECLARE_CONFIG_KEY(CPU_THROUGHPUT_STREAMS);
 
+/**
+ * @brief The name for setting inter-op parallelism of the CPU plugin.
+ *
+ * It is passed to Core::SetConfig(), this option should be used with values:
+ * PluginConfigParams::YES (independent branches of the network are executed concurrently when the cost model
+ * predicts that the nodes of a branch are too small to load all the CPU threads alone)
+ * PluginConfigParams::NO (default, nodes are executed one by one in the topological order)
+ * The option is intended for the latency-oriented inference with a single stream. It takes effect only
+ * if the OpenVINO compiled with TBB threading.
+ */
+DECLARE_CONFIG_KEY(CPU_INTER_OP_PARALLELISM);
+
+/**
+ * @brief The name for setting a number of graphs compiled for non-default input shapes which the CPU plugin keeps
+ * per stream.
+ *
+ * It is passed to Core::SetConfig(), this option should be used with values:
+ * "0" (default) - input blobs must have the shapes the network is loaded with
+ * positive integer value - input blobs of the same rank but different dimensions are accepted by an infer request.
+ * The network is reshaped and compiled for such shapes on the first use, the least recently used graphs are
+ * released when the limit is exceeded. All graphs share the same copy of weights.
+ * Output blobs which do not match the output shapes are reallocated on infer.
+ * The option is supported only for networks represented by ngraph::Function and cannot be combined with
+ * the dynamic batch.
+ */
+DECLARE_CONFIG_KEY(CPU_DYNAMIC_SHAPES_CACHE_SIZE);
+
+/**
+ * @brief The name for setting sharing of weights between networks loaded to the CPU plugin.
+ *
+ * It is passed to Core::SetConfig(), this option should be used with values:
+ * PluginConfigParams::YES (identical weights of all networks loaded with this option are stored once,
+ * regardless of names of the layers they belong to, the memory is released when the last network which uses
+ * the weights is released)
+ * PluginConfigParams::NO (default, weights are shared only between streams of one network)
+ * The option increases time of the network loading as all weights are hashed.
+ */
+DECLARE_CONFIG_KEY(CPU_WEIGHTS_SHARING);
+
+/**
+ * @brief The name for setting a maximal number of concurrently started infer requests the CPU plugin coalesces
+ * into one batched inference.
+ *
+ * It is passed to Core::LoadNetwork(), this option should be used with values:
+ * "0" or "1" (default) - every infer request is executed separately
+ * integer value greater than 1 - the network is compiled for the given batch, infer requests started with
+ * StartAsync() are queued and executed together once the batch is full or the batching timeout expires.
+ * The option is supported only for networks of batch 1 which can be executed with the dynamic batch and
+ * cannot be combined with the dynamic batch or dynamic input shapes.
+ */
+DECLARE_CONFIG_KEY(CPU_REQUESTS_BATCH_SIZE);
+
+/**
+ * @brief The name for setting a maximal time in microseconds an infer request waits for other ones to be
+ * coalesced with.
+ *
+ * It is passed to Core::LoadNetwork(), this option should be used with non negative integer values,
+ * default is "1000". The option is used only if CPU_REQUESTS_BATCH_SIZE is greater than 1
+ */
+DECLARE_CONFIG_KEY(CPU_REQUESTS_BATCH_TIMEOUT);
+
 /**
  * @brief Optimize GPU plugin execution to maximize throughput.
  *
@@ -360,5 +514,17 @@ DECLARE_CONFIG_KEY(DUMP_EXEC_GRAPH_AS_DOT);
  */
 DECLARE_CONFIG_KEY(ENFORCE_BF16);
 
+/**
+ * @brief This key defines a directory which is used to store compiled networks.
+ *
+ * The key is handled by Core only and can be passed to Core::SetConfig (for all devices or
+ * a particular one) or to Core::LoadNetwork. When it is set, LoadNetwork computes a hash of the network,
+ * the device, the plugin version and the configuration, and imports the network from the directory
+ * if it was compiled before. Otherwise the network is compiled and exported to the directory.
+ * Only devices which report METRIC_KEY(IMPORT_EXPORT_SUPPORT) use the cache.
+ * An empty value (default) disables caching.
+ */
+DECLARE_CONFIG_KEY(CACHE_DIR);
+
 }  // namespace PluginConfigParams
 }  // namespace InferenceEngine
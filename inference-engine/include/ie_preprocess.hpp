@@ -47,7 +47,7 @@ enum MeanVariant {
  * @enum ResizeAlgorithm
  * @brief Represents the list of supported resize algorithms.
  */
-enum ResizeAlgorithm { NO_RESIZE = 0, RESIZE_BILINEAR, RESIZE_AREA };
+enum ResizeAlgorithm { NO_RESIZE = 0, RESIZE_BILINEAR, RESIZE_AREA, RESIZE_NEAREST };
 
 /**
  * @brief This class stores pre-process information for the input
@@ -60,6 +60,10 @@ class PreProcessInfo {
     // Resize Algorithm to be applied for input before inference if needed.
     ResizeAlgorithm _resizeAlg = NO_RESIZE;
 
+    // Aspect ratio preserving resize with the padding of the rest of the input
+    bool _letterbox = false;
+    float _padValue = 0.f;
+
     // Color format to be used in on-demand color conversions applied to input before inference
     ColorFormat _colorFormat = ColorFormat::RAW;
 
@@ -198,6 +202,39 @@ public:
         return _resizeAlg;
     }
 
+    /**
+     * @brief Enables or disables the aspect ratio preserving (letterbox) resize
+     *
+     * The input image is scaled with the resize algorithm to fit the network's input and centered,
+     * the rest of the network's input is filled with the pad value. Mean values are applied to
+     * the pad value the same way as to the image.
+     *
+     * @param letterbox true to preserve the aspect ratio of the input image
+     * @param padValue Value of the padded pixels in all channels
+     */
+    void setLetterbox(bool letterbox, float padValue = 0.f) {
+        _letterbox = letterbox;
+        _padValue = padValue;
+    }
+
+    /**
+     * @brief Checks if the aspect ratio preserving (letterbox) resize is enabled
+     *
+     * @return true if the letterbox resize is enabled
+     */
+    bool getLetterbox() const {
+        return _letterbox;
+    }
+
+    /**
+     * @brief Gets the value of the pixels padded by the letterbox resize
+     *
+     * @return Pad value
+     */
+    float getPadValue() const {
+        return _padValue;
+    }
+
     /**
      * @brief Changes the color format of the input data provided by the user
      *
@@ -11,10 +11,41 @@
 
 #pragma once
 
+#include <map>
+#include <string>
+#include <vector>
+
 #include "ie_plugin_config.hpp"
 
 namespace InferenceEngine {
 
+namespace Metrics {
+
+/**
+ * @brief Metric to get an exponentially weighted moving average of infer requests latency in milliseconds
+ * for each device of a MULTI executable network.
+ *
+ * String value is "MULTI_DEVICE_AVERAGE_LATENCY"
+ */
+DECLARE_METRIC_KEY(MULTI_DEVICE_AVERAGE_LATENCY, std::map<std::string, float>);
+
+/**
+ * @brief Metric to get percentiles of infer requests latency in milliseconds for each device of a MULTI executable
+ * network.
+ *
+ * String value is "MULTI_DEVICE_LATENCY_PERCENTILES". A vector of {p50, p90, p99, max} is provided for each device
+ */
+DECLARE_METRIC_KEY(MULTI_DEVICE_LATENCY_PERCENTILES, std::map<std::string, std::vector<float>>);
+
+/**
+ * @brief Metric to get a number of infer requests completed by each device of a MULTI executable network.
+ *
+ * String value is "MULTI_DEVICE_INFERENCES"
+ */
+DECLARE_METRIC_KEY(MULTI_DEVICE_INFERENCES, std::map<std::string, unsigned int>);
+
+}  // namespace Metrics
+
 /**
  * @brief Multi Device plugin configuration
  */
@@ -34,5 +65,23 @@ namespace MultiDeviceConfigParams {
  */
 DECLARE_MULTI_CONFIG_KEY(DEVICE_PRIORITIES);
 
+/**
+ * @brief The policy of choosing a device for an infer request
+ */
+DECLARE_MULTI_CONFIG_KEY(SCHEDULING_POLICY);
+
+/**
+ * @brief A request is scheduled to the first device in the priority list which has an idle infer request (default)
+ */
+DECLARE_MULTI_CONFIG_VALUE(PRIORITY);
+
+/**
+ * @brief A request is scheduled to the device which is expected to complete it first. The expectation is based
+ * on the average latency observed for a device and the number of requests it is already busy with.
+ * A device without observed latency gets a single request at a time. If the best device is busy, the request is
+ * scheduled to the next best idle one.
+ */
+DECLARE_MULTI_CONFIG_VALUE(MIN_COMPLETION_TIME);
+
 }  // namespace MultiDeviceConfigParams
 }  // namespace InferenceEngine
@@ -100,6 +100,31 @@ static const char dump_config_message[] = "Optional. Path to XML/YAML/JSON file
 static const char shape_message[] = "Optional. Set shape for input. For example, \"input1[1,3,224,224],input2[1,4]\" or \"[1,3,224,224]\""
                                     " in case of one input size.";
 
+// @brief message for arrival rate option
+static const char arrival_rate_message[] = "Optional. Enable the open-loop mode: requests are issued with the given average rate (requests per second) "
+                                           "regardless of the completion of previous requests, so the reported latency includes the time "
+                                           "requests wait for an idle infer request. Comma-separated list of rates runs the measurement "
+                                           "for each of them. Only the async API is supported.";
+
+// @brief message for arrival distribution option
+static const char arrival_distribution_message[] = "Optional. Distribution of the request arrivals in the open-loop mode: "
+                                                   "\"poisson\" (default) or \"constant\".";
+
+// @brief message for sweep option
+static const char sweep_message[] = "Optional. Number of open-loop measurements run after the closed-loop one with the arrival rates "
+                                    "evenly distributed up to the measured throughput, to get the latency-versus-throughput curve.";
+
+// @brief message for scenario option
+static const char scenario_message[] = "Optional. Path to a scenario file describing several models which run concurrently on the same "
+                                       "Inference Engine core instead of -m. Each line describes a model with space-separated "
+                                       "key=value options: m=<path> (required), name=<name>, d=<device>, nireq=<integer>, "
+                                       "nstreams=<integer>, b=<integer>, rate=<float> (open-loop arrival rate, closed-loop load if not set) "
+                                       "and priority=<integer>. Each model is measured alone and then together with others.";
+
+// @brief message for json report option
+static const char json_report_message[] = "Optional. Path to a file where the JSON report with the configuration and latency "
+                                          "distributions of all measurements is stored.";
+
 // @brief message for quantization bits
 static const char gna_qb_message[] = "Optional. Weight bits for quantization:  8 or 16 (default)";
 
@@ -187,6 +212,21 @@ DEFINE_string(dump_config, "", dump_config_message);
 /// @brief Define flag for input shape <br>
 DEFINE_string(shape, "", shape_message);
 
+/// @brief Define flag for the open-loop arrival rates
+DEFINE_string(rate, "", arrival_rate_message);
+
+/// @brief Define flag for the open-loop arrival distribution
+DEFINE_string(arrival, "poisson", arrival_distribution_message);
+
+/// @brief Define flag for the number of latency-versus-throughput measurements
+DEFINE_uint32(sweep, 0, sweep_message);
+
+/// @brief Path to a multi-model scenario file
+DEFINE_string(scenario, "", scenario_message);
+
+/// @brief Path to a file where the JSON report is stored
+DEFINE_string(json_report, "", json_report_message);
+
 /// @brief Define flag for quantization bits (default 16)
 DEFINE_int32(qb, 16, gna_qb_message);
 
@@ -213,6 +253,11 @@ static void showUsage() {
     std::cout << "    -t                        " << execution_time_message << std::endl;
     std::cout << "    -progress                 " << progress_message << std::endl;
     std::cout << "    -shape                    " << shape_message << std::endl;
+    std::cout << std::endl << "  Load options:" << std::endl;
+    std::cout << "    -rate \"<float>\"           " << arrival_rate_message << std::endl;
+    std::cout << "    -arrival \"<type>\"          " << arrival_distribution_message << std::endl;
+    std::cout << "    -sweep \"<integer>\"        " << sweep_message << std::endl;
+    std::cout << "    -scenario \"<path>\"        " << scenario_message << std::endl;
     std::cout << std::endl << "  device-specific performance options:" << std::endl;
     std::cout << "    -nstreams \"<integer>\"     " << infer_num_streams_message << std::endl;
     std::cout << "    -nthreads \"<integer>\"     " << infer_num_threads_message << std::endl;
@@ -223,6 +268,7 @@ static void showUsage() {
     std::cout << "    -report_folder            " << report_folder_message << std::endl;
     std::cout << "    -exec_graph_path          " << exec_graph_path_message << std::endl;
     std::cout << "    -pc                       " << pc_message << std::endl;
+    std::cout << "    -json_report \"<path>\"      " << json_report_message << std::endl;
 #ifdef USE_OPENCV
     std::cout << "    -dump_config              " << dump_config_message << std::endl;
     std::cout << "    -load_config              " << load_config_message << std::endl;
@@ -21,9 +21,11 @@
 typedef std::chrono::high_resolution_clock Time;
 typedef std::chrono::nanoseconds ns;
 
-typedef std::function<void(size_t id, const double latency)> QueueCallbackFunction;
+typedef std::function<void(size_t id, const double latency, const double queueingTime)> QueueCallbackFunction;
 
 /// @brief Wrapper class for InferenceEngine::InferRequest. Handles asynchronous callbacks and calculates execution time.
+/// The execution (service) time is measured from the request start, the queueing time is the delay between
+/// the arrival of the request and its start.
 class InferReqWrap final {
 public:
     using Ptr = std::shared_ptr<InferReqWrap>;
@@ -37,11 +39,16 @@ public:
         _request.SetCompletionCallback(
                 [&]() {
                     _endTime = Time::now();
-                    _callbackQueue(_id, getExecutionTimeInMilliseconds());
+                    _callbackQueue(_id, getExecutionTimeInMilliseconds(), getQueueingTimeInMilliseconds());
                 });
     }
 
     void startAsync() {
+        startAsync(Time::now());
+    }
+
+    void startAsync(const Time::time_point& arrivalTime) {
+        _arrivalTime = arrivalTime;
         _startTime = Time::now();
         _request.StartAsync();
     }
@@ -52,9 +59,10 @@ public:
 
     void infer() {
         _startTime = Time::now();
+        _arrivalTime = _startTime;
         _request.Infer();
         _endTime = Time::now();
-        _callbackQueue(_id, getExecutionTimeInMilliseconds());
+        _callbackQueue(_id, getExecutionTimeInMilliseconds(), getQueueingTimeInMilliseconds());
     }
 
     std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> getPerformanceCounts() {
@@ -70,8 +78,14 @@ public:
         return static_cast<double>(execTime.count()) * 0.000001;
     }
 
+    double getQueueingTimeInMilliseconds() const {
+        auto queueingTime = std::chrono::duration_cast<ns>(_startTime - _arrivalTime);
+        return static_cast<double>(queueingTime.count()) * 0.000001;
+    }
+
 private:
     InferenceEngine::InferRequest _request;
+    Time::time_point _arrivalTime;
     Time::time_point _startTime;
     Time::time_point _endTime;
     size_t _id;
@@ -84,7 +98,8 @@ public:
         for (size_t id = 0; id < nireq; id++) {
             requests.push_back(std::make_shared<InferReqWrap>(net, id, std::bind(&InferRequestsQueue::putIdleRequest, this,
                                                                                  std::placeholders::_1,
-                                                                                 std::placeholders::_2)));
+                                                                                 std::placeholders::_2,
+                                                                                 std::placeholders::_3)));
             _idleIds.push(id);
         }
         resetTimes();
@@ -102,6 +117,7 @@ public:
         _startTime = Time::time_point::max();
         _endTime = Time::time_point::min();
         _latencies.clear();
+        _queueingTimes.clear();
     }
 
     double getDurationInMilliseconds() {
@@ -109,9 +125,11 @@ public:
     }
 
     void putIdleRequest(size_t id,
-                        const double latency) {
+                        const double latency,
+                        const double queueingTime) {
         std::unique_lock<std::mutex> lock(_mutex);
         _latencies.push_back(latency);
+        _queueingTimes.push_back(queueingTime);
         _idleIds.push(id);
         _endTime = std::max(Time::now(), _endTime);
         _cv.notify_one();
@@ -126,6 +144,19 @@ public:
         return request;
     }
 
+    /// @brief Waits for an idle request until the deadline
+    /// @return the idle request or nullptr if there is no idle request at the deadline
+    InferReqWrap::Ptr getIdleRequest(const Time::time_point& deadline) {
+        std::unique_lock<std::mutex> lock(_mutex);
+        if (!_cv.wait_until(lock, deadline, [this]{ return _idleIds.size() > 0; })) {
+            return nullptr;
+        }
+        auto request = requests.at(_idleIds.front());
+        _idleIds.pop();
+        _startTime = std::min(Time::now(), _startTime);
+        return request;
+    }
+
     void waitAll() {
         std::unique_lock<std::mutex> lock(_mutex);
         _cv.wait(lock, [this]{ return _idleIds.size() == requests.size(); });
@@ -135,6 +166,17 @@ public:
         return _latencies;
     }
 
+    std::vector<double> getQueueingTimes() {
+        return _queueingTimes;
+    }
+
+    /// @brief Returns the time from the arrival to the completion of each request
+    std::vector<double> getResponseTimes() {
+        std::vector<double> responseTimes(_latencies.size());
+        std::transform(_latencies.begin(), _latencies.end(), _queueingTimes.begin(), responseTimes.begin(), std::plus<double>());
+        return responseTimes;
+    }
+
     std::vector<InferReqWrap::Ptr> requests;
 
 private:
@@ -144,4 +186,5 @@ private:
     Time::time_point _startTime;
     Time::time_point _endTime;
     std::vector<double> _latencies;
+    std::vector<double> _queueingTimes;
 };
@@ -0,0 +1,147 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <queue>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "load_generator.hpp"
+
+ArrivalProcess::ArrivalProcess(double rate, const std::string& distribution, unsigned int seed) :
+    _rate(rate),
+    _isPoisson(distribution == poissonArrival),
+    _generator(seed),
+    _interval(rate > 0.0 ? rate : 1.0) {
+    if (rate <= 0.0) {
+        throw std::logic_error("Arrival rate should be positive, got " + std::to_string(rate));
+    }
+    if (distribution != constantArrival && distribution != poissonArrival) {
+        throw std::logic_error("Unknown arrival distribution '" + distribution + "'. Only " + std::string(constantArrival) +
+                               "/" + std::string(poissonArrival) + " distributions are supported");
+    }
+    reset(Time::now());
+}
+
+void ArrivalProcess::reset(const Time::time_point& startTime) {
+    _startTime = startTime;
+    _elapsedSeconds = 0.0;
+}
+
+Time::time_point ArrivalProcess::next() {
+    // arrival times are accumulated from the start to avoid drifting of the average rate because of rounding
+    auto arrivalTime = _startTime + std::chrono::duration_cast<Time::duration>(std::chrono::duration<double>(_elapsedSeconds));
+    _elapsedSeconds += _isPoisson ? _interval(_generator) : 1.0 / _rate;
+    return arrivalTime;
+}
+
+size_t runClosedLoop(InferRequestsQueue& inferRequestsQueue, bool isSync,
+                     uint64_t niter, uint64_t duration_nanoseconds, const ProgressCallbackFunction& progress) {
+    auto startTime = Time::now();
+    auto execTime = std::chrono::duration_cast<ns>(Time::now() - startTime).count();
+    size_t iteration = 0;
+
+    while ((niter != 0LL && iteration < niter) ||
+           (duration_nanoseconds != 0LL && (uint64_t)execTime < duration_nanoseconds) ||
+           (!isSync && iteration % inferRequestsQueue.requests.size() != 0)) {
+        auto inferRequest = inferRequestsQueue.getIdleRequest();
+        if (!inferRequest) {
+            THROW_IE_EXCEPTION << "No idle Infer Requests!";
+        }
+
+        if (isSync) {
+            inferRequest->infer();
+        } else {
+            // As the inference request is currently idle, the wait() adds no additional overhead (and should return immediately).
+            // The primary reason for calling the method is exception checking/re-throwing.
+            // Callback, that governs the actual execution can handle errors as well,
+            // but as it uses just error codes it has no details like ‘what()’ method of `std::exception`
+            // So, rechecking for any exceptions here.
+            inferRequest->wait();
+            inferRequest->startAsync();
+        }
+        iteration++;
+
+        execTime = std::chrono::duration_cast<ns>(Time::now() - startTime).count();
+        progress(iteration, execTime);
+    }
+
+    // wait the latest inference executions
+    inferRequestsQueue.waitAll();
+    return iteration;
+}
+
+size_t runOpenLoop(InferRequestsQueue& inferRequestsQueue, ArrivalProcess& arrivals,
+                   uint64_t niter, uint64_t duration_nanoseconds, const ProgressCallbackFunction& progress) {
+    auto startTime = Time::now();
+    arrivals.reset(startTime);
+    auto nextArrival = arrivals.next();
+    std::queue<Time::time_point> pending;
+    size_t issued = 0;
+
+    auto isIssuing = [&] {
+        auto elapsed = static_cast<uint64_t>(std::chrono::duration_cast<ns>(nextArrival - startTime).count());
+        return (niter != 0LL && issued < niter) || (duration_nanoseconds != 0LL && elapsed < duration_nanoseconds);
+    };
+
+    while (isIssuing() || !pending.empty()) {
+        while (isIssuing() && nextArrival <= Time::now()) {
+            pending.push(nextArrival);
+            nextArrival = arrivals.next();
+            issued++;
+            progress(issued, std::chrono::duration_cast<ns>(Time::now() - startTime).count());
+        }
+        if (pending.empty()) {
+            if (isIssuing()) {
+                std::this_thread::sleep_until(nextArrival);
+            }
+            continue;
+        }
+        // while there are requests waiting for an idle infer request, new arrivals are still queued in time
+        auto inferRequest = isIssuing() ? inferRequestsQueue.getIdleRequest(nextArrival) : inferRequestsQueue.getIdleRequest();
+        if (inferRequest) {
+            // rethrows exceptions of the previous execution, see the closed-loop measurement
+            inferRequest->wait();
+            inferRequest->startAsync(pending.front());
+            pending.pop();
+        }
+    }
+
+    inferRequestsQueue.waitAll();
+    return issued;
+}
+
+LoadPointResults getLoadPointResults(InferRequestsQueue& inferRequestsQueue, double arrivalRate, size_t iterations, size_t batchSize) {
+    LoadPointResults results;
+    results.arrivalRate = arrivalRate;
+    results.iterations = iterations;
+    results.duration = inferRequestsQueue.getDurationInMilliseconds();
+    results.latency = LatencyMetrics(inferRequestsQueue.getResponseTimes());
+    results.queueing = LatencyMetrics(inferRequestsQueue.getQueueingTimes());
+    results.service = LatencyMetrics(inferRequestsQueue.getLatencies());
+    results.throughput = batchSize * 1000.0 * iterations / results.duration;
+    return results;
+}
+
+std::vector<double> parseArrivalRates(const std::string& rates_string) {
+    std::vector<double> rates;
+    std::stringstream ss(rates_string);
+    std::string rate;
+    while (std::getline(ss, rate, ',')) {
+        try {
+            size_t pos = 0;
+            rates.push_back(std::stod(rate, &pos));
+            if (pos != rate.size()) {
+                throw std::invalid_argument(rate);
+            }
+        } catch (const std::exception&) {
+            throw std::logic_error("Can't parse arrival rate '" + rate + "' in '" + rates_string + "'");
+        }
+        if (rates.back() <= 0.0) {
+            throw std::logic_error("Arrival rate should be positive, got '" + rate + "'");
+        }
+    }
+    return rates;
+}
@@ -0,0 +1,68 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <functional>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "infer_request_wrap.hpp"
+#include "statistics_report.hpp"
+
+// @brief arrival distributions of the open-loop load
+static constexpr char constantArrival[] = "constant";
+static constexpr char poissonArrival[] = "poisson";
+
+/// @brief Generates the arrival times of requests with the given average rate.
+/// Inter-arrival times are either equal or exponentially distributed (Poisson process).
+class ArrivalProcess {
+public:
+    /// @param rate average number of arrivals per second
+    /// @param distribution "constant" or "poisson"
+    ArrivalProcess(double rate, const std::string& distribution, unsigned int seed = 0);
+
+    /// @brief Returns the time of the next arrival
+    Time::time_point next();
+
+    void reset(const Time::time_point& startTime);
+
+private:
+    double _rate;
+    bool _isPoisson;
+    std::mt19937 _generator;
+    std::exponential_distribution<double> _interval;
+    Time::time_point _startTime;
+    double _elapsedSeconds = 0.0;
+};
+
+typedef std::function<void(size_t issued, uint64_t execTime)> ProgressCallbackFunction;
+
+/**
+* @brief Starts requests again as soon as they complete (closed-loop load).
+* In the async mode the number of iterations is aligned to the number of infer requests,
+* so the last requests are executed in the same conditions.
+* @param niter number of iterations, 0 means the limit is not set
+* @param duration_nanoseconds time to run, 0 means the limit is not set
+* @return number of executed iterations
+*/
+size_t runClosedLoop(InferRequestsQueue& inferRequestsQueue, bool isSync,
+                     uint64_t niter, uint64_t duration_nanoseconds, const ProgressCallbackFunction& progress);
+
+/**
+* @brief Issues requests at the arrival times regardless of the completion of previous requests (open-loop load).
+* Requests which arrive while all infer requests are busy are queued, so the queueing time is measured separately
+* from the execution time. All infer requests are started from the calling thread.
+* @param niter number of requests to issue, 0 means the limit is not set
+* @param duration_nanoseconds time to issue requests, 0 means the limit is not set
+* @return number of issued requests
+*/
+size_t runOpenLoop(InferRequestsQueue& inferRequestsQueue, ArrivalProcess& arrivals,
+                   uint64_t niter, uint64_t duration_nanoseconds, const ProgressCallbackFunction& progress);
+
+/// @brief Collects the results of the asynchronous measurement from the queue
+LoadPointResults getLoadPointResults(InferRequestsQueue& inferRequestsQueue, double arrivalRate, size_t iterations, size_t batchSize);
+
+std::vector<double> parseArrivalRates(const std::string& rates_string);
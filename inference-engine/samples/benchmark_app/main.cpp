@@ -4,6 +4,7 @@
 
 #include <algorithm>
 #include <chrono>
+#include <iomanip>
 #include <memory>
 #include <map>
 #include <string>
@@ -20,7 +21,9 @@
 
 #include "benchmark_app.hpp"
 #include "infer_request_wrap.hpp"
+#include "load_generator.hpp"
 #include "progress_bar.hpp"
+#include "scenario.hpp"
 #include "statistics_report.hpp"
 #include "inputs_filling.hpp"
 #include "utils.hpp"
@@ -47,10 +50,20 @@ bool ParseAndCheckCommandLine(int argc, char *argv[]) {
         return false;
     }
 
-    if (FLAGS_m.empty()) {
+    if (FLAGS_m.empty() && FLAGS_scenario.empty()) {
         throw std::logic_error("Model is required but not set. Please set -m option.");
     }
 
+    if (!FLAGS_scenario.empty()) {
+        if (!FLAGS_m.empty()) {
+            throw std::logic_error("-m and -scenario options can't be used together");
+        }
+        if (FLAGS_api != "async" || !FLAGS_rate.empty() || FLAGS_sweep != 0) {
+            throw std::logic_error("Scenario (-scenario option) is supported for the async API only, "
+                                   "arrival rates should be set for each model in the scenario file");
+        }
+    }
+
     if (FLAGS_api != "async" && FLAGS_api != "sync") {
         throw std::logic_error("Incorrect API. Please set -api option to `sync` or `async` value.");
     }
@@ -66,6 +79,27 @@ bool ParseAndCheckCommandLine(int argc, char *argv[]) {
         throw std::logic_error("only " + std::string(detailedCntReport) + " report type is supported for MULTI device");
     }
 
+    if (!FLAGS_rate.empty()) {
+        if (FLAGS_api != "async") {
+            throw std::logic_error("Open-loop mode (-rate option) is supported for the async API only");
+        }
+        if (FLAGS_sweep != 0) {
+            throw std::logic_error("-rate and -sweep options can't be used together");
+        }
+        if (parseArrivalRates(FLAGS_rate).empty()) {
+            throw std::logic_error("No arrival rates are set in -rate option");
+        }
+    }
+
+    if (FLAGS_sweep != 0 && FLAGS_api != "async") {
+        throw std::logic_error("Latency-versus-throughput sweep (-sweep option) is supported for the async API only");
+    }
+
+    if (FLAGS_arrival != constantArrival && FLAGS_arrival != poissonArrival) {
+        throw std::logic_error("only " + std::string(constantArrival) + "/" + std::string(poissonArrival) +
+                               " arrival distributions are supported (invalid -arrival option value)");
+    }
+
     return true;
 }
 
@@ -93,13 +127,27 @@ static void next_step(const std::string additional_info = "") {
               << (additional_info.empty() ? "" : " (" + additional_info + ")") << std::endl;
 }
 
-template <typename T>
-T getMedianValue(const std::vector<T> &vec) {
-    std::vector<T> sortedVec(vec);
-    std::sort(sortedVec.begin(), sortedVec.end());
-    return (sortedVec.size() % 2 != 0) ?
-           sortedVec[sortedVec.size() / 2ULL] :
-           (sortedVec[sortedVec.size() / 2ULL] + sortedVec[sortedVec.size() / 2ULL - 1ULL]) / static_cast<T>(2.0);
+static void printLatencyPercentiles(const LatencyMetrics& latency) {
+    std::cout << std::fixed << std::setprecision(2)
+              << "    p90:    " << latency.p90 << " ms" << std::endl
+              << "    p99:    " << latency.p99 << " ms" << std::endl
+              << "    p99.9:  " << latency.p999 << " ms" << std::endl
+              << "    max:    " << latency.max << " ms" << std::endl;
+}
+
+static void printLoadPoints(const std::vector<LoadPointResults>& loadPoints) {
+    std::cout << "Open-loop latency (ms) versus throughput (" << FLAGS_arrival << " arrivals):" << std::endl;
+    std::cout << std::setw(12) << "rate (req/s)" << std::setw(12) << "FPS" << std::setw(10) << "median" << std::setw(10) << "p90"
+              << std::setw(10) << "p99" << std::setw(10) << "p99.9" << std::setw(10) << "max"
+              << std::setw(14) << "queueing p99" << std::setw(13) << "service p99" << std::endl;
+    for (auto& point : loadPoints) {
+        std::cout << std::fixed << std::setprecision(2)
+                  << std::setw(12) << point.arrivalRate << std::setw(12) << point.throughput
+                  << std::setw(10) << point.latency.median << std::setw(10) << point.latency.p90
+                  << std::setw(10) << point.latency.p99 << std::setw(10) << point.latency.p999
+                  << std::setw(10) << point.latency.max
+                  << std::setw(14) << point.queueing.p99 << std::setw(13) << point.service.p99 << std::endl;
+    }
 }
 
 /**
@@ -130,8 +178,8 @@ int main(int argc, char *argv[]) {
                 command_line_arguments.push_back({ flag.name, flag.current_value });
             }
         }
-        if (!FLAGS_report_type.empty()) {
-            statistics = std::make_shared<StatisticsReport>(StatisticsReport::Config{FLAGS_report_type, FLAGS_report_folder});
+        if (!FLAGS_report_type.empty() || !FLAGS_json_report.empty()) {
+            statistics = std::make_shared<StatisticsReport>(StatisticsReport::Config{FLAGS_report_type, FLAGS_report_folder, FLAGS_json_report});
             statistics->addParameters(StatisticsReport::Category::COMMAND_LINE_PARAMETERS, command_line_arguments);
         }
         auto isFlagSetInCommandLine = [&command_line_arguments] (const std::string& name) {
@@ -144,6 +192,20 @@ int main(int argc, char *argv[]) {
         // Parse devices
         auto devices = parseDevices(device_name);
 
+        // Parse scenario, devices of all models are configured
+        std::vector<ModelScenario> scenario;
+        if (!FLAGS_scenario.empty()) {
+            scenario = parseScenario(FLAGS_scenario, device_name);
+            devices.clear();
+            for (auto&& model : scenario) {
+                for (auto&& device : parseDevices(model.device)) {
+                    if (std::find(devices.begin(), devices.end(), device) == devices.end()) {
+                        devices.push_back(device);
+                    }
+                }
+            }
+        }
+
         // Parse nstreams per device
         std::map<std::string, std::string> device_nstreams = parseNStreamsValuePerDevice(devices, FLAGS_nstreams);
 
@@ -290,6 +352,23 @@ int main(int argc, char *argv[]) {
             ie.SetConfig(item.second, item.first);
         }
 
+        if (!scenario.empty()) {
+            uint32_t duration_seconds = FLAGS_t;
+            for (auto&& model : scenario) {
+                if (FLAGS_t == 0) {
+                    duration_seconds = std::max(duration_seconds, deviceDefaultDeviceDurationInSeconds(model.device));
+                }
+            }
+            runScenario(ie, scenario, duration_seconds, FLAGS_arrival, statistics,
+                        [] (const std::string& additional_info) { next_step(additional_info); });
+
+            // ----------------- 11. Dumping statistics report ---------------------------------------------------------
+            next_step();
+            if (statistics)
+                statistics->dump();
+            return 0;
+        }
+
         auto double_to_string = [] (const double number) {
             std::stringstream ss;
             ss << std::fixed << std::setprecision(2) << number;
@@ -528,36 +607,11 @@ int main(int argc, char *argv[]) {
                                         });
         inferRequestsQueue.resetTimes();
 
-        auto startTime = Time::now();
-        auto execTime = std::chrono::duration_cast<ns>(Time::now() - startTime).count();
-
         /** Start inference & calculate performance **/
         /** to align number if iterations to guarantee that last infer requests are executed in the same conditions **/
         ProgressBar progressBar(progressBarTotalCount, FLAGS_stream_output, FLAGS_progress);
 
-        while ((niter != 0LL && iteration < niter) ||
-               (duration_nanoseconds != 0LL && (uint64_t)execTime < duration_nanoseconds) ||
-               (FLAGS_api == "async" && iteration % nireq != 0)) {
-            inferRequest = inferRequestsQueue.getIdleRequest();
-            if (!inferRequest) {
-                THROW_IE_EXCEPTION << "No idle Infer Requests!";
-            }
-
-            if (FLAGS_api == "sync") {
-                inferRequest->infer();
-            } else {
-                // As the inference request is currently idle, the wait() adds no additional overhead (and should return immediately).
-                // The primary reason for calling the method is exception checking/re-throwing.
-                // Callback, that governs the actual execution can handle errors as well,
-                // but as it uses just error codes it has no details like ‘what()’ method of `std::exception`
-                // So, rechecking for any exceptions here.
-                inferRequest->wait();
-                inferRequest->startAsync();
-            }
-            iteration++;
-
-            execTime = std::chrono::duration_cast<ns>(Time::now() - startTime).count();
-
+        auto updateProgress = [&] (uint64_t execTime) {
             if (niter > 0) {
                 progressBar.addProgress(1);
             } else {
@@ -569,35 +623,87 @@ int main(int argc, char *argv[]) {
                 progressBar.addProgress(newProgress);
                 progressCnt += newProgress;
             }
-        }
+        };
 
-        // wait the latest inference executions
-        inferRequestsQueue.waitAll();
+        std::vector<double> arrivalRates = parseArrivalRates(FLAGS_rate);
+        LoadPointResults closedLoop;
+        if (arrivalRates.empty()) {
+            iteration = runClosedLoop(inferRequestsQueue, FLAGS_api == "sync", niter, duration_nanoseconds,
+                                      [&] (size_t, uint64_t execTime) { updateProgress(execTime); });
 
-        double latency = getMedianValue<double>(inferRequestsQueue.getLatencies());
-        double totalDuration = inferRequestsQueue.getDurationInMilliseconds();
-        double fps = (FLAGS_api == "sync") ? batchSize * 1000.0 / latency :
-                     batchSize * 1000.0 * iteration / totalDuration;
+            closedLoop = getLoadPointResults(inferRequestsQueue, 0.0, iteration, batchSize);
+            if (FLAGS_api == "sync") {
+                closedLoop.throughput = batchSize * 1000.0 / closedLoop.service.median;
+            }
 
-        if (statistics) {
-            statistics->addParameters(StatisticsReport::Category::EXECUTION_RESULTS,
-                                      {
-                                              {"total execution time (ms)", double_to_string(totalDuration)},
-                                              {"total number of iterations", std::to_string(iteration)},
-                                      });
-            if (device_name.find("MULTI") == std::string::npos) {
+            if (statistics) {
+                statistics->addParameters(StatisticsReport::Category::EXECUTION_RESULTS,
+                                          {
+                                                  {"total execution time (ms)", double_to_string(closedLoop.duration)},
+                                                  {"total number of iterations", std::to_string(iteration)},
+                                          });
+                if (device_name.find("MULTI") == std::string::npos) {
+                    statistics->addParameters(StatisticsReport::Category::EXECUTION_RESULTS,
+                                              {
+                                                      {"latency (ms)", double_to_string(closedLoop.service.median)},
+                                                      {"latency p90 (ms)", double_to_string(closedLoop.service.p90)},
+                                                      {"latency p99 (ms)", double_to_string(closedLoop.service.p99)},
+                                                      {"latency p99.9 (ms)", double_to_string(closedLoop.service.p999)},
+                                                      {"latency max (ms)", double_to_string(closedLoop.service.max)},
+                                              });
+                }
                 statistics->addParameters(StatisticsReport::Category::EXECUTION_RESULTS,
                                           {
-                                                  {"latency (ms)", double_to_string(latency)},
+                                                  {"throughput", double_to_string(closedLoop.throughput)}
                                           });
+                statistics->addLoadPoint(closedLoop);
+            }
+
+            progressBar.finish();
+
+            // rates of the latency-versus-throughput sweep are evenly distributed up to the measured one
+            double requestsRate = iteration * 1000.0 / closedLoop.duration;
+            for (uint32_t point = 1; point <= FLAGS_sweep; point++) {
+                arrivalRates.push_back(requestsRate * point / FLAGS_sweep);
             }
-            statistics->addParameters(StatisticsReport::Category::EXECUTION_RESULTS,
-                                      {
-                                              {"throughput", double_to_string(fps)}
-                                      });
         }
 
-        progressBar.finish();
+        std::vector<LoadPointResults> openLoop;
+        for (auto arrivalRate : arrivalRates) {
+            slog::info << "Open-loop measurement with " << double_to_string(arrivalRate) << " requests/s "
+                       << FLAGS_arrival << " arrival rate" << slog::endl;
+            inferRequestsQueue.resetTimes();
+            progressBar.newBar(progressBarTotalCount);
+            progressCnt = 0;
+
+            ArrivalProcess arrivals(arrivalRate, FLAGS_arrival);
+            auto issued = runOpenLoop(inferRequestsQueue, arrivals, niter, duration_nanoseconds,
+                                      [&] (size_t, uint64_t execTime) { updateProgress(execTime); });
+            progressBar.finish();
+
+            openLoop.push_back(getLoadPointResults(inferRequestsQueue, arrivalRate, issued, batchSize));
+            auto& results = openLoop.back();
+            if (results.iterations * 1000.0 / results.duration < 0.95 * arrivalRate) {
+                slog::warn << "The device can't sustain " << double_to_string(arrivalRate) << " requests/s: "
+                           << "the queueing time depends on the measurement duration" << slog::endl;
+            }
+            if (statistics) {
+                auto prefix = "rate " + double_to_string(arrivalRate) + " req/s: ";
+                statistics->addParameters(StatisticsReport::Category::EXECUTION_RESULTS,
+                                          {
+                                                  {prefix + "total number of iterations", std::to_string(results.iterations)},
+                                                  {prefix + "latency (ms)", double_to_string(results.latency.median)},
+                                                  {prefix + "latency p90 (ms)", double_to_string(results.latency.p90)},
+                                                  {prefix + "latency p99 (ms)", double_to_string(results.latency.p99)},
+                                                  {prefix + "latency p99.9 (ms)", double_to_string(results.latency.p999)},
+                                                  {prefix + "latency max (ms)", double_to_string(results.latency.max)},
+                                                  {prefix + "queueing time p99 (ms)", double_to_string(results.queueing.p99)},
+                                                  {prefix + "service time p99 (ms)", double_to_string(results.service.p99)},
+                                                  {prefix + "throughput", double_to_string(results.throughput)},
+                                          });
+                statistics->addLoadPoint(results);
+            }
+        }
 
         // ----------------- 11. Dumping statistics report -------------------------------------------------------------
         next_step();
@@ -637,11 +743,18 @@ int main(int argc, char *argv[]) {
         if (statistics)
             statistics->dump();
 
-        std::cout << "Count:      " << iteration << " iterations" << std::endl;
-        std::cout << "Duration:   " << double_to_string(totalDuration) << " ms" << std::endl;
-        if (device_name.find("MULTI") == std::string::npos)
-            std::cout << "Latency:    " << double_to_string(latency) << " ms" << std::endl;
-        std::cout << "Throughput: " << double_to_string(fps) << " FPS" << std::endl;
+        if (FLAGS_rate.empty()) {
+            std::cout << "Count:      " << iteration << " iterations" << std::endl;
+            std::cout << "Duration:   " << double_to_string(closedLoop.duration) << " ms" << std::endl;
+            if (device_name.find("MULTI") == std::string::npos) {
+                std::cout << "Latency:    " << double_to_string(closedLoop.service.median) << " ms" << std::endl;
+                printLatencyPercentiles(closedLoop.service);
+            }
+            std::cout << "Throughput: " << double_to_string(closedLoop.throughput) << " FPS" << std::endl;
+        }
+        if (!openLoop.empty()) {
+            printLoadPoints(openLoop);
+        }
     } catch (const std::exception& ex) {
         slog::err << ex.what() << slog::endl;
 
@@ -0,0 +1,329 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <exception>
+#include <fstream>
+#include <future>
+#include <initializer_list>
+#include <iomanip>
+#include <map>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <samples/common.hpp>
+#include <samples/slog.hpp>
+
+#include "infer_request_wrap.hpp"
+#include "inputs_filling.hpp"
+#include "load_generator.hpp"
+#include "scenario.hpp"
+#include "utils.hpp"
+
+using namespace InferenceEngine;
+
+namespace {
+
+struct ModelRunner {
+    ModelScenario scenario;
+    bool isCompiled = false;
+    ExecutableNetwork exeNetwork;
+    size_t batchSize = 1;
+    // infer requests should be released before the executable network
+    std::unique_ptr<InferRequestsQueue> inferRequestsQueue;
+};
+
+template <typename T>
+T parseValue(const std::string& key, const std::string& value, const std::string& location) {
+    std::stringstream ss(value);
+    T result;
+    if (!(ss >> result) || !ss.eof()) {
+        throw std::logic_error(location + ": can't parse value '" + value + "' of '" + key + "' option");
+    }
+    return result;
+}
+
+std::string toString(double number) {
+    std::stringstream ss;
+    ss << std::fixed << std::setprecision(2) << number;
+    return ss.str();
+}
+
+LoadPointResults measure(ModelRunner& runner, uint64_t duration_nanoseconds, const std::string& arrivalDistribution,
+                         const std::string& run) {
+    auto& inferRequestsQueue = *runner.inferRequestsQueue;
+    auto& scenario = runner.scenario;
+    auto noProgress = [] (size_t, uint64_t) {};
+    inferRequestsQueue.resetTimes();
+    size_t iterations = 0;
+    if (scenario.rate > 0.0) {
+        ArrivalProcess arrivals(scenario.rate, arrivalDistribution);
+        iterations = runOpenLoop(inferRequestsQueue, arrivals, 0, duration_nanoseconds, noProgress);
+    } else {
+        iterations = runClosedLoop(inferRequestsQueue, false, 0, duration_nanoseconds, noProgress);
+    }
+    auto results = getLoadPointResults(inferRequestsQueue, scenario.rate, iterations, runner.batchSize);
+    results.model = scenario.name;
+    results.run = run;
+    return results;
+}
+
+}  // namespace
+
+std::vector<ModelScenario> parseScenario(const std::string& filename, const std::string& defaultDevice) {
+    std::ifstream file(filename);
+    if (!file.is_open()) {
+        throw std::logic_error("Can't open scenario file " + filename);
+    }
+    std::vector<ModelScenario> scenario;
+    std::string line;
+    for (size_t lineNumber = 1; std::getline(file, line); lineNumber++) {
+        line = line.substr(0, line.find('#'));
+        std::stringstream options(line);
+        std::string option;
+        auto location = filename + ":" + std::to_string(lineNumber);
+        ModelScenario model;
+        model.device = defaultDevice;
+        bool isEmpty = true;
+        while (options >> option) {
+            isEmpty = false;
+            auto pos = option.find('=');
+            if (pos == std::string::npos) {
+                throw std::logic_error(location + ": option '" + option + "' should be in key=value format");
+            }
+            auto key = option.substr(0, pos);
+            auto value = option.substr(pos + 1);
+            if (key == "m") {
+                model.model = value;
+            } else if (key == "name") {
+                model.name = value;
+            } else if (key == "d") {
+                model.device = value;
+            } else if (key == "nireq") {
+                model.nireq = parseValue<uint32_t>(key, value, location);
+            } else if (key == "nstreams") {
+                model.nstreams = value;
+            } else if (key == "b") {
+                model.batch = parseValue<uint32_t>(key, value, location);
+            } else if (key == "rate") {
+                model.rate = parseValue<double>(key, value, location);
+                if (model.rate < 0.0) {
+                    throw std::logic_error(location + ": arrival rate should not be negative");
+                }
+            } else if (key == "priority") {
+                model.priority = parseValue<int>(key, value, location);
+            } else {
+                throw std::logic_error(location + ": unknown option '" + key + "'");
+            }
+        }
+        if (isEmpty) {
+            continue;
+        }
+        if (model.model.empty()) {
+            throw std::logic_error(location + ": model path is required, please set m option");
+        }
+        if (model.name.empty()) {
+            model.name = fileNameNoExt(model.model.substr(model.model.find_last_of("/\\") + 1));
+        }
+        for (auto&& other : scenario) {
+            if (other.name == model.name) {
+                throw std::logic_error(location + ": model name '" + model.name + "' is not unique, please set name option");
+            }
+        }
+        scenario.push_back(model);
+    }
+    if (scenario.empty()) {
+        throw std::logic_error("No models are described in scenario file " + filename);
+    }
+    std::stable_sort(scenario.begin(), scenario.end(), [] (const ModelScenario& lhs, const ModelScenario& rhs) {
+        return lhs.priority > rhs.priority;
+    });
+    return scenario;
+}
+
+void runScenario(Core& ie, const std::vector<ModelScenario>& scenario,
+                 uint32_t duration_seconds, const std::string& arrivalDistribution,
+                 const std::shared_ptr<StatisticsReport>& statistics, const std::function<void(const std::string&)>& nextStep) {
+    std::vector<ModelRunner> runners(scenario.size());
+    std::vector<CNNNetwork> networks(scenario.size());
+    for (size_t i = 0; i < scenario.size(); i++) {
+        runners[i].scenario = scenario[i];
+    }
+
+    // ----------------- 4. Reading network files ------------------------------------------------------------------
+    nextStep("");
+    for (size_t i = 0; i < runners.size(); i++) {
+        runners[i].isCompiled = fileExt(runners[i].scenario.model) == "blob";
+        if (!runners[i].isCompiled) {
+            slog::info << "Loading network files of " << runners[i].scenario.name << slog::endl;
+            networks[i] = ie.ReadNetwork(runners[i].scenario.model);
+            if (networks[i].getInputsInfo().empty()) {
+                throw std::logic_error("no inputs info is provided for " + runners[i].scenario.name);
+            }
+        }
+    }
+
+    // ----------------- 5. Resizing networks to match the given batch ----------------------------------------------
+    nextStep("");
+    for (size_t i = 0; i < runners.size(); i++) {
+        auto& batch = runners[i].scenario.batch;
+        if (!runners[i].isCompiled && batch != 0 && networks[i].getBatchSize() != batch) {
+            auto shapes = networks[i].getInputShapes();
+            if (adjustShapesBatch(shapes, batch, networks[i].getInputsInfo())) {
+                slog::info << "Reshaping network " << runners[i].scenario.name << ": " << getShapesString(shapes) << slog::endl;
+                networks[i].reshape(shapes);
+            }
+        }
+        runners[i].batchSize = runners[i].isCompiled ? std::max<size_t>(batch, 1) : networks[i].getBatchSize();
+    }
+
+    // ----------------- 6. Configuring inputs ----------------------------------------------------------------------
+    nextStep("");
+    for (size_t i = 0; i < runners.size(); i++) {
+        if (!runners[i].isCompiled) {
+            for (auto& item : networks[i].getInputsInfo()) {
+                if (isImage(item.second)) {
+                    item.second->setPrecision(Precision::U8);
+                }
+            }
+        }
+    }
+
+    // ----------------- 7. Loading the models to the devices -------------------------------------------------------
+    nextStep("");
+    for (size_t i = 0; i < runners.size(); i++) {
+        auto& model = runners[i].scenario;
+        std::map<std::string, std::string> config;
+        if (!model.nstreams.empty()) {
+            if (model.device.find(':') != std::string::npos) {
+                throw std::logic_error("nstreams option of " + model.name + " is supported for a single device only, "
+                                       "please set the number of streams for " + model.device + " via -nstreams option");
+            }
+            config[model.device + "_THROUGHPUT_STREAMS"] = model.nstreams;
+        }
+        auto startTime = Time::now();
+        runners[i].exeNetwork = runners[i].isCompiled ? ie.ImportNetwork(model.model, model.device, config) :
+                                                        ie.LoadNetwork(networks[i], model.device, config);
+        auto duration_ms = std::chrono::duration_cast<ns>(Time::now() - startTime).count() * 0.000001;
+        slog::info << "Load network " << model.name << " to " << model.device << " took " << toString(duration_ms) << " ms" << slog::endl;
+    }
+    networks.clear();
+
+    // ----------------- 8. Setting optimal runtime parameters ------------------------------------------------------
+    nextStep("");
+    for (auto&& runner : runners) {
+        auto& model = runner.scenario;
+        if (model.nireq == 0) {
+            try {
+                model.nireq = runner.exeNetwork.GetMetric(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS)).as<unsigned int>();
+            } catch (const details::InferenceEngineException& ex) {
+                THROW_IE_EXCEPTION
+                        << "Every device used with the benchmark_app should "
+                        << "support OPTIMAL_NUMBER_OF_INFER_REQUESTS ExecutableNetwork metric. "
+                        << "Failed to query the metric for the " << model.device << " with error:" << ex.what();
+            }
+        }
+        if (statistics) {
+            statistics->addParameters(StatisticsReport::Category::RUNTIME_CONFIG,
+                                      {
+                                              {model.name + ": topology", model.model},
+                                              {model.name + ": target device", model.device},
+                                              {model.name + ": batch size", std::to_string(runner.batchSize)},
+                                              {model.name + ": number of parallel infer requests", std::to_string(model.nireq)},
+                                              {model.name + ": arrival rate", toString(model.rate)},
+                                              {model.name + ": priority", std::to_string(model.priority)},
+                                      });
+        }
+    }
+
+    // ----------------- 9. Creating infer requests and filling input blobs -----------------------------------------
+    nextStep("");
+    for (auto&& runner : runners) {
+        runner.inferRequestsQueue.reset(new InferRequestsQueue(runner.exeNetwork, runner.scenario.nireq));
+        fillBlobs({}, runner.batchSize, runner.exeNetwork.GetInputsInfo(), runner.inferRequestsQueue->requests);
+    }
+
+    // ----------------- 10. Measuring performance ------------------------------------------------------------------
+    uint64_t duration_nanoseconds = duration_seconds * 1000000000LL;
+    std::stringstream ss;
+    ss << runners.size() << " models, each model alone and then all models concurrently, "
+       << duration_seconds * 1000LL << " ms duration of each run";
+    nextStep(ss.str());
+
+    // warming up - out of scope
+    for (auto&& runner : runners) {
+        runner.inferRequestsQueue->getIdleRequest()->startAsync();
+        runner.inferRequestsQueue->waitAll();
+    }
+
+    std::vector<LoadPointResults> solo;
+    for (auto&& runner : runners) {
+        slog::info << "Running " << runner.scenario.name << " alone" << slog::endl;
+        solo.push_back(measure(runner, duration_nanoseconds, arrivalDistribution, "solo"));
+    }
+
+    slog::info << "Running all models concurrently" << slog::endl;
+    std::vector<LoadPointResults> concurrent(runners.size());
+    std::vector<std::exception_ptr> errors(runners.size());
+    std::promise<void> start;
+    std::shared_future<void> started = start.get_future().share();
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < runners.size(); i++) {
+        threads.emplace_back([&, i] {
+            try {
+                started.wait();
+                concurrent[i] = measure(runners[i], duration_nanoseconds, arrivalDistribution, "concurrent");
+            } catch (...) {
+                errors[i] = std::current_exception();
+            }
+        });
+    }
+    start.set_value();
+    for (auto&& thread : threads) {
+        thread.join();
+    }
+    for (auto&& error : errors) {
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
+
+    std::cout << "Scenario results (latency in ms, interference is relative to the model running alone):" << std::endl;
+    std::cout << std::left << std::setw(24) << "model" << std::right << std::setw(12) << "run" << std::setw(12) << "FPS"
+              << std::setw(10) << "median" << std::setw(10) << "p90" << std::setw(10) << "p99" << std::setw(10) << "p99.9"
+              << std::setw(10) << "max" << std::setw(14) << "FPS change" << std::setw(14) << "p99 change" << std::endl;
+    for (size_t i = 0; i < runners.size(); i++) {
+        double throughputChange = (concurrent[i].throughput / solo[i].throughput - 1.0) * 100.0;
+        double latencyChange = (concurrent[i].latency.p99 / solo[i].latency.p99 - 1.0) * 100.0;
+        for (auto results : {&solo[i], &concurrent[i]}) {
+            std::cout << std::fixed << std::setprecision(2)
+                      << std::left << std::setw(24) << results->model << std::right << std::setw(12) << results->run
+                      << std::setw(12) << results->throughput << std::setw(10) << results->latency.median
+                      << std::setw(10) << results->latency.p90 << std::setw(10) << results->latency.p99
+                      << std::setw(10) << results->latency.p999 << std::setw(10) << results->latency.max;
+            if (results == &concurrent[i]) {
+                std::cout << std::showpos << std::setw(13) << throughputChange << "%"
+                          << std::setw(13) << latencyChange << "%" << std::noshowpos;
+            }
+            std::cout << std::endl;
+        }
+        if (statistics) {
+            auto& name = runners[i].scenario.name;
+            statistics->addParameters(StatisticsReport::Category::EXECUTION_RESULTS,
+                                      {
+                                              {name + ": solo throughput", toString(solo[i].throughput)},
+                                              {name + ": solo latency p99 (ms)", toString(solo[i].latency.p99)},
+                                              {name + ": concurrent throughput", toString(concurrent[i].throughput)},
+                                              {name + ": concurrent latency p99 (ms)", toString(concurrent[i].latency.p99)},
+                                              {name + ": throughput change (%)", toString(throughputChange)},
+                                              {name + ": latency p99 change (%)", toString(latencyChange)},
+                                      });
+            statistics->addLoadPoint(solo[i]);
+            statistics->addLoadPoint(concurrent[i]);
+        }
+    }
+}
@@ -0,0 +1,46 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <inference_engine.hpp>
+
+#include "statistics_report.hpp"
+
+/// @brief Description of a model which runs concurrently with other models of the scenario
+struct ModelScenario {
+    std::string name;
+    std::string model;
+    std::string device;
+    uint32_t nireq = 0;
+    std::string nstreams;
+    uint32_t batch = 0;
+    // average arrival rate of the open-loop load in requests per second, 0 for the closed-loop load
+    double rate = 0.0;
+    int priority = 0;
+};
+
+/**
+* @brief Parses the scenario file. Each line, except empty ones and comments started with '#', describes a model
+* with space-separated key=value options named after the command line options:
+* m (required), name, d, nireq, nstreams, b, rate and priority.
+* @return models sorted by the priority in the descending order
+*/
+std::vector<ModelScenario> parseScenario(const std::string& filename, const std::string& defaultDevice);
+
+/**
+* @brief Runs each model of the scenario alone and then all models concurrently on the same Core,
+* so the models share the devices and the CPU streams executors as in a consolidated deployment.
+* Prints per-model throughput and latency of both runs and the interference of the concurrent run,
+* the results are added to the statistics report if it is created.
+* @param nextStep callback printing the next step of the application
+*/
+void runScenario(InferenceEngine::Core& ie, const std::vector<ModelScenario>& scenario,
+                 uint32_t duration_seconds, const std::string& arrivalDistribution,
+                 const std::shared_ptr<StatisticsReport>& statistics, const std::function<void(const std::string&)>& nextStep);
@@ -7,9 +7,36 @@
 #include <utility>
 #include <map>
 #include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <iomanip>
+#include <numeric>
+#include <sstream>
 
 #include "statistics_report.hpp"
 
+LatencyMetrics::LatencyMetrics(const std::vector<double>& latencies) {
+    if (latencies.empty()) {
+        return;
+    }
+    std::vector<double> sorted(latencies);
+    std::sort(sorted.begin(), sorted.end());
+    // nearest-rank percentile, the rank is rounded down within the floating point error
+    auto percentile = [&sorted] (double p) {
+        auto rank = static_cast<size_t>(std::ceil(p / 100.0 * sorted.size() - 1e-9));
+        return sorted[std::max<size_t>(rank, 1) - 1];
+    };
+    median = (sorted.size() % 2 != 0) ?
+             sorted[sorted.size() / 2ULL] :
+             (sorted[sorted.size() / 2ULL] + sorted[sorted.size() / 2ULL - 1ULL]) / 2.0;
+    avg = std::accumulate(sorted.begin(), sorted.end(), 0.0) / sorted.size();
+    min = sorted.front();
+    p90 = percentile(90.0);
+    p99 = percentile(99.0);
+    p999 = percentile(99.9);
+    max = sorted.back();
+}
+
 void StatisticsReport::addParameters(const Category &category, const Parameters& parameters) {
     if (_parameters.count(category) == 0)
         _parameters[category] = parameters;
@@ -17,7 +44,18 @@ void StatisticsReport::addParameters(const Category &category, const Parameters&
         _parameters[category].insert(_parameters[category].end(), parameters.begin(), parameters.end());
 }
 
+void StatisticsReport::addLoadPoint(const LoadPointResults& results) {
+    _loadPoints.push_back(results);
+}
+
 void StatisticsReport::dump() {
+    if (!_config.json_report.empty()) {
+        dumpJson();
+    }
+    if (_config.report_type.empty()) {
+        return;
+    }
+
     CsvDumper dumper(true, _config.report_folder + _separator + "benchmark_report.csv");
 
     auto dump_parameters = [ &dumper ] (const Parameters &parameters) {
@@ -132,3 +170,91 @@ void StatisticsReport::dumpPerformanceCounters(const std::vector<PerformaceCount
     }
     slog::info << "Pefromance counters report is stored to " << dumper.getFilename() << slog::endl;
 }
+
+namespace {
+
+std::string jsonString(const std::string& value) {
+    std::stringstream ss;
+    ss << '"';
+    for (auto c : value) {
+        switch (c) {
+            case '"':  ss << "\\\""; break;
+            case '\\': ss << "\\\\"; break;
+            case '\n': ss << "\\n"; break;
+            case '\t': ss << "\\t"; break;
+            default:
+                if (static_cast<unsigned char>(c) < 0x20) {
+                    ss << "\\u" << std::hex << std::setw(4) << std::setfill('0') << static_cast<int>(c);
+                } else {
+                    ss << c;
+                }
+        }
+    }
+    ss << '"';
+    return ss.str();
+}
+
+void dumpJsonLatency(std::ostream& stream, const std::string& name, const LatencyMetrics& metrics) {
+    stream << "            " << jsonString(name) << ": {"
+           << "\"median\": " << metrics.median << ", "
+           << "\"avg\": " << metrics.avg << ", "
+           << "\"min\": " << metrics.min << ", "
+           << "\"p90\": " << metrics.p90 << ", "
+           << "\"p99\": " << metrics.p99 << ", "
+           << "\"p99.9\": " << metrics.p999 << ", "
+           << "\"max\": " << metrics.max << "}";
+}
+
+}  // namespace
+
+void StatisticsReport::dumpJson() {
+    std::ofstream stream(_config.json_report);
+    if (!stream.is_open()) {
+        throw std::logic_error("Can't open " + _config.json_report + " to dump the JSON report");
+    }
+    stream << std::fixed << std::setprecision(3);
+
+    static const std::vector<std::pair<Category, std::string>> categories = {
+        { Category::COMMAND_LINE_PARAMETERS, "command_line_parameters" },
+        { Category::RUNTIME_CONFIG, "configuration_setup" },
+        { Category::EXECUTION_RESULTS, "execution_results" },
+    };
+    stream << "{" << std::endl;
+    for (auto& category : categories) {
+        stream << "    " << jsonString(category.second) << ": {";
+        if (_parameters.count(category.first)) {
+            auto& parameters = _parameters.at(category.first);
+            for (size_t i = 0; i < parameters.size(); i++) {
+                stream << (i == 0 ? "" : ",") << std::endl << "        "
+                       << jsonString(parameters[i].first) << ": " << jsonString(parameters[i].second);
+            }
+            stream << std::endl << "    ";
+        }
+        stream << "}," << std::endl;
+    }
+
+    // latencies are in milliseconds, throughput is in frames per second
+    stream << "    \"load_points\": [";
+    for (size_t i = 0; i < _loadPoints.size(); i++) {
+        auto& point = _loadPoints[i];
+        stream << (i == 0 ? "" : ",") << std::endl << "        {" << std::endl;
+        if (!point.model.empty()) {
+            stream << "            \"model\": " << jsonString(point.model) << "," << std::endl
+                   << "            \"run\": " << jsonString(point.run) << "," << std::endl;
+        }
+        stream << "            \"mode\": " << jsonString(point.arrivalRate > 0.0 ? "open-loop" : "closed-loop") << "," << std::endl
+               << "            \"arrival_rate\": " << point.arrivalRate << "," << std::endl
+               << "            \"iterations\": " << point.iterations << "," << std::endl
+               << "            \"duration\": " << point.duration << "," << std::endl
+               << "            \"throughput\": " << point.throughput << "," << std::endl;
+        dumpJsonLatency(stream, "latency", point.latency);
+        stream << "," << std::endl;
+        dumpJsonLatency(stream, "queueing_time", point.queueing);
+        stream << "," << std::endl;
+        dumpJsonLatency(stream, "service_time", point.service);
+        stream << std::endl << "        }";
+    }
+    stream << std::endl << "    ]" << std::endl << "}" << std::endl;
+
+    slog::info << "JSON report is stored to " << _config.json_report << slog::endl;
+}
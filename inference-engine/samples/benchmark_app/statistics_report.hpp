@@ -19,6 +19,36 @@ static constexpr char noCntReport[] = "no_counters";
 static constexpr char averageCntReport[] = "average_counters";
 static constexpr char detailedCntReport[] = "detailed_counters";
 
+/// @brief Latency distribution of the executed infer requests in milliseconds
+struct LatencyMetrics {
+    LatencyMetrics() = default;
+    explicit LatencyMetrics(const std::vector<double>& latencies);
+
+    double median = 0.0;
+    double avg = 0.0;
+    double min = 0.0;
+    double p90 = 0.0;
+    double p99 = 0.0;
+    double p999 = 0.0;
+    double max = 0.0;
+};
+
+/// @brief Results of the measurement under the given load
+struct LoadPointResults {
+    // model and run ("solo" or "concurrent") of the multi-model scenario, empty for the single model
+    std::string model;
+    std::string run;
+    // target arrival rate in requests per second, 0 for the closed-loop measurement
+    double arrivalRate = 0.0;
+    size_t iterations = 0;
+    double duration = 0.0;
+    double throughput = 0.0;
+    // time from the arrival to the completion of the request
+    LatencyMetrics latency;
+    LatencyMetrics queueing;
+    LatencyMetrics service;
+};
+
 /// @brief Responsible for collecting of statistics and dumping to .csv file
 class StatisticsReport {
 public:
@@ -28,6 +58,7 @@ public:
     struct Config {
         std::string report_type;
         std::string report_folder;
+        std::string json_report;
     };
 
     enum class Category {
@@ -53,6 +84,8 @@ public:
 
     void addParameters(const Category &category, const Parameters& parameters);
 
+    void addLoadPoint(const LoadPointResults& results);
+
     void dump();
 
     void dumpPerformanceCounters(const std::vector<PerformaceCounters> &perfCounts);
@@ -61,12 +94,17 @@ private:
     void dumpPerformanceCountersRequest(CsvDumper& dumper,
                                         const PerformaceCounters& perfCounts);
 
+    void dumpJson();
+
     // configuration of current benchmark execution
     const Config _config;
 
     // parameters
     std::map<Category, Parameters> _parameters;
 
+    // results of the closed-loop and open-loop measurements
+    std::vector<LoadPointResults> _loadPoints;
+
     // csv separator
     std::string _separator;
 };
@@ -44,11 +44,57 @@ HeteroAsyncInferRequest::HeteroAsyncInferRequest(const HeteroInferRequest::Ptr&
     }
 }
 
+HeteroAsyncInferRequest::HeteroAsyncInferRequest(const HeteroInferRequest::Ptr& request,
+                                                 const HeteroStagePool::Ptr&    stagePool,
+                                                 const ITaskExecutor::Ptr&      callbackExecutor) :
+    AsyncInferRequestThreadSafeDefault(request, nullptr, callbackExecutor),
+    _heteroInferRequest(request),
+    _stagePool(stagePool) {
+    _pipeline = {
+        {_stagePool, [this] {
+            _intermediateBlobs = HeteroStagePool::_thisBlobs;
+        }}
+    };
+    for (std::size_t stageId = 0; stageId < _stagePool->GetNumberOfStages(); ++stageId) {
+        auto stageExecutor = std::make_shared<HeteroStagePool::StageExecutor>(*_stagePool, *_heteroInferRequest,
+                                                                             _intermediateBlobs, stageId);
+        _stageExecutors.push_back(stageExecutor);
+        _pipeline.emplace_back(stageExecutor, [stageExecutor] {
+            if (StatusCode::OK != stageExecutor->_status) {
+                THROW_IE_EXCEPTION << InferenceEngine::details::as_status << stageExecutor->_status;
+            }
+        });
+    }
+}
+
 void HeteroAsyncInferRequest::StartAsync_ThreadUnsafe() {
-    _heteroInferRequest->updateInOutIfNeeded();
+    if (nullptr == _stagePool) {
+        _heteroInferRequest->updateInOutIfNeeded();
+    }
     RunFirstStage(_pipeline.begin(), _pipeline.end());
 }
 
+void HeteroAsyncInferRequest::Infer_ThreadUnsafe() {
+    if (nullptr == _stagePool) {
+        AsyncInferRequestThreadSafeDefault::Infer_ThreadUnsafe();
+    } else {
+        InferUsingAsync();
+    }
+}
+
+void HeteroAsyncInferRequest::GetPerformanceCounts_ThreadUnsafe(std::map<std::string, InferenceEngineProfileInfo>& perfMap) const {
+    if (nullptr == _stagePool) {
+        AsyncInferRequestThreadSafeDefault::GetPerformanceCounts_ThreadUnsafe(perfMap);
+    } else {
+        perfMap.clear();
+        for (std::size_t stageId = 0; stageId < _stageExecutors.size(); ++stageId) {
+            for (auto&& r : _stageExecutors[stageId]->_perfMap) {
+                perfMap[std::string("subgraph") + std::to_string(stageId) + ": " + r.first] = r.second;
+            }
+        }
+    }
+}
+
 StatusCode HeteroAsyncInferRequest::Wait(int64_t millis_timeout) {
     auto waitStatus = StatusCode::OK;
     try {
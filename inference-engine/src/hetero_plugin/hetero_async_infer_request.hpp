@@ -9,10 +9,13 @@
 
 #pragma once
 
+#include <map>
+#include <string>
 #include <vector>
 #include <memory>
 #include "cpp_interfaces/impl/ie_infer_async_request_thread_safe_default.hpp"
 #include "hetero_infer_request.hpp"
+#include "hetero_stage_pool.hpp"
 
 namespace HeteroPlugin {
 
@@ -22,13 +25,24 @@ public:
     HeteroAsyncInferRequest(const HeteroInferRequest::Ptr&              request,
                             const InferenceEngine::ITaskExecutor::Ptr&  taskExecutor,
                             const InferenceEngine::ITaskExecutor::Ptr&  callbackExecutor);
+    /**
+     * @brief Creates a pipelined request which is executed by the subnetwork requests of the stage pool
+     */
+    HeteroAsyncInferRequest(const HeteroInferRequest::Ptr&              request,
+                            const HeteroStagePool::Ptr&                 stagePool,
+                            const InferenceEngine::ITaskExecutor::Ptr&  callbackExecutor);
     ~HeteroAsyncInferRequest() override;
     void StartAsync_ThreadUnsafe() override;
+    void Infer_ThreadUnsafe() override;
+    void GetPerformanceCounts_ThreadUnsafe(std::map<std::string, InferenceEngine::InferenceEngineProfileInfo>& perfMap) const override;
     InferenceEngine::StatusCode Wait(int64_t millis_timeout) override;
 
 private:
-    HeteroInferRequest::Ptr                     _heteroInferRequest;
-    std::vector<InferenceEngine::StatusCode>    _statusCodes;
+    HeteroInferRequest::Ptr                                     _heteroInferRequest;
+    std::vector<InferenceEngine::StatusCode>                    _statusCodes;
+    HeteroStagePool::Ptr                                        _stagePool;
+    HeteroStagePool::IntermediateBlobs*                         _intermediateBlobs = nullptr;
+    std::vector<std::shared_ptr<HeteroStagePool::StageExecutor>> _stageExecutors;
 };
 
 }  // namespace HeteroPlugin
@@ -46,6 +46,18 @@ using namespace InferenceEngine::HeteroConfigParams;
 
 namespace {
 
+unsigned int parsePipelineDepth(const std::string& value) {
+    int depth = -1;
+    try {
+        depth = std::stoi(value);
+    } catch (...) {}
+    if (depth < 0) {
+        THROW_IE_EXCEPTION << "Wrong value " << value << " for the " << HETERO_CONFIG_KEY(PIPELINE_DEPTH)
+                           << " config key. Expected a non-negative integer";
+    }
+    return static_cast<unsigned int>(depth);
+}
+
 void forward(const CNNLayerPtr& layer, std::deque<InferenceEngine::CNNLayerPtr>& layers) {
     for (const auto& out : layer->outData) {
         for (const auto& out_link : getInputTo(out)) {
@@ -699,6 +711,10 @@ HeteroExecutableNetwork::HeteroExecutableNetwork(const InferenceEngine::ICNNNetw
     _heteroPlugin{plugin},
     _name{network.getName()},
     _config{config} {
+    auto itPipelineDepth = _config.find(HETERO_CONFIG_KEY(PIPELINE_DEPTH));
+    if (itPipelineDepth != _config.end()) {
+        _pipelineDepth = parsePipelineDepth(itPipelineDepth->second);
+    }
     if (network.getFunction() == nullptr) {
         InitCNNImpl(network);
     } else {
@@ -749,6 +765,11 @@ HeteroExecutableNetwork::HeteroExecutableNetwork(std::istream&
         importedConfigs[config.first] = config.second;
     }
 
+    auto itPipelineDepth = importedConfigs.find(HETERO_CONFIG_KEY(PIPELINE_DEPTH));
+    if (itPipelineDepth != importedConfigs.end()) {
+        _pipelineDepth = parsePipelineDepth(itPipelineDepth->second);
+    }
+
     std::vector<NetworkDesc> descs;
     pugi::xml_node subnetworksNode = heteroNode.child("subnetworks");
     for (auto subnetworkNode = subnetworksNode.child("subnetwork"); !subnetworkNode.empty();
@@ -934,11 +955,40 @@ InferRequestInternal::Ptr HeteroExecutableNetwork::CreateInferRequestImpl(
                                                 _blobNameMap);
 }
 
+HeteroStagePool::Ptr HeteroExecutableNetwork::GetStagePool() {
+    std::call_once(_stagePoolCreated, [&] {
+        // each subnetwork gets as many requests as its device runs in parallel, but not more than the pipeline depth
+        std::vector<HeteroStagePool::Subnetwork> subnetworks;
+        for (auto&& desc : networks) {
+            HeteroStagePool::Subnetwork subnetwork;
+            subnetwork._network = desc._network;
+            subnetwork._numRequests = _pipelineDepth;
+            try {
+                subnetwork._numRequests = std::min<std::size_t>(_pipelineDepth,
+                    desc._network.GetMetric(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS)).as<unsigned int>());
+            } catch (const InferenceEngine::details::InferenceEngineException&) {}
+            subnetwork._numRequests = std::max<std::size_t>(subnetwork._numRequests, 1);
+            subnetworks.push_back(subnetwork);
+        }
+        auto itPerfCount = _config.find(CONFIG_KEY(PERF_COUNT));
+        std::atomic_store(&_stagePool,
+            std::make_shared<HeteroStagePool>(subnetworks, _networkInputs, _networkOutputs, _blobNameMap, _pipelineDepth,
+                                              itPerfCount != _config.end() && itPerfCount->second == YES));
+    });
+    return _stagePool;
+}
+
 void HeteroExecutableNetwork::CreateInferRequest(IInferRequest::Ptr &asyncRequest) {
-    auto heteroInferRequest = std::dynamic_pointer_cast<HeteroInferRequest>(
-            CreateInferRequestImpl(_networkInputs, _networkOutputs));
+    HeteroInferRequest::Ptr heteroInferRequest;
+    HeteroAsyncInferRequest::Ptr asyncThreadSafeImpl;
+    if (0 == _pipelineDepth) {
+        heteroInferRequest = std::dynamic_pointer_cast<HeteroInferRequest>(CreateInferRequestImpl(_networkInputs, _networkOutputs));
+        asyncThreadSafeImpl = std::make_shared<HeteroAsyncInferRequest>(heteroInferRequest, _taskExecutor, _callbackExecutor);
+    } else {
+        heteroInferRequest = std::make_shared<HeteroInferRequest>(_networkInputs, _networkOutputs);
+        asyncThreadSafeImpl = std::make_shared<HeteroAsyncInferRequest>(heteroInferRequest, GetStagePool(), _callbackExecutor);
+    }
     heteroInferRequest->setPointerToExecutableNetworkInternal(shared_from_this());
-    auto asyncThreadSafeImpl = std::make_shared<HeteroAsyncInferRequest>(heteroInferRequest, _taskExecutor, _callbackExecutor);
     asyncRequest.reset(new InferRequestBase<HeteroAsyncInferRequest>(asyncThreadSafeImpl),
                        [](IInferRequest *p) { p->Release(); });
     asyncThreadSafeImpl->SetPointerToPublicInterface(asyncRequest);
@@ -952,6 +1002,11 @@ void HeteroExecutableNetwork::GetConfig(const std::string &name, InferenceEngine
         } else {
             result = std::string{};
         }
+    } else if (name == HETERO_CONFIG_KEY(PIPELINE_DEPTH)) {
+        result = _pipelineDepth;
+    } else if (name == HETERO_CONFIG_KEY(PARTITIONING_POLICY)) {
+        auto it = _config.find(name);
+        result = it != _config.end() ? it->second : std::string{HETERO_PRIORITY};
     } else if (name == HETERO_CONFIG_KEY(DUMP_GRAPH_DOT) ||
                name == CONFIG_KEY(EXCLUSIVE_ASYNC_REQUESTS)) {
         auto it = _config.find(name);
@@ -1019,6 +1074,10 @@ void HeteroExecutableNetwork::GetMetric(const std::string &name, InferenceEngine
             METRIC_KEY(SUPPORTED_CONFIG_KEYS),
             METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS)
         };
+        if (0 != _pipelineDepth) {
+            heteroMetrics.push_back(METRIC_KEY(HETERO_STAGE_OCCUPANCY));
+            heteroMetrics.push_back(METRIC_KEY(HETERO_STAGE_AVERAGE_LATENCY));
+        }
 
         {
             std::vector<::Metrics> pluginMetrics;
@@ -1040,6 +1099,8 @@ void HeteroExecutableNetwork::GetMetric(const std::string &name, InferenceEngine
         std::vector<std::string> heteroConfigKeys = {
             "TARGET_FALLBACK",
             HETERO_CONFIG_KEY(DUMP_GRAPH_DOT),
+            HETERO_CONFIG_KEY(PIPELINE_DEPTH),
+            HETERO_CONFIG_KEY(PARTITIONING_POLICY),
             CONFIG_KEY(EXCLUSIVE_ASYNC_REQUESTS)
         };
 
@@ -1067,6 +1128,14 @@ void HeteroExecutableNetwork::GetMetric(const std::string &name, InferenceEngine
             value = std::max(value, desc._network.GetMetric(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS)).as<unsigned int>());
         }
         result = IE_SET_METRIC(OPTIMAL_NUMBER_OF_INFER_REQUESTS, value);
+    } else if (0 != _pipelineDepth && METRIC_KEY(HETERO_STAGE_OCCUPANCY) == name) {
+        auto stagePool = std::atomic_load(&_stagePool);
+        result = IE_SET_METRIC(HETERO_STAGE_OCCUPANCY,
+            nullptr == stagePool ? std::vector<float>(networks.size(), 0.0f) : stagePool->GetStageOccupancy());
+    } else if (0 != _pipelineDepth && METRIC_KEY(HETERO_STAGE_AVERAGE_LATENCY) == name) {
+        auto stagePool = std::atomic_load(&_stagePool);
+        result = IE_SET_METRIC(HETERO_STAGE_AVERAGE_LATENCY,
+            nullptr == stagePool ? std::vector<float>(networks.size(), 0.0f) : stagePool->GetStageAverageLatency());
     } else {
         // find metric key among plugin metrics
         for (auto&& desc : networks) {
@@ -12,6 +12,7 @@
 #include <string>
 #include <vector>
 #include <map>
+#include <mutex>
 #include <unordered_map>
 #include <unordered_set>
 
@@ -22,6 +23,7 @@
 #include "ie_icore.hpp"
 #include <legacy/cnn_network_impl.hpp>
 #include "hetero_async_infer_request.hpp"
+#include "hetero_stage_pool.hpp"
 
 namespace HeteroPlugin {
 
@@ -66,6 +68,8 @@ private:
 
     void InitNgraph(const InferenceEngine::ICNNNetwork&     network);
 
+    HeteroStagePool::Ptr GetStagePool();
+
     struct NetworkDesc {
         std::string                                 _device;
         InferenceEngine::CNNNetwork                 _clonedNetwork;
@@ -77,6 +81,9 @@ private:
     std::string                         _name;
     std::map<std::string, std::string>  _config;
     std::unordered_map<std::string, std::string> _blobNameMap;
+    unsigned int                        _pipelineDepth = 0;
+    std::once_flag                      _stagePoolCreated;
+    HeteroStagePool::Ptr                _stagePool;
 };
 
 }  // namespace HeteroPlugin
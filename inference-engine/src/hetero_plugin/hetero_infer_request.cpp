@@ -5,6 +5,7 @@
 #include "hetero_infer_request.hpp"
 #include "hetero_itt.hpp"
 #include <ie_blob.h>
+#include <blob_factory.hpp>
 #include <legacy/ie_util_internal.hpp>
 #include <description_buffer.hpp>
 #include <ie_layouts.h>
@@ -65,9 +66,41 @@ HeteroInferRequest::HeteroInferRequest(InferenceEngine::InputsDataMap networkInp
     }
 }
 
+HeteroInferRequest::HeteroInferRequest(InferenceEngine::InputsDataMap networkInputs,
+                                       InferenceEngine::OutputsDataMap networkOutputs) :
+    InferRequestInternal(networkInputs, networkOutputs) {
+    if (_networkOutputs.empty() || _networkInputs.empty()) {
+        THROW_IE_EXCEPTION << "Internal error: no information about network's output/input";
+    }
+    for (auto&& input : _networkInputs) {
+        _inputs[input.first] = make_blob_with_precision(input.second->getTensorDesc());
+        _inputs[input.first]->allocate();
+    }
+    for (auto&& output : _networkOutputs) {
+        _outputs[output.first] = make_blob_with_precision(output.second->getTensorDesc());
+        _outputs[output.first]->allocate();
+    }
+}
+
+Blob::Ptr HeteroInferRequest::GetUserBlob(const std::string& name) const {
+    auto itPreProcData = _preProcData.find(name);
+    if (itPreProcData != _preProcData.end()) {
+        return itPreProcData->second->getRoiBlob();
+    }
+    auto itInput = _inputs.find(name);
+    if (itInput != _inputs.end()) {
+        return itInput->second;
+    }
+    auto itOutput = _outputs.find(name);
+    if (itOutput != _outputs.end()) {
+        return itOutput->second;
+    }
+    return nullptr;
+}
+
 void HeteroInferRequest::SetBlob(const char* name, const InferenceEngine::Blob::Ptr& data) {
     InferenceEngine::InferRequestInternal::SetBlob(name, data);
-    assert(!_inferRequests.empty());
+    // the pipelined request has no subnetwork requests, its blobs are set to HeteroStagePool requests on each run
     for (auto &&desc : _inferRequests) {
         auto &r = desc._request;
         assert(nullptr != r);
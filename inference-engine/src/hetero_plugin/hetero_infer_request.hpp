@@ -38,6 +38,12 @@ public:
                                 const SubRequestsList &inferRequests,
                                 const std::unordered_map<std::string, std::string>& blobNameMap);
 
+    /**
+     * @brief Creates an infer request without subnetwork requests. It is executed by requests of HeteroStagePool.
+     */
+    explicit HeteroInferRequest(InferenceEngine::InputsDataMap networkInputs,
+                                InferenceEngine::OutputsDataMap networkOutputs);
+
     void InferImpl() override;
 
     void SetBlob(const char* name, const InferenceEngine::Blob::Ptr& data) override;
@@ -46,6 +52,9 @@ public:
 
     void updateInOutIfNeeded();
 
+    // Returns a blob set to the network input or output, or nullptr if there is no input or output of the name
+    InferenceEngine::Blob::Ptr GetUserBlob(const std::string& name) const;
+
     SubRequestsList _inferRequests;
     std::map<std::string, InferenceEngine::Blob::Ptr>   _blobs;
 };
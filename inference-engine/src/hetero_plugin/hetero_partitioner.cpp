@@ -0,0 +1,301 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <functional>
+#include <iomanip>
+#include <limits>
+#include <memory>
+#include <numeric>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <legacy/details/ie_cnn_network_iterator.hpp>
+#include <legacy/ie_layers.h>
+
+#include <ngraph/function.hpp>
+#include <ngraph/op/util/op_types.hpp>
+
+#include "hetero_partitioner.hpp"
+
+using namespace HeteroPlugin;
+using namespace InferenceEngine;
+
+namespace {
+
+std::vector<std::string> getSupportedDevices(const std::string& layerName,
+                                             const std::map<std::string, std::map<std::string, std::string>>& supportedLayers,
+                                             const std::vector<std::string>& devices) {
+    std::vector<std::string> layerDevices;
+    for (auto&& device : devices) {
+        auto itDevice = supportedLayers.find(device);
+        if (itDevice != supportedLayers.end() && itDevice->second.count(layerName) != 0) {
+            layerDevices.push_back(device);
+        }
+    }
+    return layerDevices;
+}
+
+}  // namespace
+
+PartitionGraph HeteroPlugin::buildPartitionGraph(const ICNNNetwork&                                                 network,
+                                                 const std::map<std::string, std::map<std::string, std::string>>&   supportedLayers,
+                                                 const std::vector<std::string>&                                    devices) {
+    PartitionGraph graph;
+    auto function = network.getFunction();
+    if (function) {
+        std::unordered_map<ngraph::Node*, std::size_t> indices;
+        std::vector<std::shared_ptr<ngraph::Node>> attachedNodes;
+        for (auto&& node : function->get_ordered_ops()) {
+            if (ngraph::op::is_constant(node) || ngraph::op::is_parameter(node) || ngraph::op::is_output(node)) {
+                attachedNodes.push_back(node);
+                continue;
+            }
+            auto layerDevices = getSupportedDevices(node->get_friendly_name(), supportedLayers, devices);
+            if (!layerDevices.empty()) {
+                indices.emplace(node.get(), graph._layers.size());
+                graph._layers.push_back({node->get_friendly_name(), layerDevices, {}});
+            }
+        }
+        for (auto&& node : attachedNodes) {
+            std::vector<ngraph::Node*> connectedNodes;
+            if (ngraph::op::is_output(node)) {
+                connectedNodes.push_back(node->input_value(0).get_node());
+            } else {
+                for (auto&& input : node->output(0).get_target_inputs()) {
+                    connectedNodes.push_back(input.get_node());
+                }
+            }
+            for (auto&& connectedNode : connectedNodes) {
+                auto itLayer = indices.find(connectedNode);
+                if (itLayer != indices.end()) {
+                    graph._attachedLayers.push_back({node->get_friendly_name(), itLayer->second});
+                    break;
+                }
+            }
+        }
+        for (auto&& index : indices) {
+            for (auto&& output : index.first->outputs()) {
+                std::size_t bytes = 0;
+                if (output.get_partial_shape().is_static()) {
+                    bytes = ngraph::shape_size(output.get_shape()) * output.get_element_type().size();
+                }
+                for (auto&& input : output.get_target_inputs()) {
+                    auto itConsumer = indices.find(input.get_node());
+                    if (itConsumer != indices.end()) {
+                        graph._edges.push_back({index.second, itConsumer->second, bytes});
+                    }
+                }
+            }
+        }
+    } else {
+        std::unordered_map<std::string, std::size_t> indices;
+        std::vector<CNNLayerPtr> layers;
+        std::vector<CNNLayerPtr> attachedLayers;
+        for (details::CNNNetworkIterator itLayer{&network}; itLayer != details::CNNNetworkIterator{}; ++itLayer) {
+            if ((*itLayer)->type == "Const" || (*itLayer)->type == "Input") {
+                attachedLayers.push_back(*itLayer);
+                continue;
+            }
+            auto layerDevices = getSupportedDevices((*itLayer)->name, supportedLayers, devices);
+            if (!layerDevices.empty()) {
+                indices.emplace((*itLayer)->name, graph._layers.size());
+                graph._layers.push_back({(*itLayer)->name, layerDevices, {}});
+                layers.push_back(*itLayer);
+            }
+        }
+        for (std::size_t i = 0; i < layers.size(); ++i) {
+            for (auto&& data : layers[i]->outData) {
+                auto& desc = data->getTensorDesc();
+                std::size_t bytes = desc.getPrecision().size() *
+                    std::accumulate(desc.getDims().begin(), desc.getDims().end(), std::size_t{1}, std::multiplies<std::size_t>());
+                for (auto&& consumer : getInputTo(data)) {
+                    auto itConsumer = indices.find(consumer.first);
+                    if (itConsumer != indices.end()) {
+                        graph._edges.push_back({i, itConsumer->second, bytes});
+                    }
+                }
+            }
+        }
+        for (auto&& layer : attachedLayers) {
+            bool attached = false;
+            for (auto&& data : layer->outData) {
+                for (auto&& consumer : getInputTo(data)) {
+                    auto itConsumer = indices.find(consumer.first);
+                    if (!attached && itConsumer != indices.end()) {
+                        graph._attachedLayers.push_back({layer->name, itConsumer->second});
+                        attached = true;
+                    }
+                }
+            }
+        }
+    }
+    return graph;
+}
+
+std::map<std::string, std::string> PartitionGraph::GetAffinities(const std::vector<std::string>& affinities) const {
+    std::map<std::string, std::string> result;
+    for (std::size_t i = 0; i < _layers.size(); ++i) {
+        result[_layers[i]._name] = affinities[i];
+    }
+    for (auto&& attachedLayer : _attachedLayers) {
+        result[attachedLayer._name] = affinities[attachedLayer._layer];
+    }
+    return result;
+}
+
+CostModelPartitioner::CostModelPartitioner(const PartitionGraph& graph,
+                                           double                transferCostPerByte,
+                                           double                transferOverhead) :
+    _graph(graph),
+    _transferCostPerByte{transferCostPerByte},
+    _transferOverhead{transferOverhead},
+    _layerEdges(graph._layers.size()) {
+    for (std::size_t edgeId = 0; edgeId < _graph._edges.size(); ++edgeId) {
+        auto& edge = _graph._edges[edgeId];
+        _layerEdges[edge._from].push_back(edgeId);
+        if (edge._to != edge._from) {
+            _layerEdges[edge._to].push_back(edgeId);
+        }
+    }
+}
+
+double CostModelPartitioner::EdgeCost(const PartitionGraph::Edge& edge, const std::vector<std::string>& affinities) const {
+    return affinities[edge._from] == affinities[edge._to] ? 0.0 : _transferOverhead + _transferCostPerByte * edge._bytes;
+}
+
+CostModelPartitioner::Partition CostModelPartitioner::Evaluate(const std::vector<std::string>& affinities) const {
+    Partition partition;
+    partition._affinities = affinities;
+    for (std::size_t i = 0; i < _graph._layers.size(); ++i) {
+        partition._computeCost += _graph._layers[i]._costs.at(affinities[i]);
+    }
+    for (auto&& edge : _graph._edges) {
+        if (affinities[edge._from] != affinities[edge._to]) {
+            partition._transferCost += EdgeCost(edge, affinities);
+            partition._cutEdges++;
+            partition._cutBytes += edge._bytes;
+        }
+    }
+    return partition;
+}
+
+double CostModelPartitioner::MoveGain(const std::vector<std::size_t>& layers,
+                                      const std::string& device,
+                                      const std::vector<std::string>& affinities) const {
+    std::vector<bool> moved(_graph._layers.size(), false);
+    std::vector<std::size_t> edges;
+    double gain = 0.0;
+    for (auto&& layerId : layers) {
+        auto& costs = _graph._layers[layerId]._costs;
+        auto itCost = costs.find(device);
+        if (itCost == costs.end()) {
+            return -std::numeric_limits<double>::infinity();
+        }
+        gain += costs.at(affinities[layerId]) - itCost->second;
+        moved[layerId] = true;
+        edges.insert(edges.end(), _layerEdges[layerId].begin(), _layerEdges[layerId].end());
+    }
+    std::sort(edges.begin(), edges.end());
+    edges.erase(std::unique(edges.begin(), edges.end()), edges.end());
+    for (auto&& edgeId : edges) {
+        auto& edge = _graph._edges[edgeId];
+        auto& from = moved[edge._from] ? device : affinities[edge._from];
+        auto& to = moved[edge._to] ? device : affinities[edge._to];
+        auto newCost = from == to ? 0.0 : _transferOverhead + _transferCostPerByte * edge._bytes;
+        gain += EdgeCost(edge, affinities) - newCost;
+    }
+    return gain;
+}
+
+std::vector<std::vector<std::size_t>> CostModelPartitioner::GetGroups(const std::vector<std::string>& affinities) const {
+    std::vector<std::size_t> parents(_graph._layers.size());
+    std::iota(parents.begin(), parents.end(), 0);
+    std::function<std::size_t(std::size_t)> find = [&] (std::size_t i) {
+        return parents[i] == i ? i : parents[i] = find(parents[i]);
+    };
+    for (auto&& edge : _graph._edges) {
+        if (affinities[edge._from] == affinities[edge._to]) {
+            parents[find(edge._from)] = find(edge._to);
+        }
+    }
+    std::map<std::size_t, std::vector<std::size_t>> groups;
+    for (std::size_t i = 0; i < parents.size(); ++i) {
+        groups[find(i)].push_back(i);
+    }
+    std::vector<std::vector<std::size_t>> result;
+    for (auto&& group : groups) {
+        result.push_back(std::move(group.second));
+    }
+    return result;
+}
+
+CostModelPartitioner::Partition CostModelPartitioner::Optimize(const std::vector<std::string>& affinities) const {
+    // every applied move strictly decreases the cost, so the search always terminates,
+    // the number of passes is limited to bound the time spent for large networks
+    static constexpr int maxPasses = 100;
+    static constexpr double minGain = 1e-6;
+    auto current = affinities;
+    for (int pass = 0; pass < maxPasses; ++pass) {
+        bool improved = false;
+        for (std::size_t layerId = 0; layerId < _graph._layers.size(); ++layerId) {
+            for (auto&& device : _graph._layers[layerId]._devices) {
+                if (device != current[layerId] && MoveGain({layerId}, device, current) > minGain) {
+                    current[layerId] = device;
+                    improved = true;
+                }
+            }
+        }
+        for (auto&& group : GetGroups(current)) {
+            auto& devices = _graph._layers[group.front()]._devices;
+            for (auto&& device : devices) {
+                if (MoveGain(group, device, current) > minGain) {
+                    for (auto&& layerId : group) {
+                        current[layerId] = device;
+                    }
+                    improved = true;
+                }
+            }
+        }
+        if (!improved) {
+            break;
+        }
+    }
+    return Evaluate(current);
+}
+
+void CostModelPartitioner::Dump(std::ostream& stream, const Partition& initial, const Partition& optimized) const {
+    auto dumpCost = [&] (const char* name, const Partition& partition) {
+        stream << name << " latency: " << partition.GetCost() << " us (compute: " << partition._computeCost
+               << " us, transfers: " << partition._transferCost << " us for " << partition._cutEdges
+               << " cut edges of " << partition._cutBytes << " bytes)" << std::endl;
+    };
+    stream << std::fixed << std::setprecision(3);
+    dumpCost("Initial", initial);
+    dumpCost("Optimized", optimized);
+    stream << std::endl << "Layers:" << std::endl;
+    for (std::size_t i = 0; i < _graph._layers.size(); ++i) {
+        auto& layer = _graph._layers[i];
+        auto& device = optimized._affinities[i];
+        stream << layer._name << ": " << device << " (" << layer._costs.at(device) << " us)";
+        for (auto&& cost : layer._costs) {
+            if (cost.first != device) {
+                stream << ", " << cost.first << ": " << cost.second << " us";
+            }
+        }
+        if (initial._affinities[i] != device) {
+            stream << ", moved from " << initial._affinities[i];
+        }
+        stream << std::endl;
+    }
+    stream << std::endl << "Cut edges:" << std::endl;
+    for (auto&& edge : _graph._edges) {
+        if (optimized._affinities[edge._from] != optimized._affinities[edge._to]) {
+            stream << _graph._layers[edge._from]._name << " (" << optimized._affinities[edge._from] << ") -> "
+                   << _graph._layers[edge._to]._name << " (" << optimized._affinities[edge._to] << "): "
+                   << edge._bytes << " bytes" << std::endl;
+        }
+    }
+}
@@ -0,0 +1,112 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief a header file for the cost model based assignment of layers to devices
+ * @file hetero_partitioner.hpp
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <map>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include <ie_icnn_network.hpp>
+
+namespace HeteroPlugin {
+
+/**
+ * @brief Layers of a network with the devices that support them and the tensors transferred between the layers
+ */
+struct PartitionGraph {
+    struct Layer {
+        std::string                     _name;
+        // supported devices in the priority order
+        std::vector<std::string>        _devices;
+        // estimated execution time in microseconds for each supported device
+        std::map<std::string, double>   _costs;
+    };
+    struct Edge {
+        std::size_t _from;
+        std::size_t _to;
+        std::size_t _bytes;
+    };
+    // a constant, parameter or result which is executed on the device of the connected layer
+    struct AttachedLayer {
+        std::string _name;
+        std::size_t _layer;
+    };
+    std::vector<Layer>          _layers;
+    std::vector<Edge>           _edges;
+    std::vector<AttachedLayer>  _attachedLayers;
+
+    /**
+     * @brief Returns devices of the layers and of the attached layers
+     * @param affinities devices of the layers
+     */
+    std::map<std::string, std::string> GetAffinities(const std::vector<std::string>& affinities) const;
+};
+
+/**
+ * @brief Creates a graph of the network layers supported by at least one device.
+ * Constants and parameters are attached to their first consumer and results to their producer,
+ * as they follow the affinity of the connected layers.
+ * @param network the network the query results are obtained for
+ * @param supportedLayers supported layers for each device
+ * @param devices devices in the priority order
+ */
+PartitionGraph buildPartitionGraph(const InferenceEngine::ICNNNetwork&                               network,
+                                   const std::map<std::string, std::map<std::string, std::string>>&  supportedLayers,
+                                   const std::vector<std::string>&                                   devices);
+
+/**
+ * @brief Assigns layers to devices minimizing the estimated latency of sequentially executed subgraphs:
+ * the sum of layer costs and costs of tensor transfers over the cut edges
+ */
+class CostModelPartitioner {
+public:
+    struct Partition {
+        std::vector<std::string>    _affinities;
+        double                      _computeCost = 0.0;
+        double                      _transferCost = 0.0;
+        std::size_t                 _cutEdges = 0;
+        std::size_t                 _cutBytes = 0;
+
+        double GetCost() const { return _computeCost + _transferCost; }
+    };
+
+    /**
+     * @param graph a graph with the layer costs filled
+     * @param transferCostPerByte a cost of a byte transfer between devices in microseconds
+     * @param transferOverhead a fixed cost of a tensor transfer between devices in microseconds
+     */
+    explicit CostModelPartitioner(const PartitionGraph& graph,
+                                  double transferCostPerByte = 1e-4,
+                                  double transferOverhead = 20.0);
+
+    Partition Evaluate(const std::vector<std::string>& affinities) const;
+
+    /**
+     * @brief Improves the partition by moving single layers and whole connected groups of layers
+     * between devices while the estimated latency decreases
+     */
+    Partition Optimize(const std::vector<std::string>& affinities) const;
+
+    void Dump(std::ostream& stream, const Partition& initial, const Partition& optimized) const;
+
+private:
+    double EdgeCost(const PartitionGraph::Edge& edge, const std::vector<std::string>& affinities) const;
+    double MoveGain(const std::vector<std::size_t>& layers, const std::string& device, const std::vector<std::string>& affinities) const;
+    std::vector<std::vector<std::size_t>> GetGroups(const std::vector<std::string>& affinities) const;
+
+    const PartitionGraph&                       _graph;
+    double                                      _transferCostPerByte = 0.0;
+    double                                      _transferOverhead = 0.0;
+    std::vector<std::vector<std::size_t>>       _layerEdges;
+};
+
+}  // namespace HeteroPlugin
@@ -4,16 +4,20 @@
 
 #include "ie_metric_helpers.hpp"
 #include "hetero_plugin.hpp"
+#include <algorithm>
+#include <limits>
 #include <memory>
 #include <vector>
 #include <map>
 #include <string>
 #include <utility>
 #include <fstream>
+#include <cstring>
 #include <unordered_set>
 #include "ie_plugin_config.hpp"
 #include "hetero/hetero_plugin_config.hpp"
 #include "hetero_executable_network.hpp"
+#include "hetero_partitioner.hpp"
 #include <cpp_interfaces/interface/ie_internal_plugin_config.hpp>
 
 using namespace InferenceEngine;
@@ -32,6 +36,8 @@ Engine::Engine() {
     _pluginName = "HETERO";
     _config[KEY_EXCLUSIVE_ASYNC_REQUESTS] = YES;
     _config[HETERO_CONFIG_KEY(DUMP_GRAPH_DOT)] = NO;
+    _config[HETERO_CONFIG_KEY(PIPELINE_DEPTH)] = "0";
+    _config[HETERO_CONFIG_KEY(PARTITIONING_POLICY)] = HETERO_PRIORITY;
 }
 
 namespace {
@@ -194,6 +200,126 @@ void Engine::SetAffinity(InferenceEngine::ICNNNetwork &network, const Configs &c
     }
 }
 
+std::map<std::string, std::map<std::string, double>> Engine::ProfileDevices(
+        const ICNNNetwork&                                                  network,
+        const DeviceMetaInformationMap&                                     metaDevices,
+        const std::vector<std::string>&                                     devices,
+        const std::map<std::string, std::map<std::string, std::string>>&    supportedLayers) const {
+    auto profile = [&] (ExecutableNetwork executableNetwork) {
+        auto request = executableNetwork.CreateInferRequest();
+        for (auto&& input : executableNetwork.GetInputsInfo()) {
+            auto blob = as<MemoryBlob>(request.GetBlob(input.first));
+            if (blob) {
+                std::memset(blob->wmap().as<void*>(), 0, blob->byteSize());
+            }
+        }
+        // the first inference is a warm up one
+        request.Infer();
+        request.Infer();
+        return request.GetPerformanceCounts();
+    };
+    std::map<std::string, std::map<std::string, double>> profiles;
+    for (auto&& deviceName : devices) {
+        auto deviceConfig = metaDevices.at(deviceName);
+        deviceConfig[KEY_PERF_COUNT] = YES;
+        std::map<std::string, InferenceEngineProfileInfo> perfCounters;
+        try {
+            perfCounters = profile(GetCore()->LoadNetwork(CNNNetwork{cloneNetwork(network)}, deviceName, deviceConfig));
+        } catch (const details::InferenceEngineException&) {
+            // The device cannot execute the whole network, so it is profiled as the first priority device of HETERO.
+            // It executes all the layers it supports, and the rest of layers falls back to other devices.
+            std::string fallbackDevices = deviceName;
+            for (auto&& device : devices) {
+                if (device != deviceName) {
+                    fallbackDevices += "," + device;
+                }
+            }
+            Configs heteroConfig = {{"TARGET_FALLBACK", fallbackDevices},
+                                    {HETERO_CONFIG_KEY(PARTITIONING_POLICY), HETERO_PRIORITY},
+                                    {KEY_PERF_COUNT, YES}};
+            try {
+                perfCounters = profile(GetCore()->LoadNetwork(CNNNetwork{cloneNetwork(network)}, "HETERO", heteroConfig));
+            } catch (const details::InferenceEngineException&) {
+                // the device cannot be profiled at all, so its layer costs are estimated
+                continue;
+            }
+        }
+        auto itSupported = supportedLayers.find(deviceName);
+        auto& deviceProfile = profiles[deviceName];
+        for (auto&& perfCounter : perfCounters) {
+            // HETERO prefixes the layer names by the subgraph names
+            auto layerName = perfCounter.first;
+            auto separator = layerName.find(": ");
+            if (0 == layerName.compare(0, std::strlen("subgraph"), "subgraph") && std::string::npos != separator) {
+                layerName = layerName.substr(separator + 2);
+            }
+            // counters of layers executed on other devices are skipped
+            if (itSupported != supportedLayers.end() && contains(itSupported->second, layerName)) {
+                deviceProfile[layerName] = perfCounter.second.realTime_uSec;
+            }
+        }
+    }
+    return profiles;
+}
+
+void Engine::PartitionByCostModel(const ICNNNetwork&                                  network,
+                                  const DeviceMetaInformationMap&                     metaDevices,
+                                  const std::vector<std::string>&                     devices,
+                                  const std::map<std::string, QueryNetworkResult>&    queryResults,
+                                  const Configs&                                      config,
+                                  QueryNetworkResult&                                 qr) const {
+    std::map<std::string, std::map<std::string, std::string>> supportedLayers;
+    for (auto&& queryResult : queryResults) {
+        supportedLayers[queryResult.first] = queryResult.second.supportedLayersMap;
+    }
+    auto graph = buildPartitionGraph(network, supportedLayers, devices);
+    auto profiles = ProfileDevices(network, metaDevices, devices, supportedLayers);
+
+    // A layer which is not profiled on a device is expected to take as much time as on the fastest profiled device.
+    // If the layer is not profiled at all, only the transfers are taken into account.
+    for (auto&& layer : graph._layers) {
+        double knownCost = std::numeric_limits<double>::max();
+        for (auto&& profile : profiles) {
+            auto itCost = profile.second.find(layer._name);
+            if (itCost != profile.second.end()) {
+                knownCost = std::min(knownCost, itCost->second);
+            }
+        }
+        if (std::numeric_limits<double>::max() == knownCost) {
+            knownCost = 0.0;
+        }
+        for (auto&& device : layer._devices) {
+            auto cost = knownCost;
+            auto itProfile = profiles.find(device);
+            if (itProfile != profiles.end()) {
+                auto itCost = itProfile->second.find(layer._name);
+                if (itCost != itProfile->second.end()) {
+                    cost = itCost->second;
+                }
+            }
+            layer._costs[device] = cost;
+        }
+    }
+
+    std::vector<std::string> affinities;
+    for (auto&& layer : graph._layers) {
+        affinities.push_back(qr.supportedLayersMap.at(layer._name));
+    }
+    CostModelPartitioner partitioner{graph};
+    auto initial = partitioner.Evaluate(affinities);
+    auto optimized = partitioner.Optimize(affinities);
+    // constants, parameters and results follow the layers they are attached to
+    for (auto&& affinity : graph.GetAffinities(optimized._affinities)) {
+        qr.supportedLayersMap[affinity.first] = affinity.second;
+    }
+
+    auto itDumpDot = config.find(HETERO_CONFIG_KEY(DUMP_GRAPH_DOT));
+    if (itDumpDot != config.end() && itDumpDot->second == YES) {
+        std::ofstream file("hetero_partition_" + network.getName() + ".txt");
+        partitioner.Dump(file, initial, optimized);
+    }
+}
+
 void Engine::QueryNetwork(const ICNNNetwork &network, const Configs& config, QueryNetworkResult &qr) const {
     if (GetCore() == nullptr) {
         THROW_IE_EXCEPTION << "Please, work with HETERO device via InferencEngine::Core object";
@@ -208,6 +334,15 @@ void Engine::QueryNetwork(const ICNNNetwork &network, const Configs& config, Que
     std::string fallbackDevicesStr = it->second;
     DeviceMetaInformationMap metaDevices = GetDevicePlugins(fallbackDevicesStr, tconfig);
 
+    auto itPolicy = tconfig.find(HETERO_CONFIG_KEY(PARTITIONING_POLICY));
+    if (itPolicy != tconfig.end() && itPolicy->second != HETERO_PRIORITY && itPolicy->second != HETERO_MIN_LATENCY) {
+        THROW_IE_EXCEPTION << "Unsupported value " << itPolicy->second << " for the "
+                           << HETERO_CONFIG_KEY(PARTITIONING_POLICY) << " config key";
+    }
+
+    // the network the layer names of query results belong to
+    const ICNNNetwork* queriedNetwork = &network;
+    std::shared_ptr<details::CNNNetworkImpl> cnnNetworkImpl;
     std::map<std::string, QueryNetworkResult> queryResults;
     auto queryNetwork = [&] (const InferenceEngine::ICNNNetwork & networkObject) {
         // go over devices and call query network
@@ -236,7 +371,8 @@ void Engine::QueryNetwork(const ICNNNetwork &network, const Configs& config, Que
             if (contains(tconfig, CONFIG_KEY_INTERNAL(AGGREGATED_PLUGIN))) {
                 THROW_IE_EXCEPTION << NOT_IMPLEMENTED_str;
             } else {
-                auto cnnNetworkImpl = std::make_shared<details::CNNNetworkImpl>(network);
+                cnnNetworkImpl = std::make_shared<details::CNNNetworkImpl>(network);
+                queriedNetwork = cnnNetworkImpl.get();
                 queryNetwork(*cnnNetworkImpl);
             }
         } else {
@@ -255,6 +391,10 @@ void Engine::QueryNetwork(const ICNNNetwork &network, const Configs& config, Que
         }
     }
 
+    if (itPolicy != tconfig.end() && itPolicy->second == HETERO_MIN_LATENCY) {
+        PartitionByCostModel(*queriedNetwork, metaDevices, fallbackDevices, queryResults, tconfig, qr);
+    }
+
     // set OK status
     qr.rc = StatusCode::OK;
 }
@@ -268,6 +408,8 @@ Parameter Engine::GetMetric(const std::string& name, const std::map<std::string,
     } else if (METRIC_KEY(SUPPORTED_CONFIG_KEYS) == name) {
         IE_SET_METRIC_RETURN(SUPPORTED_CONFIG_KEYS, std::vector<std::string>{
             HETERO_CONFIG_KEY(DUMP_GRAPH_DOT),
+            HETERO_CONFIG_KEY(PIPELINE_DEPTH),
+            HETERO_CONFIG_KEY(PARTITIONING_POLICY),
             "TARGET_FALLBACK",
             CONFIG_KEY(EXCLUSIVE_ASYNC_REQUESTS),
             CONFIG_KEY_INTERNAL(AGGREGATED_PLUGIN)});
@@ -284,6 +426,10 @@ Parameter Engine::GetConfig(const std::string& name, const std::map<std::string,
         IE_ASSERT(it != _config.end());
         bool dump = it->second == YES;
         return { dump };
+    } else if (name == HETERO_CONFIG_KEY(PIPELINE_DEPTH) || name == HETERO_CONFIG_KEY(PARTITIONING_POLICY)) {
+        auto it = _config.find(name);
+        IE_ASSERT(it != _config.end());
+        return { it->second };
     } else if (name == "TARGET_FALLBACK") {
         auto it = _config.find("TARGET_FALLBACK");
         if (it == _config.end()) {
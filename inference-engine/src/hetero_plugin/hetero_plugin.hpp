@@ -48,6 +48,21 @@ public:
 
 private:
     Configs GetSupportedConfig(const Configs& config, const std::string & deviceName) const;
+
+    // Returns execution times in microseconds of the layers for each device. A device which cannot execute the whole
+    // network is profiled on the layers it supports, while the rest of layers are executed on other devices.
+    std::map<std::string, std::map<std::string, double>> ProfileDevices(
+        const InferenceEngine::ICNNNetwork&                                 network,
+        const DeviceMetaInformationMap&                                     metaDevices,
+        const std::vector<std::string>&                                     devices,
+        const std::map<std::string, std::map<std::string, std::string>>&    supportedLayers) const;
+
+    void PartitionByCostModel(const InferenceEngine::ICNNNetwork&                                 network,
+                              const DeviceMetaInformationMap&                                     metaDevices,
+                              const std::vector<std::string>&                                     devices,
+                              const std::map<std::string, InferenceEngine::QueryNetworkResult>&   queryResults,
+                              const Configs&                                                      config,
+                              InferenceEngine::QueryNetworkResult&                                qr) const;
 };
 
 struct HeteroLayerColorer {
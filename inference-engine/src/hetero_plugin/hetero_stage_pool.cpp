@@ -0,0 +1,238 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <limits>
+#include <utility>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <blob_factory.hpp>
+#include <ie_algorithm.hpp>
+#include "hetero_stage_pool.hpp"
+#include "hetero_itt.hpp"
+
+using namespace HeteroPlugin;
+using namespace InferenceEngine;
+using namespace InferenceEngine::details;
+
+namespace {
+
+std::int64_t nowNs() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+}  // namespace
+
+thread_local HeteroStagePool::IntermediateBlobs* HeteroStagePool::_thisBlobs = nullptr;
+
+HeteroStagePool::StageExecutor::StageExecutor(HeteroStagePool& pool, HeteroInferRequest& request,
+                                              IntermediateBlobs*& blobs, std::size_t stageId) :
+    _pool(pool),
+    _request(request),
+    _blobs(blobs),
+    _stageId{stageId} {
+}
+
+void HeteroStagePool::StageExecutor::run(Task task) {
+    _task = std::move(task);
+    auto& stage = *_pool._stages[_stageId];
+    StageRequest* request = nullptr;
+    {
+        std::lock_guard<std::mutex> lock{_pool._mutex};
+        if (stage._idleRequests.empty()) {
+            // the stage is started by a request of the subnetwork once it completes
+            stage._waitingExecutors.push(this);
+            return;
+        }
+        request = stage._idleRequests.front();
+        stage._idleRequests.pop();
+    }
+    _pool.Start(*this, *request);
+}
+
+HeteroStagePool::HeteroStagePool(const std::vector<Subnetwork>&                       subnetworks,
+                                 const InputsDataMap&                                 networkInputs,
+                                 const OutputsDataMap&                                networkOutputs,
+                                 const std::unordered_map<std::string, std::string>&  blobNameMap,
+                                 unsigned int                                         depth,
+                                 bool                                                 needPerfCounters) :
+    _intermediateBlobs(depth),
+    _networkInputs{networkInputs},
+    _needPerfCounters{needPerfCounters},
+    _firstStartTime{std::numeric_limits<std::int64_t>::max()} {
+    for (std::size_t stageId = 0; stageId < subnetworks.size(); ++stageId) {
+        auto subnetwork = subnetworks[stageId];
+        _stages.emplace_back(new Stage);
+        auto& stage = *_stages.back();
+        for (auto&& inputInfo : subnetwork._network.GetInputsInfo()) {
+            auto itName = blobNameMap.find(inputInfo.first);
+            stage._blobNames.emplace_back(inputInfo.first,
+                (contains(networkInputs, inputInfo.first) || itName == blobNameMap.end()) ? inputInfo.first
+                                                                                           : itName->second);
+        }
+        for (auto&& outputInfo : subnetwork._network.GetOutputsInfo()) {
+            stage._blobNames.emplace_back(outputInfo.first, outputInfo.first);
+            // outputs of the network are written to blobs of infer requests directly
+            if (!contains(networkOutputs, outputInfo.first)) {
+                for (auto&& blobs : _intermediateBlobs) {
+                    auto& blob = blobs[outputInfo.first];
+                    blob = make_blob_with_precision(outputInfo.second->getTensorDesc());
+                    blob->allocate();
+                }
+            }
+        }
+        for (std::size_t i = 0; i < subnetwork._numRequests; ++i) {
+            stage._requests.emplace_back(new StageRequest);
+            auto* request = stage._requests.back().get();
+            request->_request = subnetwork._network.CreateInferRequest();
+            request->_request.SetCompletionCallback<std::function<void(InferRequest, StatusCode)>>(
+                [this, stageId, request] (InferRequest, StatusCode status) {
+                    StageCompleted(stageId, request, status);
+                });
+            stage._idleRequests.push(request);
+        }
+    }
+    for (auto&& blobs : _intermediateBlobs) {
+        _idleBlobs.push(&blobs);
+    }
+}
+
+void HeteroStagePool::Start(StageExecutor& executor, StageRequest& request) {
+    auto& stage = *_stages[executor._stageId];
+    request._executor = &executor;
+    try {
+        OV_ITT_SCOPED_TASK(itt::domains::HeteroPlugin, "HeteroStagePool::Bind");
+        for (auto&& blobName : stage._blobNames) {
+            auto blob = executor._request.GetUserBlob(blobName.second);
+            if (nullptr == blob) {
+                blob = executor._blobs->at(blobName.second);
+            }
+            auto& boundBlob = request._boundBlobs[blobName.first];
+            if (boundBlob != blob) {
+                auto itInput = _networkInputs.find(blobName.first);
+                if (itInput != _networkInputs.end()) {
+                    request._request.SetBlob(blobName.first, blob, itInput->second->getPreProcess());
+                } else {
+                    request._request.SetBlob(blobName.first, blob);
+                }
+                boundBlob = blob;
+            }
+        }
+        request._startTime = std::chrono::steady_clock::now();
+        std::int64_t firstStartTime = std::numeric_limits<std::int64_t>::max();
+        _firstStartTime.compare_exchange_strong(firstStartTime, nowNs());
+        request._request.StartAsync();
+    } catch (...) {
+        // blobs may be bound partially
+        request._boundBlobs.clear();
+        auto task = std::move(executor._task);
+        executor._status = StatusCode::GENERAL_ERROR;
+        Release(executor._stageId, &request);
+        Release(executor._blobs);
+        task();
+    }
+}
+
+void HeteroStagePool::StageCompleted(std::size_t stageId, StageRequest* request, StatusCode status) {
+    auto& stage = *_stages[stageId];
+    auto endTime = std::chrono::steady_clock::now();
+    stage._busyTime += std::chrono::duration_cast<std::chrono::nanoseconds>(endTime - request->_startTime).count();
+    ++stage._inferences;
+    auto lastEndTime = _lastEndTime.load();
+    auto endTimeNs = nowNs();
+    while (lastEndTime < endTimeNs && !_lastEndTime.compare_exchange_weak(lastEndTime, endTimeNs)) {}
+
+    auto executor = request->_executor;
+    auto task = std::move(executor->_task);
+    executor->_status = status;
+    if (_needPerfCounters && StatusCode::OK == status) {
+        executor->_perfMap = request->_request.GetPerformanceCounts();
+    }
+    // The subnetwork request is released as soon as its stage completes.
+    // Intermediate blobs are released before the infer request is completed by the task,
+    // so an infer request waiting for the result can be destroyed right after it
+    auto blobs = executor->_blobs;
+    Release(stageId, request);
+    if (StatusCode::OK != status || stageId + 1 == _stages.size()) {
+        Release(blobs);
+    }
+    task();
+}
+
+void HeteroStagePool::Release(std::size_t stageId, StageRequest* request) {
+    auto& stage = *_stages[stageId];
+    StageExecutor* executor = nullptr;
+    {
+        std::lock_guard<std::mutex> lock{_mutex};
+        if (stage._waitingExecutors.empty()) {
+            stage._idleRequests.push(request);
+            return;
+        }
+        executor = stage._waitingExecutors.front();
+        stage._waitingExecutors.pop();
+    }
+    Start(*executor, *request);
+}
+
+void HeteroStagePool::run(Task task) {
+    {
+        std::lock_guard<std::mutex> lock{_mutex};
+        _tasks.push(std::move(task));
+    }
+    Schedule();
+}
+
+void HeteroStagePool::Schedule() {
+    while (true) {
+        IntermediateBlobs* blobs = nullptr;
+        Task task;
+        {
+            std::lock_guard<std::mutex> lock{_mutex};
+            if (_idleBlobs.empty() || _tasks.empty()) {
+                return;
+            }
+            blobs = _idleBlobs.front();
+            _idleBlobs.pop();
+            task = std::move(_tasks.front());
+            _tasks.pop();
+        }
+        _thisBlobs = blobs;
+        task();
+    }
+}
+
+void HeteroStagePool::Release(IntermediateBlobs* blobs) {
+    {
+        std::lock_guard<std::mutex> lock{_mutex};
+        _idleBlobs.push(blobs);
+    }
+    Schedule();
+}
+
+std::size_t HeteroStagePool::GetNumberOfStages() const {
+    return _stages.size();
+}
+
+std::vector<float> HeteroStagePool::GetStageOccupancy() const {
+    const auto firstStartTime = _firstStartTime.load();
+    const auto lastEndTime = _lastEndTime.load();
+    const auto wallTime = lastEndTime > firstStartTime ? static_cast<double>(lastEndTime - firstStartTime) : 0.0;
+    std::vector<float> occupancy;
+    for (auto&& stage : _stages) {
+        occupancy.push_back(0.0 == wallTime ? 0.0f : static_cast<float>(stage->_busyTime.load() / wallTime));
+    }
+    return occupancy;
+}
+
+std::vector<float> HeteroStagePool::GetStageAverageLatency() const {
+    std::vector<float> latency;
+    for (auto&& stage : _stages) {
+        const auto inferences = stage->_inferences.load();
+        latency.push_back(0 == inferences ? 0.0f : static_cast<float>(stage->_busyTime.load() / 1e6 / inferences));
+    }
+    return latency;
+}
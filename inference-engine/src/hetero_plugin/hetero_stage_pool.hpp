@@ -0,0 +1,121 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief a header file for pools of subnetwork requests shared by pipelined HETERO infer requests
+ * @file hetero_stage_pool.hpp
+ */
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <cpp/ie_executable_network.hpp>
+#include <threading/ie_itask_executor.hpp>
+#include "hetero_infer_request.hpp"
+
+namespace HeteroPlugin {
+
+/**
+ * @brief Each subnetwork has its own pool of requests, and a ring of `depth` sets of intermediate blobs
+ * connects them. An infer request takes a set of intermediate blobs before the first subnetwork starts and returns it
+ * once the last one completes, so up to `depth` infer requests are in flight. A subnetwork request is taken only
+ * while its stage runs, so consecutive infer requests stream through the subnetworks like through an assembly line.
+ * The pool is also the executor of the first pipeline stage: a stage task waits in the queue for idle intermediate
+ * blobs.
+ */
+class HeteroStagePool : public InferenceEngine::ITaskExecutor {
+public:
+    using Ptr = std::shared_ptr<HeteroStagePool>;
+    using IntermediateBlobs = std::map<std::string, InferenceEngine::Blob::Ptr>;
+
+    struct Subnetwork {
+        InferenceEngine::ExecutableNetwork  _network;
+        std::size_t                         _numRequests = 1;
+    };
+
+    /**
+     * @brief Runs a subnetwork stage of a pipelined infer request once a request of the subnetwork is idle
+     */
+    class StageExecutor : public InferenceEngine::ITaskExecutor {
+    public:
+        StageExecutor(HeteroStagePool& pool, HeteroInferRequest& request, IntermediateBlobs*& blobs,
+                      std::size_t stageId);
+        void run(InferenceEngine::Task task) override;
+
+        InferenceEngine::StatusCode                                         _status = InferenceEngine::StatusCode::OK;
+        std::map<std::string, InferenceEngine::InferenceEngineProfileInfo>  _perfMap;
+
+    private:
+        friend class HeteroStagePool;
+
+        HeteroStagePool&        _pool;
+        HeteroInferRequest&     _request;
+        IntermediateBlobs*&     _blobs;
+        std::size_t             _stageId = 0;
+        InferenceEngine::Task   _task;
+    };
+
+    HeteroStagePool(const std::vector<Subnetwork>&                       subnetworks,
+                    const InferenceEngine::InputsDataMap&                networkInputs,
+                    const InferenceEngine::OutputsDataMap&               networkOutputs,
+                    const std::unordered_map<std::string, std::string>&  blobNameMap,
+                    unsigned int                                         depth,
+                    bool                                                 needPerfCounters);
+
+    void run(InferenceEngine::Task task) override;
+
+    void Release(IntermediateBlobs* blobs);
+
+    std::size_t GetNumberOfStages() const;
+    std::vector<float> GetStageOccupancy() const;
+    std::vector<float> GetStageAverageLatency() const;
+
+    static thread_local IntermediateBlobs*  _thisBlobs;
+
+private:
+    struct StageRequest {
+        InferenceEngine::InferRequest           _request;
+        // blobs set to the request, so they are not set again by the next infer request using the same ones
+        IntermediateBlobs                       _boundBlobs;
+        StageExecutor*                          _executor = nullptr;
+        std::chrono::steady_clock::time_point   _startTime;
+    };
+    struct Stage {
+        // subnetwork input and output names with names of blobs of an infer request or intermediate blobs they use
+        std::vector<std::pair<std::string, std::string>>    _blobNames;
+        std::vector<std::unique_ptr<StageRequest>>          _requests;
+        std::queue<StageRequest*>                           _idleRequests;
+        std::queue<StageExecutor*>                          _waitingExecutors;
+        std::atomic<std::uint64_t>                          _busyTime = {0};  // in nanoseconds
+        std::atomic<std::uint64_t>                          _inferences = {0};
+    };
+
+    void Schedule();
+    void Start(StageExecutor& executor, StageRequest& request);
+    void Release(std::size_t stageId, StageRequest* request);
+    void StageCompleted(std::size_t stageId, StageRequest* request, InferenceEngine::StatusCode status);
+
+    std::vector<std::unique_ptr<Stage>>     _stages;
+    std::vector<IntermediateBlobs>          _intermediateBlobs;
+    InferenceEngine::InputsDataMap          _networkInputs;
+    bool                                    _needPerfCounters = false;
+    std::atomic<std::int64_t>               _firstStartTime;
+    std::atomic<std::int64_t>               _lastEndTime = {0};
+
+    std::mutex                              _mutex;
+    std::queue<IntermediateBlobs*>          _idleBlobs;
+    std::queue<InferenceEngine::Task>       _tasks;
+};
+
+}  // namespace HeteroPlugin
@@ -0,0 +1,237 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "compilation_context.hpp"
+
+#include <cstdint>
+#include <cstring>
+#include <iomanip>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+#include <ngraph/function.hpp>
+#include <ngraph/variant.hpp>
+#include <ngraph/attribute_visitor.hpp>
+
+#include "ie_itt.hpp"
+
+namespace InferenceEngine {
+
+namespace {
+
+using Hash = std::uint64_t;
+
+inline Hash hashCombine(Hash seed, Hash value) {
+    return seed ^ (value + 0x9e3779b97f4a7c15ULL + (seed << 6) + (seed >> 2));
+}
+
+Hash hashBytes(Hash seed, const void* data, size_t size) {
+    if (size == 0) {
+        // data may be null for empty ranges, which memcpy does not accept
+        return hashCombine(seed, size);
+    }
+    auto bytes = static_cast<const std::uint8_t*>(data);
+    size_t i = 0;
+    for (; i + sizeof(Hash) <= size; i += sizeof(Hash)) {
+        Hash chunk;
+        std::memcpy(&chunk, bytes + i, sizeof(Hash));
+        seed = hashCombine(seed, chunk);
+    }
+    Hash tail = 0;
+    std::memcpy(&tail, bytes + i, size - i);
+    return hashCombine(hashCombine(seed, tail), size);
+}
+
+inline Hash hashValue(Hash seed, const std::string& value) {
+    return hashBytes(seed, value.data(), value.size());
+}
+
+template <typename T, typename = typename std::enable_if<std::is_arithmetic<T>::value>::type>
+inline Hash hashValue(Hash seed, T value) {
+    return hashBytes(seed, &value, sizeof(T));
+}
+
+template <typename T>
+inline Hash hashValue(Hash seed, const std::vector<T>& values) {
+    seed = hashCombine(seed, values.size());
+    for (auto&& value : values) {
+        seed = hashValue(seed, value);
+    }
+    return seed;
+}
+
+/**
+ * @brief Accumulates names and values of all operation attributes into a hash
+ */
+class HashingVisitor : public ngraph::AttributeVisitor {
+public:
+    explicit HashingVisitor(Hash& hash) : m_hash(hash) {}
+
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<void>& adapter) override {
+        // the attribute has no accessor the value can be read with, so only its presence is taken into account
+        m_hash = hashValue(m_hash, name);
+        m_hash = hashValue(m_hash, std::string(adapter.get_type_info().name));
+    }
+
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<void*>& adapter) override {
+        m_hash = hashValue(m_hash, name);
+        m_hash = hashBytes(m_hash, adapter.get_ptr(), adapter.size());
+    }
+
+#define HASH_ON_ADAPTER(type)                                                                          \
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<type>& adapter) override {         \
+        m_hash = hashValue(hashValue(m_hash, name), adapter.get());                                   \
+    }
+
+    HASH_ON_ADAPTER(std::string)
+    HASH_ON_ADAPTER(bool)
+    HASH_ON_ADAPTER(int8_t)
+    HASH_ON_ADAPTER(int16_t)
+    HASH_ON_ADAPTER(int32_t)
+    HASH_ON_ADAPTER(int64_t)
+    HASH_ON_ADAPTER(uint8_t)
+    HASH_ON_ADAPTER(uint16_t)
+    HASH_ON_ADAPTER(uint32_t)
+    HASH_ON_ADAPTER(uint64_t)
+    HASH_ON_ADAPTER(float)
+    HASH_ON_ADAPTER(double)
+    HASH_ON_ADAPTER(std::vector<int8_t>)
+    HASH_ON_ADAPTER(std::vector<int16_t>)
+    HASH_ON_ADAPTER(std::vector<int32_t>)
+    HASH_ON_ADAPTER(std::vector<int64_t>)
+    HASH_ON_ADAPTER(std::vector<uint8_t>)
+    HASH_ON_ADAPTER(std::vector<uint16_t>)
+    HASH_ON_ADAPTER(std::vector<uint32_t>)
+    HASH_ON_ADAPTER(std::vector<uint64_t>)
+    HASH_ON_ADAPTER(std::vector<float>)
+    HASH_ON_ADAPTER(std::vector<double>)
+    HASH_ON_ADAPTER(std::vector<std::string>)
+
+#undef HASH_ON_ADAPTER
+
+private:
+    Hash& m_hash;
+};
+
+Hash hashFunction(const ngraph::Function& function) {
+    Hash seed = 0;
+    const auto orderedOps = function.get_ordered_ops();
+
+    std::unordered_map<const ngraph::Node*, size_t> opIndices;
+    for (auto&& op : orderedOps) {
+        opIndices.emplace(op.get(), opIndices.size());
+    }
+
+    HashingVisitor visitor(seed);
+    for (auto&& op : orderedOps) {
+        const auto& typeInfo = op->get_type_info();
+        seed = hashValue(seed, std::string(typeInfo.name));
+        seed = hashValue(seed, typeInfo.version);
+        seed = hashValue(seed, op->get_friendly_name());
+
+        for (auto&& input : op->inputs()) {
+            const auto sourceOutput = input.get_source_output();
+            seed = hashValue(seed, opIndices.at(sourceOutput.get_node()));
+            seed = hashValue(seed, sourceOutput.get_index());
+        }
+
+        for (auto&& output : op->outputs()) {
+            seed = hashValue(seed, output.get_element_type().get_type_name());
+            const auto& shape = output.get_partial_shape();
+            if (shape.rank().is_static()) {
+                for (size_t i = 0; i < static_cast<size_t>(shape.rank().get_length()); ++i) {
+                    const auto& dim = shape[i];
+                    seed = hashValue(seed, dim.is_static() ? dim.get_length() : -1);
+                }
+            } else {
+                seed = hashValue(seed, std::string("dynamic"));
+            }
+        }
+
+        for (auto&& rtInfo : op->get_rt_info()) {
+            seed = hashValue(seed, rtInfo.first);
+            if (auto stringValue = std::dynamic_pointer_cast<ngraph::VariantWrapper<std::string>>(rtInfo.second)) {
+                seed = hashValue(seed, stringValue->get());
+            }
+        }
+
+        op->visit_attributes(visitor);
+    }
+
+    return seed;
+}
+
+Hash hashPreProcess(Hash seed, const PreProcessInfo& preProcess) {
+    seed = hashValue(seed, static_cast<int>(preProcess.getResizeAlgorithm()));
+    seed = hashValue(seed, preProcess.getLetterbox());
+    seed = hashValue(seed, preProcess.getPadValue());
+    seed = hashValue(seed, static_cast<int>(preProcess.getColorFormat()));
+    seed = hashValue(seed, static_cast<int>(preProcess.getMeanVariant()));
+
+    for (size_t c = 0; c < preProcess.getNumberOfChannels(); ++c) {
+        const auto& channel = preProcess[c];
+        seed = hashValue(seed, channel->meanValue);
+        seed = hashValue(seed, channel->stdScale);
+        if (auto meanData = as<MemoryBlob>(channel->meanData)) {
+            auto lockedMemory = meanData->rmap();
+            seed = hashBytes(seed, lockedMemory.as<const void*>(), meanData->byteSize());
+        }
+    }
+
+    return seed;
+}
+
+}  // namespace
+
+bool NetworkCompilationContext::isHashable(const CNNNetwork& network) {
+    return network.getFunction() != nullptr;
+}
+
+std::string NetworkCompilationContext::computeHash(const CNNNetwork& network,
+                                                   const std::string& deviceName,
+                                                   const Version& pluginVersion,
+                                                   const std::map<std::string, std::string>& compileOptions) {
+    OV_ITT_SCOPED_TASK(itt::domains::IE, "NetworkCompilationContext::computeHash");
+
+    if (!isHashable(network)) {
+        THROW_IE_EXCEPTION << "Cannot compute a hash for the network " << network.getName()
+                           << " which is not represented by ngraph::Function";
+    }
+
+    Hash seed = hashFunction(*network.getFunction());
+
+    for (auto&& input : network.getInputsInfo()) {
+        seed = hashValue(seed, input.first);
+        seed = hashValue(seed, std::string(input.second->getPrecision().name()));
+        seed = hashValue(seed, static_cast<int>(input.second->getLayout()));
+        seed = hashPreProcess(seed, input.second->getPreProcess());
+    }
+
+    for (auto&& output : network.getOutputsInfo()) {
+        seed = hashValue(seed, output.first);
+        seed = hashValue(seed, std::string(output.second->getPrecision().name()));
+        seed = hashValue(seed, static_cast<int>(output.second->getLayout()));
+    }
+
+    seed = hashValue(seed, deviceName);
+    seed = hashValue(seed, pluginVersion.apiVersion.major);
+    seed = hashValue(seed, pluginVersion.apiVersion.minor);
+    seed = hashValue(seed, std::string(pluginVersion.buildNumber ? pluginVersion.buildNumber : ""));
+    seed = hashValue(seed, std::string(pluginVersion.description ? pluginVersion.description : ""));
+
+    for (auto&& option : compileOptions) {
+        seed = hashValue(seed, option.first);
+        seed = hashValue(seed, option.second);
+    }
+
+    std::stringstream hash;
+    hash << std::hex << std::setw(2 * sizeof(Hash)) << std::setfill('0') << seed;
+    return hash.str();
+}
+
+}  // namespace InferenceEngine
@@ -0,0 +1,41 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cpp/ie_cnn_network.h>
+#include <ie_version.hpp>
+#include <map>
+#include <string>
+
+namespace InferenceEngine {
+
+/**
+ * @brief Computes keys for the compiled network cache enabled by the CONFIG_KEY(CACHE_DIR) option of Core
+ */
+struct NetworkCompilationContext {
+    /**
+     * @brief Checks whether a network can be identified by the computeHash method
+     * @param network A network to check
+     * @return true if the network is represented by ngraph::Function
+     */
+    static bool isHashable(const CNNNetwork& network);
+
+    /**
+     * @brief Computes a hash of everything which affects the result of the plugin's LoadNetwork:
+     *        network topology, operation attributes, constant values, inputs / outputs information,
+     *        device name, plugin version and compilation options
+     * @param network A network to compute hash for
+     * @param deviceName A device name without a device ID
+     * @param pluginVersion A version of the plugin which compiles the network
+     * @param compileOptions A full set of options the network is compiled with
+     * @return A hexadecimal string which can be used as a file name
+     */
+    static std::string computeHash(const CNNNetwork& network,
+                                   const std::string& deviceName,
+                                   const Version& pluginVersion,
+                                   const std::map<std::string, std::string>& compileOptions);
+};
+
+}  // namespace InferenceEngine
@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <cerrno>
 #include <cstring>
 #include <fstream>
 #include <string>
@@ -18,7 +19,9 @@
 # include <limits.h>
 # include <unistd.h>
 # include <dlfcn.h>
+# include <sys/stat.h>
 #else
+# include <direct.h>
 # if defined(WINAPI_FAMILY) && !WINAPI_PARTITION_DESKTOP
 #  error "Only WINAPI_PARTITION_DESKTOP is supported, because of GetModuleHandleEx[A|W]"
 # endif
@@ -36,6 +39,29 @@ long long FileUtils::fileSize(const char* charfilepath) {
     return in.tellg();
 }
 
+void FileUtils::createDirectoryRecursive(const std::string& dirPath) {
+    if (dirPath.empty()) {
+        return;
+    }
+
+    std::string::size_type pos = 0;
+    while (pos != std::string::npos) {
+        pos = dirPath.find_first_of("/\\", pos + 1);
+        const std::string path = dirPath.substr(0, pos);
+        if (path.empty() || path.back() == ':') {
+            continue;
+        }
+#ifdef _WIN32
+        int result = _mkdir(path.c_str());
+#else
+        int result = mkdir(path.c_str(), 0755);
+#endif
+        if (result != 0 && errno != EEXIST) {
+            THROW_IE_EXCEPTION << "Couldn't create directory [" << path << "], err=" << strerror(errno);
+        }
+    }
+}
+
 namespace InferenceEngine {
 
 namespace {
@@ -50,6 +50,11 @@ InferenceEngine::Blob::CPtr InferenceEngine::details::BlobStream::getBlob() {
     return blob;
 }
 
-InferenceEngine::details::BlobStream::BlobStream(const InferenceEngine::Blob::CPtr& blob): buffer(blob), std::ios(0), std::istream(&buffer), blob(blob) {}
+bool InferenceEngine::details::BlobStream::isShared() const {
+    return shared;
+}
+
+InferenceEngine::details::BlobStream::BlobStream(const InferenceEngine::Blob::CPtr& blob, bool shared):
+    buffer(blob), std::ios(0), std::istream(&buffer), blob(blob), shared(shared) {}
 
 InferenceEngine::details::BlobStream::~BlobStream() {}
@@ -9,6 +9,7 @@
 
 #include "ie_compound_blob.h"
 
+#include <algorithm>
 #include <initializer_list>
 #include <memory>
 #include <utility>
@@ -192,6 +193,49 @@ void verifyI420BlobInput(const Blob::Ptr& y, const Blob::Ptr& u, const Blob::Ptr
     }
 }
 
+void verifyBatchedBlobInput(const std::vector<Blob::Ptr>& blobs) {
+    if (blobs.empty()) {
+        THROW_IE_EXCEPTION << "Cannot create a batched blob from an empty vector of blobs";
+    }
+
+    const auto isImage = [](const Blob::Ptr& blob) {
+        return blob != nullptr && (blob->is<MemoryBlob>() || blob->is<NV12Blob>() || blob->is<I420Blob>());
+    };
+    if (!std::all_of(blobs.begin(), blobs.end(), isImage)) {
+        THROW_IE_EXCEPTION << "Batched blob items must be valid MemoryBlob, NV12Blob or I420Blob objects";
+    }
+
+    const auto& first = blobs.front();
+    const auto& firstDesc = first->getTensorDesc();
+    for (const auto& blob : blobs) {
+        if (blob->is<MemoryBlob>() != first->is<MemoryBlob>() || blob->is<NV12Blob>() != first->is<NV12Blob>()) {
+            THROW_IE_EXCEPTION << "Batched blob items must be of the same type";
+        }
+
+        const auto& desc = blob->getTensorDesc();
+        if (desc.getPrecision() != firstDesc.getPrecision()) {
+            THROW_IE_EXCEPTION << "Batched blob items have different precisions: " << desc.getPrecision()
+                               << " != " << firstDesc.getPrecision();
+        }
+        if (desc.getLayout() != firstDesc.getLayout()) {
+            THROW_IE_EXCEPTION << "Batched blob items have different layouts: " << desc.getLayout()
+                               << " != " << firstDesc.getLayout();
+        }
+
+        // memory blobs: one image per item, all images have the same number of channels
+        if (blob->is<MemoryBlob>()) {
+            const auto& dims = desc.getDims();
+            if (dims.size() != 4 || dims[0] != 1) {
+                THROW_IE_EXCEPTION << "Batched blob items must be 4D blobs with batch size 1";
+            }
+            if (dims[1] != firstDesc.getDims()[1]) {
+                THROW_IE_EXCEPTION << "Batched blob items have different number of channels: " << dims[1]
+                                   << " != " << firstDesc.getDims()[1];
+            }
+        }
+    }
+}
+
 }  // anonymous namespace
 
 CompoundBlob::CompoundBlob(): Blob(TensorDesc(Precision::UNSPECIFIED, {}, Layout::ANY)) {}
@@ -412,4 +456,46 @@ Blob::Ptr I420Blob::createROI(const ROI& roi) const {
     return std::make_shared<I420Blob>(yRoiBlob, uRoiBlob, vRoiBlob);
 }
 
+BatchedBlob::BatchedBlob(const std::vector<Blob::Ptr>& blobs) {
+    // verify data is correct
+    verifyBatchedBlobInput(blobs);
+    // set blobs
+    _blobs = blobs;
+    const auto& desc = _blobs.front()->getTensorDesc();
+    tensorDesc = TensorDesc(desc.getPrecision(), {}, desc.getLayout());
+}
+
+BatchedBlob::BatchedBlob(std::vector<Blob::Ptr>&& blobs) {
+    // verify data is correct
+    verifyBatchedBlobInput(blobs);
+    // set blobs
+    _blobs = std::move(blobs);
+    const auto& desc = _blobs.front()->getTensorDesc();
+    tensorDesc = TensorDesc(desc.getPrecision(), {}, desc.getLayout());
+}
+
+BatchedBlob::~BatchedBlob() {}
+
+Blob::Ptr BatchedBlob::createROI(const ROI& roi) const {
+    std::vector<Blob::Ptr> roiBlobs;
+    roiBlobs.reserve(_blobs.size());
+
+    for (const auto& blob : _blobs) {
+        roiBlobs.push_back(blob->createROI(roi));
+    }
+
+    return std::make_shared<BatchedBlob>(std::move(roiBlobs));
+}
+
+Blob::Ptr make_shared_blob(const Blob::Ptr& inputBlob, const std::vector<ROI>& rois) {
+    std::vector<Blob::Ptr> roiBlobs;
+    roiBlobs.reserve(rois.size());
+
+    for (const auto& roi : rois) {
+        roiBlobs.push_back(inputBlob->createROI(roi));
+    }
+
+    return std::make_shared<BatchedBlob>(std::move(roiBlobs));
+}
+
 }  // namespace InferenceEngine
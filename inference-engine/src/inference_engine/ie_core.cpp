@@ -2,27 +2,35 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <algorithm>
 #include <map>
 #include <memory>
 #include <string>
 #include <vector>
 #include <istream>
+#include <fstream>
 #include <mutex>
+#include <chrono>
+#include <cstdio>
+#include <thread>
 
 #include <ie_core.hpp>
 #include <multi-device/multi_device_config.hpp>
 #include <ngraph/opsets/opset.hpp>
 #include <ngraph/ngraph.hpp>
 #include <ngraph/graph_util.hpp>
+#include <ngraph/parallel.hpp>
 #include <ngraph/pass/constant_folding.hpp>
 
 #include <cpp_interfaces/exception2status.hpp>
 #include "ie_plugin_cpp.hpp"
 #include "ie_plugin_config.hpp"
+#include "ie_parallel.hpp"
 #include "ie_itt.hpp"
 #include "file_utils.h"
 #include "ie_network_reader.hpp"
 #include "xml_parse_utils.h"
+#include "compilation_context.hpp"
 
 using namespace InferenceEngine::PluginConfigParams;
 
@@ -175,6 +183,136 @@ class Core::Impl : public ICore {
     std::map<std::string, PluginDescriptor> pluginRegistry;
     mutable std::mutex pluginsMutex;  // to lock parallel access to pluginRegistry and plugins
 
+    struct CacheStatistics {
+        unsigned int hits = 0;
+        unsigned int misses = 0;
+        float hitLoadTime = 0.f;
+        float missLoadTime = 0.f;
+    };
+
+    // CONFIG_KEY(CACHE_DIR) values per device name, the empty device name holds a value for all devices
+    std::map<std::string, std::string> cacheDirs;
+    std::map<std::string, CacheStatistics> cacheStatistics;
+    mutable std::mutex cacheMutex;  // to lock parallel access to cacheDirs and cacheStatistics
+
+    /**
+     * @brief Extracts CONFIG_KEY(CACHE_DIR) from a LoadNetwork config or takes the one set via Core::SetConfig
+     * @param deviceName A device name without a device ID
+     * @param config A config passed to LoadNetwork, the CONFIG_KEY(CACHE_DIR) is removed from it
+     * @return A cache directory or an empty string if the cache is disabled
+     */
+    std::string ExtractCacheDir(const std::string& deviceName, std::map<std::string, std::string>& config) const {
+        auto it = config.find(CONFIG_KEY(CACHE_DIR));
+        if (it != config.end()) {
+            auto cacheDir = it->second;
+            config.erase(it);
+            return cacheDir;
+        }
+
+        std::lock_guard<std::mutex> lock(cacheMutex);
+        auto deviceIt = cacheDirs.find(deviceName);
+        if (deviceIt != cacheDirs.end()) {
+            return deviceIt->second;
+        }
+        auto globalIt = cacheDirs.find(std::string());
+        return globalIt != cacheDirs.end() ? globalIt->second : std::string();
+    }
+
+    static bool DeviceSupportsImportExport(const InferencePlugin& plugin) {
+        try {
+            std::vector<std::string> supportedMetricKeys = plugin.GetMetric(METRIC_KEY(SUPPORTED_METRICS), {});
+            auto it = std::find(supportedMetricKeys.begin(), supportedMetricKeys.end(),
+                                METRIC_KEY(IMPORT_EXPORT_SUPPORT));
+            return it != supportedMetricKeys.end() && plugin.GetMetric(METRIC_KEY(IMPORT_EXPORT_SUPPORT), {}).as<bool>();
+        } catch (const details::InferenceEngineException&) {
+            return false;
+        }
+    }
+
+    /**
+     * @brief Imports a network from the cache directory or compiles the network and stores it to the cache
+     */
+    ExecutableNetwork LoadNetworkWithCache(InferencePlugin& plugin, const CNNNetwork& network,
+                                           const std::string& deviceName, const std::string& cacheDir,
+                                           const std::map<std::string, std::string>& config) {
+        OV_ITT_SCOPED_TASK(itt::domains::IE, "Core::Impl::LoadNetworkWithCache");
+        auto start = std::chrono::steady_clock::now();
+        auto elapsedMs = [&start] () {
+            return std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - start).count();
+        };
+
+        std::map<std::string, std::string> compileOptions;
+        {
+            std::lock_guard<std::mutex> lock(pluginsMutex);
+            auto it = pluginRegistry.find(deviceName);
+            if (it != pluginRegistry.end()) {
+                compileOptions = it->second.defaultConfig;
+            }
+        }
+        for (auto&& option : config) {
+            compileOptions[option.first] = option.second;
+        }
+
+        const auto hash = NetworkCompilationContext::computeHash(network, deviceName, plugin.GetVersion(), compileOptions);
+        const auto blobFileName = FileUtils::makePath(cacheDir, hash + ".blob");
+
+        {
+            std::ifstream networkStream(blobFileName, std::ios::binary);
+            if (networkStream.is_open()) {
+                bool imported = false;
+                ExecutableNetwork executableNetwork;
+                try {
+                    executableNetwork = plugin.ImportNetwork(networkStream, config);
+                    imported = true;
+                } catch (const std::exception&) {
+                    // the blob is corrupted or was exported by an incompatible plugin, it is recompiled below
+                }
+                networkStream.close();
+
+                if (imported) {
+                    std::lock_guard<std::mutex> lock(cacheMutex);
+                    auto& statistics = cacheStatistics[deviceName];
+                    statistics.hits++;
+                    statistics.hitLoadTime += elapsedMs();
+                    return executableNetwork;
+                }
+                std::remove(blobFileName.c_str());
+            }
+        }
+
+        auto executableNetwork = plugin.LoadNetwork(network, config);
+
+        // export to a unique temporary file first, so concurrent loads never observe a partially written blob
+        const auto tmpFileName = blobFileName + "." +
+            std::to_string(std::hash<std::thread::id>()(std::this_thread::get_id())) + "." +
+            std::to_string(std::chrono::steady_clock::now().time_since_epoch().count()) + ".tmp";
+        try {
+            FileUtils::createDirectoryRecursive(cacheDir);
+            {
+                std::ofstream networkStream(tmpFileName, std::ios::binary);
+                if (!networkStream.is_open()) {
+                    THROW_IE_EXCEPTION << "Cannot open " << tmpFileName << " for writing";
+                }
+                executableNetwork.Export(networkStream);
+                if (!networkStream.good()) {
+                    THROW_IE_EXCEPTION << "Cannot write " << tmpFileName;
+                }
+            }
+            if (std::rename(tmpFileName.c_str(), blobFileName.c_str()) != 0) {
+                std::remove(tmpFileName.c_str());
+            }
+        } catch (const std::exception&) {
+            // caching is an optimization, so a failed export does not fail LoadNetwork
+            std::remove(tmpFileName.c_str());
+        }
+
+        std::lock_guard<std::mutex> lock(cacheMutex);
+        auto& statistics = cacheStatistics[deviceName];
+        statistics.misses++;
+        statistics.missLoadTime += elapsedMs();
+        return executableNetwork;
+    }
+
 public:
     Impl();
     ~Impl() override;
@@ -271,7 +409,12 @@ public:
                                   const std::map<std::string, std::string>& config) override {
         OV_ITT_SCOPED_TASK(itt::domains::IE, "Core::Impl::LoadNetwork");
         auto parsed = parseDeviceNameIntoConfig(deviceName, config);
-        return GetCPPPluginByName(parsed._deviceName).LoadNetwork(network, parsed._config);
+        auto cacheDir = ExtractCacheDir(parsed._deviceName, parsed._config);
+        auto plugin = GetCPPPluginByName(parsed._deviceName);
+        if (!cacheDir.empty() && NetworkCompilationContext::isHashable(network) && DeviceSupportsImportExport(plugin)) {
+            return LoadNetworkWithCache(plugin, network, parsed._deviceName, cacheDir, parsed._config);
+        }
+        return plugin.LoadNetwork(network, parsed._config);
     }
 
     ExecutableNetwork ImportNetwork(std::istream& networkModel, const std::string& deviceName,
@@ -338,6 +481,25 @@ public:
 
         auto parsed = parseDeviceNameIntoConfig(deviceName);
 
+        // compiled networks cache metrics are collected by Core itself
+        if (name == METRIC_KEY(NETWORK_CACHE_HITS) || name == METRIC_KEY(NETWORK_CACHE_MISSES) ||
+            name == METRIC_KEY(NETWORK_CACHE_HIT_LOAD_TIME) || name == METRIC_KEY(NETWORK_CACHE_MISS_LOAD_TIME)) {
+            std::lock_guard<std::mutex> lock(cacheMutex);
+            CacheStatistics statistics;
+            auto it = cacheStatistics.find(parsed._deviceName);
+            if (it != cacheStatistics.end()) {
+                statistics = it->second;
+            }
+            if (name == METRIC_KEY(NETWORK_CACHE_HITS)) {
+                return statistics.hits;
+            } else if (name == METRIC_KEY(NETWORK_CACHE_MISSES)) {
+                return statistics.misses;
+            } else if (name == METRIC_KEY(NETWORK_CACHE_HIT_LOAD_TIME)) {
+                return statistics.hitLoadTime;
+            }
+            return statistics.missLoadTime;
+        }
+
         // we need to return a copy of Parameter object which is created on Core side,
         // not in InferenceEngine plugin side, which can be unloaded from Core in a parallel thread
         // TODO: remove this WA after *-31417 is resolved
@@ -497,6 +659,26 @@ public:
         }
     }
 
+    /**
+     * @brief Sets CONFIG_KEY(CACHE_DIR) for a device or for all devices
+     * @param cacheDir A directory to store compiled networks to, an empty value disables caching
+     * @param deviceName A device name without a device ID, if empty, the directory is used for all devices
+     */
+    void SetCacheDir(const std::string& cacheDir, const std::string& deviceName) {
+        std::lock_guard<std::mutex> lock(cacheMutex);
+        cacheDirs[deviceName] = cacheDir;
+    }
+
+    /**
+     * @brief Returns CONFIG_KEY(CACHE_DIR) set for a device or for all devices
+     * @param deviceName A device name without a device ID
+     * @return A cache directory or an empty string if caching is disabled
+     */
+    std::string GetCacheDir(const std::string& deviceName) const {
+        std::map<std::string, std::string> emptyConfig;
+        return ExtractCacheDir(deviceName, emptyConfig);
+    }
+
     /**
      * @brief Registers the extension in a Core object
      *        Such extensions can be used for both CNNNetwork readers and device plugins
@@ -534,6 +716,11 @@ Core::Impl::Impl() {
     opsetNames.insert("opset2");
     opsetNames.insert("opset3");
     opsetNames.insert("opset4");
+
+    // Parallel ngraph passes, e.g. constant folding, use the threads of Inference Engine instead of their own
+    ngraph::set_parallel_executor([](size_t workers, const std::function<void(size_t)>& body) {
+        InferenceEngine::parallel_for(workers, body);
+    });
 }
 
 Core::Impl::~Impl() {}
@@ -726,10 +913,21 @@ void Core::SetConfig(const std::map<std::string, std::string>& config, const std
         }
     }
 
+    // CONFIG_KEY(CACHE_DIR) is handled by Core and is not passed to plugins
+    auto config_ = config;
+    auto cacheDirIt = config_.find(CONFIG_KEY(CACHE_DIR));
+    if (cacheDirIt != config_.end()) {
+        _impl->SetCacheDir(cacheDirIt->second, parseDeviceNameIntoConfig(deviceName)._deviceName);
+        config_.erase(cacheDirIt);
+        if (config_.empty()) {
+            return;
+        }
+    }
+
     if (deviceName.empty()) {
-        _impl->SetConfigForPlugins(config, std::string());
+        _impl->SetConfigForPlugins(config_, std::string());
     } else {
-        auto parsed = parseDeviceNameIntoConfig(deviceName, config);
+        auto parsed = parseDeviceNameIntoConfig(deviceName, config_);
         _impl->SetConfigForPlugins(parsed._config, parsed._deviceName);
     }
 }
@@ -754,6 +952,10 @@ Parameter Core::GetConfig(const std::string& deviceName, const std::string& name
 
     auto parsed = parseDeviceNameIntoConfig(deviceName);
 
+    if (name == CONFIG_KEY(CACHE_DIR)) {
+        return _impl->GetCacheDir(parsed._deviceName);
+    }
+
     // we need to return a copy of Parameter object which is created on Core side,
     // not in InferenceEngine plugin side, which can be unloaded from Core in a parallel thread
     // TODO: remove this WA after *-31417 is resolved
@@ -0,0 +1,136 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ie_mmap_blob.hpp"
+
+#include <memory>
+#include <string>
+
+#ifndef _WIN32
+# include <fcntl.h>
+# include <sys/mman.h>
+# include <sys/stat.h>
+# include <unistd.h>
+#else
+# ifndef NOMINMAX
+#  define NOMINMAX
+# endif
+# include <Windows.h>
+#endif
+
+#include "file_utils.h"
+
+namespace InferenceEngine {
+namespace details {
+
+namespace {
+
+/**
+ * @brief Holds a memory mapping of a file for the lifetime of a blob
+ */
+class MappedMemory {
+public:
+    MappedMemory() = default;
+    MappedMemory(const MappedMemory&) = delete;
+    MappedMemory& operator=(const MappedMemory&) = delete;
+
+    bool map(const std::string& path) {
+#ifndef _WIN32
+        int fd = open(path.c_str(), O_RDONLY);
+        if (fd == -1) {
+            return false;
+        }
+        struct stat sb = {};
+        if (fstat(fd, &sb) == -1 || sb.st_size <= 0) {
+            close(fd);
+            return false;
+        }
+        // private writable mapping: pages are shared until somebody writes to them
+        void* addr = mmap(nullptr, static_cast<size_t>(sb.st_size), PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+        close(fd);
+        if (addr == MAP_FAILED) {
+            return false;
+        }
+        _data = static_cast<uint8_t*>(addr);
+        _size = static_cast<size_t>(sb.st_size);
+#else
+#ifdef ENABLE_UNICODE_PATH_SUPPORT
+        HANDLE file = CreateFileW(FileUtils::multiByteCharToWString(path.c_str()).c_str(), GENERIC_READ,
+                                  FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+#else
+        HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                                  FILE_ATTRIBUTE_NORMAL, nullptr);
+#endif
+        if (file == INVALID_HANDLE_VALUE) {
+            return false;
+        }
+        LARGE_INTEGER fileSize = {};
+        if (!GetFileSizeEx(file, &fileSize) || fileSize.QuadPart <= 0) {
+            CloseHandle(file);
+            return false;
+        }
+        HANDLE mapping = CreateFileMapping(file, nullptr, PAGE_WRITECOPY, 0, 0, nullptr);
+        CloseHandle(file);
+        if (mapping == nullptr) {
+            return false;
+        }
+        void* addr = MapViewOfFile(mapping, FILE_MAP_COPY, 0, 0, 0);
+        CloseHandle(mapping);
+        if (addr == nullptr) {
+            return false;
+        }
+        _data = static_cast<uint8_t*>(addr);
+        _size = static_cast<size_t>(fileSize.QuadPart);
+#endif
+        return true;
+    }
+
+    ~MappedMemory() {
+        if (_data == nullptr) {
+            return;
+        }
+#ifndef _WIN32
+        munmap(_data, _size);
+#else
+        UnmapViewOfFile(_data);
+#endif
+    }
+
+    uint8_t* data() const {
+        return _data;
+    }
+
+    size_t size() const {
+        return _size;
+    }
+
+private:
+    uint8_t* _data = nullptr;
+    size_t _size = 0;
+};
+
+/**
+ * @brief Keeps a file mapping alive while the blob refers to it
+ */
+class MappedBlob : public TBlob<uint8_t> {
+    std::shared_ptr<MappedMemory> memory;
+
+public:
+    explicit MappedBlob(const std::shared_ptr<MappedMemory>& memory) :
+        TBlob<uint8_t>(TensorDesc(Precision::U8, {memory->size()}, Layout::C), memory->data(), memory->size()),
+        memory(memory) { }
+};
+
+}  // namespace
+
+Blob::CPtr mmapFile(const std::string& path) {
+    auto memory = std::make_shared<MappedMemory>();
+    if (!memory->map(path)) {
+        return nullptr;
+    }
+    return std::make_shared<MappedBlob>(memory);
+}
+
+}  // namespace details
+}  // namespace InferenceEngine
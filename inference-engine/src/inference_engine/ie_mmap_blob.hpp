@@ -0,0 +1,26 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ie_blob.h>
+#include <string>
+
+namespace InferenceEngine {
+namespace details {
+
+/**
+ * @brief Maps a file into memory and wraps the mapping into a U8 blob.
+ *
+ * Pages are mapped copy-on-write, so several processes reading the same file share one
+ * page cache copy, while writes to the blob memory never reach the file. The mapping is
+ * released when the last reference to the blob is gone.
+ *
+ * @param path A path to a file to map
+ * @return A blob over the mapped memory or nullptr if the file cannot be mapped (e.g. it is empty)
+ */
+Blob::CPtr mmapFile(const std::string& path);
+
+}  // namespace details
+}  // namespace InferenceEngine
@@ -4,6 +4,7 @@
 
 #include "ie_network_reader.hpp"
 #include "ie_itt.hpp"
+#include "ie_mmap_blob.hpp"
 
 #include <details/ie_so_pointer.hpp>
 #include <file_utils.h>
@@ -195,6 +196,14 @@ CNNNetwork details::ReadNetwork(const std::string& modelPath, const std::string&
                 }
             }
             if (!bPath.empty()) {
+                // Map weights file into memory, so readers can refer to the data instead of copying it
+                if (auto weights = details::mmapFile(bPath)) {
+                    details::BlobStream binStream(weights, true);
+                    auto network = reader->read(modelStream, binStream, exts);
+                    modelStream.close();
+                    return network;
+                }
+
                 // Open weights file
 #if defined(ENABLE_UNICODE_PATH_SUPPORT) && defined(_WIN32)
                 std::wstring weights_path = FileUtils::multiByteCharToWString(bPath.c_str());
@@ -5,6 +5,8 @@
 #include <string>
 #include <vector>
 #include <memory>
+#include <algorithm>
+#include <iterator>
 #include <mutex>
 #include <condition_variable>
 #include <thread>
@@ -12,6 +14,7 @@
 #include <atomic>
 #include <climits>
 #include <cassert>
+#include <cstdint>
 #include <utility>
 
 #include "threading/ie_thread_local.hpp"
@@ -25,6 +28,81 @@
 using namespace openvino;
 
 namespace InferenceEngine {
+namespace {
+/**
+ * @brief Bounded lock-free multi-producer multi-consumer queue (D. Vyukov).
+ *        Tasks are pushed by any thread and popped by the stream worker which owns the queue
+ *        or stolen by other idle workers
+ */
+class TaskQueue {
+public:
+    explicit TaskQueue(std::size_t capacity) :
+        _cells{new Cell[capacity]},
+        _mask{capacity - 1} {
+        assert((capacity & _mask) == 0 && "capacity should be a power of two");
+        for (std::size_t i = 0; i < capacity; ++i) {
+            _cells[i]._sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    bool TryPush(Task& task) {
+        auto pos = _pushPos._value.load(std::memory_order_relaxed);
+        for (;;) {
+            auto& cell = _cells[pos & _mask];
+            auto sequence = cell._sequence.load(std::memory_order_acquire);
+            auto diff = static_cast<std::intptr_t>(sequence) - static_cast<std::intptr_t>(pos);
+            if (0 == diff) {
+                if (_pushPos._value.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    cell._task = std::move(task);
+                    cell._sequence.store(pos + 1, std::memory_order_release);
+                    return true;
+                }
+            } else if (diff < 0) {
+                return false;
+            } else {
+                pos = _pushPos._value.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    bool TryPop(Task& task) {
+        auto pos = _popPos._value.load(std::memory_order_relaxed);
+        for (;;) {
+            auto& cell = _cells[pos & _mask];
+            auto sequence = cell._sequence.load(std::memory_order_acquire);
+            auto diff = static_cast<std::intptr_t>(sequence) - static_cast<std::intptr_t>(pos + 1);
+            if (0 == diff) {
+                if (_popPos._value.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    task = std::move(cell._task);
+                    cell._task = nullptr;
+                    cell._sequence.store(pos + _mask + 1, std::memory_order_release);
+                    return true;
+                }
+            } else if (diff < 0) {
+                return false;
+            } else {
+                pos = _popPos._value.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+private:
+    struct Cell {
+        std::atomic<std::size_t>    _sequence;
+        Task                        _task;
+    };
+    // Keeps producers' and consumers' positions in different cache lines
+    struct Position {
+        std::atomic<std::size_t>    _value = {0};
+        char                        _padding[64 - sizeof(std::atomic<std::size_t>)];
+    };
+    std::unique_ptr<Cell[]>     _cells;
+    std::size_t                 _mask = 0;
+    Position                    _pushPos;
+    Position                    _popPos;
+};
+}  // namespace
+
 struct CPUStreamsExecutor::Impl {
     struct Stream {
 #if IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO
@@ -55,9 +133,15 @@ struct CPUStreamsExecutor::Impl {
             ~Observer() override = default;
         };
 #endif
-        explicit Stream(Impl* impl) :
-            _impl(impl) {
-            {
+        /**
+         * @param streamId An index of the stream worker the stream is created for.
+         *        Streams of other threads take an id which is not used by workers.
+         */
+        explicit Stream(Impl* impl, int streamId = -1) :
+            _impl(impl),
+            _streamId(streamId),
+            _isWorker(streamId >= 0) {
+            if (!_isWorker) {
                 std::lock_guard<std::mutex> lock{_impl->_streamIdMutex};
                 if (_impl->_streamIdQueue.empty()) {
                     _streamId = _impl->_streamId++;
@@ -66,11 +150,7 @@ struct CPUStreamsExecutor::Impl {
                     _impl->_streamIdQueue.pop();
                 }
             }
-            _numaNodeId = _impl->_config._streams
-                ? _impl->_usedNumaNodes.at(
-                    (_streamId % _impl->_config._streams)/
-                    ((_impl->_config._streams + _impl->_usedNumaNodes.size() - 1)/_impl->_usedNumaNodes.size()))
-                : _impl->_usedNumaNodes.at(_streamId % _impl->_usedNumaNodes.size());
+            _numaNodeId = _impl->GetNumaNodeId(_streamId);
 #if IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO
             auto concurrency = (0 == _impl->_config._threadsPerStream) ? tbb::task_arena::automatic : _impl->_config._threadsPerStream;
             if (ThreadBindingType::NUMA == _impl->_config._threadBindingType) {
@@ -124,7 +204,7 @@ struct CPUStreamsExecutor::Impl {
 #endif
         }
         ~Stream() {
-            {
+            if (!_isWorker) {
                 std::lock_guard<std::mutex> lock{_impl->_streamIdMutex};
                 _impl->_streamIdQueue.push(_streamId);
             }
@@ -137,6 +217,7 @@ struct CPUStreamsExecutor::Impl {
 
         Impl* _impl     = nullptr;
         int _streamId   = 0;
+        bool _isWorker  = false;
         int _numaNodeId = 0;
         bool _execute = false;
         std::queue<Task> _taskQueue;
@@ -146,11 +227,24 @@ struct CPUStreamsExecutor::Impl {
 #endif
     };
 
+    /**
+     * @brief Queues of stream workers pinned to the same NUMA node.
+     *        Idle workers steal tasks from queues of other workers of the group and sleep when all of them are empty
+     */
+    struct NumaNodeGroup {
+        std::vector<int>            _streamIds;
+        std::mutex                  _mutex;
+        std::condition_variable     _queueCondVar;
+        std::atomic<int>            _sleepingWorkers = {0};
+        int                         _wakeUps = 0;
+    };
+
+    static constexpr std::size_t taskQueueCapacity = 1024;
+
     explicit Impl(const Config& config) :
         _config{config},
-        _streams([this] {
-            return std::make_shared<Impl::Stream>(this);
-        }) {
+        // ids of stream workers are reserved, so streams of other threads do not get the same NUMA node groups
+        _streamId{config._streams} {
         auto numaNodes = getAvailableNUMANodes();
         if (_config._streams != 0) {
             std::copy_n(std::begin(numaNodes),
@@ -159,33 +253,133 @@ struct CPUStreamsExecutor::Impl {
         } else {
             _usedNumaNodes = numaNodes;
         }
+        for (auto streamId = 0; streamId < _config._streams; ++streamId) {
+            _taskQueues.emplace_back(new TaskQueue{taskQueueCapacity});
+            auto numaNodeId = GetNumaNodeId(streamId);
+            auto itGroup = std::find_if(_numaNodeGroups.begin(), _numaNodeGroups.end(),
+                [&] (const std::unique_ptr<NumaNodeGroup>& group) {
+                    return GetNumaNodeId(group->_streamIds.front()) == numaNodeId;
+                });
+            if (itGroup == _numaNodeGroups.end()) {
+                _numaNodeGroups.emplace_back(new NumaNodeGroup);
+                itGroup = std::prev(_numaNodeGroups.end());
+            }
+            (*itGroup)->_streamIds.push_back(streamId);
+            _streamGroups.push_back(itGroup->get());
+            _allStreamIds.push_back(streamId);
+        }
         for (auto streamId = 0; streamId < _config._streams; ++streamId) {
             _threads.emplace_back([this, streamId] {
                 openvino::itt::threadName(_config._name + "_" + std::to_string(streamId));
-                for (bool stopped = false; !stopped;) {
+                // The stream of the worker gets the id of its queue, so the worker is pinned to the NUMA node
+                // of the group it steals tasks in
+                auto& stream = _streams.local();
+                stream = std::make_shared<Impl::Stream>(this, streamId);
+                auto& group = *_streamGroups[streamId];
+                for (;;) {
                     Task task;
-                    {
-                        std::unique_lock<std::mutex> lock(_mutex);
-                        _queueCondVar.wait(lock, [&] { return !_taskQueue.empty() || (stopped = _isStopped); });
-                        if (!_taskQueue.empty()) {
-                            task = std::move(_taskQueue.front());
-                            _taskQueue.pop();
+                    if (!Pop(streamId, task)) {
+                        std::unique_lock<std::mutex> lock(group._mutex);
+                        ++group._sleepingWorkers;
+                        std::atomic_thread_fence(std::memory_order_seq_cst);
+                        // Check the queues again as a task could be pushed before the worker was counted as sleeping
+                        if (Pop(streamId, task)) {
+                            --group._sleepingWorkers;
+                        } else if (_isStopped) {
+                            --group._sleepingWorkers;
+                            break;
+                        } else {
+                            // A producer which wakes the worker up removes it from sleeping ones
+                            group._queueCondVar.wait(lock, [&] { return group._wakeUps > 0 || _isStopped; });
+                            if (group._wakeUps > 0) {
+                                --group._wakeUps;
+                            } else {
+                                --group._sleepingWorkers;
+                            }
+                            continue;
                         }
                     }
                     if (task) {
-                        Execute(task, *(_streams.local()));
+                        Execute(task, *stream);
                     }
                 }
             });
         }
     }
 
+    int GetNumaNodeId(int streamId) const {
+        return _config._streams
+            ? _usedNumaNodes.at(
+                (streamId % _config._streams)/
+                ((_config._streams + _usedNumaNodes.size() - 1)/_usedNumaNodes.size()))
+            : _usedNumaNodes.at(streamId % _usedNumaNodes.size());
+    }
+
+    /**
+     * @brief Pops a task from the own queue of the stream worker, steals it from other workers on the same NUMA node
+     *        or takes it from the overflow queue. After the executor is stopped queues of all workers are drained.
+     */
+    bool Pop(int streamId, Task& task) {
+        if (_taskQueues[streamId]->TryPop(task)) {
+            return true;
+        }
+        const auto& streamIds = _isStopped ? _allStreamIds : _streamGroups[streamId]->_streamIds;
+        for (auto victimId : streamIds) {
+            if (victimId != streamId && _taskQueues[victimId]->TryPop(task)) {
+                return true;
+            }
+        }
+        if (0 != _overflowSize.load(std::memory_order_acquire)) {
+            std::lock_guard<std::mutex> lock(_mutex);
+            if (!_taskQueue.empty()) {
+                task = std::move(_taskQueue.front());
+                _taskQueue.pop();
+                --_overflowSize;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void Notify(NumaNodeGroup& group) {
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (0 != group._sleepingWorkers.load()) {
+            std::lock_guard<std::mutex> lock(group._mutex);
+            if (0 != group._sleepingWorkers) {
+                --group._sleepingWorkers;
+                ++group._wakeUps;
+                group._queueCondVar.notify_one();
+            }
+        }
+    }
+
     void Enqueue(Task task) {
+        const auto streams = static_cast<unsigned int>(_config._streams);
+        const auto firstStreamId = _nextStreamId.fetch_add(1, std::memory_order_relaxed) % streams;
+        for (unsigned int i = 0; i < streams; ++i) {
+            auto streamId = (firstStreamId + i) % streams;
+            if (_taskQueues[streamId]->TryPush(task)) {
+                Notify(*_streamGroups[streamId]);
+                return;
+            }
+        }
+        // All queues are full, so the task is stored in the unbounded queue any worker checks
         {
             std::lock_guard<std::mutex> lock(_mutex);
             _taskQueue.emplace(std::move(task));
+            ++_overflowSize;
+        }
+        for (auto&& group : _numaNodeGroups) {
+            Notify(*group);
+        }
+    }
+
+    void Stop() {
+        _isStopped = true;
+        for (auto&& group : _numaNodeGroups) {
+            std::lock_guard<std::mutex> lock(group->_mutex);
+            group->_queueCondVar.notify_all();
         }
-        _queueCondVar.notify_one();
     }
 
     void Execute(const Task& task, Stream& stream) {
@@ -201,8 +395,16 @@ struct CPUStreamsExecutor::Impl {
 #endif
     }
 
+    Stream& GetStream() {
+        auto& stream = _streams.local();
+        if (nullptr == stream) {
+            stream = std::make_shared<Impl::Stream>(this);
+        }
+        return *stream;
+    }
+
     void Defer(Task task) {
-        auto& stream = *(_streams.local());
+        auto& stream = GetStream();
         stream._taskQueue.push(std::move(task));
         if (!stream._execute) {
             stream._execute = true;
@@ -221,23 +423,26 @@ struct CPUStreamsExecutor::Impl {
     int                                     _streamId = 0;
     std::queue<int>                         _streamIdQueue;
     std::vector<std::thread>                _threads;
+    std::vector<std::unique_ptr<TaskQueue>> _taskQueues;
+    std::vector<std::unique_ptr<NumaNodeGroup>> _numaNodeGroups;
+    std::vector<NumaNodeGroup*>             _streamGroups;
+    std::vector<int>                        _allStreamIds;
+    std::atomic<unsigned int>               _nextStreamId = {0};
     std::mutex                              _mutex;
-    std::condition_variable                 _queueCondVar;
     std::queue<Task>                        _taskQueue;
-    bool                                    _isStopped = false;
+    std::atomic<std::size_t>                _overflowSize = {0};
+    std::atomic<bool>                       _isStopped = {false};
     std::vector<int>                        _usedNumaNodes;
     ThreadLocal<std::shared_ptr<Stream>>    _streams;
 };
 
 
 int CPUStreamsExecutor::GetStreamId() {
-    auto stream = _impl->_streams.local();
-    return stream->_streamId;
+    return _impl->GetStream()._streamId;
 }
 
 int CPUStreamsExecutor::GetNumaNodeId() {
-    auto stream = _impl->_streams.local();
-    return stream->_numaNodeId;
+    return _impl->GetStream()._numaNodeId;
 }
 
 CPUStreamsExecutor::CPUStreamsExecutor(const IStreamsExecutor::Config& config) :
@@ -245,11 +450,7 @@ CPUStreamsExecutor::CPUStreamsExecutor(const IStreamsExecutor::Config& config) :
 }
 
 CPUStreamsExecutor::~CPUStreamsExecutor() {
-    {
-        std::lock_guard<std::mutex> lock(_impl->_mutex);
-        _impl->_isStopped = true;
-    }
-    _impl->_queueCondVar.notify_all();
+    _impl->Stop();
     for (auto& thread : _impl->_threads) {
         if (thread.joinable()) {
             thread.join();
@@ -6,6 +6,7 @@
 
 #include <map>
 #include <memory>
+#include <ostream>
 #include <string>
 #include <vector>
 
@@ -127,6 +128,9 @@ public:
     StatusCode serialize(const std::string& xmlPath, const std::string& binPath, ResponseDesc* resp) const
         noexcept override;
 
+    // for internal usage (e.g. plugins which export a compiled network as IR)
+    StatusCode serialize(std::ostream& xmlStream, std::ostream& binStream, ResponseDesc* resp) const noexcept;
+
 protected:
     std::map<std::string, DataPtr> _data;
     std::map<std::string, CNNLayerPtr> _layers;
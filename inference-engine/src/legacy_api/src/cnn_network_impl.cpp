@@ -403,6 +403,20 @@ StatusCode CNNNetworkImpl::serialize(const std::string& xmlPath, const std::stri
     return DescriptionBuffer(NOT_IMPLEMENTED, resp) << "The CNNNetworkImpl::serialize is not implemented";
 }
 
+StatusCode CNNNetworkImpl::serialize(std::ostream& xmlStream, std::ostream& binStream, ResponseDesc* resp) const
+    noexcept {
+    try {
+        Serialization::Serialize(xmlStream, binStream, (InferenceEngine::ICNNNetwork&)*this);
+    } catch (const InferenceEngineException& e) {
+        return DescriptionBuffer(GENERAL_ERROR, resp) << e.what();
+    } catch (const std::exception& e) {
+        return DescriptionBuffer(UNEXPECTED, resp) << e.what();
+    } catch (...) {
+        return DescriptionBuffer(UNEXPECTED, resp);
+    }
+    return OK;
+}
+
 StatusCode CNNNetworkImpl::setBatchSize(size_t size, ResponseDesc* responseDesc) noexcept {
     try {
         auto originalBatchSize = getBatchSize();
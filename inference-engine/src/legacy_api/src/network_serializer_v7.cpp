@@ -378,7 +378,8 @@ std::vector<CNNLayerPtr> TopologicalSort(const ICNNNetwork& network) {
 }
 
 std::size_t FillXmlDoc(const InferenceEngine::ICNNNetwork& network, pugi::xml_document& doc,
-                       const bool execGraphInfoSerialization, const bool dumpWeights) {
+                       const bool execGraphInfoSerialization, const bool dumpWeights,
+                       const bool dumpPreProcInfo = false) {
     const std::vector<CNNLayerPtr> ordered = TopologicalSort(network);
     pugi::xml_node netXml = doc.append_child("net");
     netXml.append_attribute("name").set_value(network.getName().c_str());
@@ -497,6 +498,12 @@ std::size_t FillXmlDoc(const InferenceEngine::ICNNNetwork& network, pugi::xml_do
         }
     }
 
+    // Only the stream serialization used to export compiled networks restores mean data on read,
+    // the file based Serialize() output is kept as is
+    if (dumpWeights && dumpPreProcInfo) {
+        dataOffset = updatePreProcInfo(network, netXml, dataOffset);
+    }
+
     return dataOffset;
 }
 
@@ -584,5 +591,18 @@ void Serialize(const std::string& xmlPath, const std::string& binPath,
         }
     }
 }
+
+void Serialize(std::ostream& xmlStream, std::ostream& binStream,
+               const InferenceEngine::ICNNNetwork& network) {
+    pugi::xml_document doc;
+    FillXmlDoc(network, doc, false, true, true);
+    doc.save(xmlStream, nullptr, pugi::format_raw);
+    xmlStream << std::endl;
+    if (!xmlStream.good()) {
+        THROW_IE_EXCEPTION << "Error during writing IR xml content";
+    }
+
+    SerializeBlobs(binStream, network);
+}
 }  //  namespace Serialization
 }  //  namespace InferenceEngine
\ No newline at end of file
@@ -57,6 +57,42 @@ void Config::readProperties(const std::map<std::string, std::string> &prop) {
             // zero and any negative value will be treated
             // as default batch size
             batchLimit = std::max(val_i, 0);
+        } else if (key == PluginConfigParams::KEY_CPU_DYNAMIC_SHAPES_CACHE_SIZE) {
+            int val_i = -1;
+            try {
+                val_i = std::stoi(val);
+            } catch (const std::exception&) {
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_DYNAMIC_SHAPES_CACHE_SIZE
+                                   << ". Expected only non negative integer numbers";
+            }
+            if (val_i < 0)
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_DYNAMIC_SHAPES_CACHE_SIZE
+                                   << ". Expected only non negative integer numbers";
+            dynamicShapesCacheSize = val_i;
+        } else if (key == PluginConfigParams::KEY_CPU_REQUESTS_BATCH_SIZE) {
+            int val_i = -1;
+            try {
+                val_i = std::stoi(val);
+            } catch (const std::exception&) {
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_REQUESTS_BATCH_SIZE
+                                   << ". Expected only non negative integer numbers";
+            }
+            if (val_i < 0)
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_REQUESTS_BATCH_SIZE
+                                   << ". Expected only non negative integer numbers";
+            requestsBatchSize = val_i;
+        } else if (key == PluginConfigParams::KEY_CPU_REQUESTS_BATCH_TIMEOUT) {
+            int val_i = -1;
+            try {
+                val_i = std::stoi(val);
+            } catch (const std::exception&) {
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_REQUESTS_BATCH_TIMEOUT
+                                   << ". Expected only non negative integer numbers";
+            }
+            if (val_i < 0)
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_REQUESTS_BATCH_TIMEOUT
+                                   << ". Expected only non negative integer numbers";
+            requestsBatchTimeout = val_i;
         } else if (key == PluginConfigParams::KEY_PERF_COUNT) {
             if (val == PluginConfigParams::YES) collectPerfCounters = true;
             else if (val == PluginConfigParams::NO) collectPerfCounters = false;
@@ -77,6 +113,18 @@ void Config::readProperties(const std::map<std::string, std::string> &prop) {
             else
                 THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_DYN_BATCH_ENABLED
                 << ". Expected only YES/NO";
+        } else if (key == PluginConfigParams::KEY_CPU_INTER_OP_PARALLELISM) {
+            if (val == PluginConfigParams::YES) interOpParallelism = true;
+            else if (val == PluginConfigParams::NO) interOpParallelism = false;
+            else
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_INTER_OP_PARALLELISM
+                                   << ". Expected only YES/NO";
+        } else if (key == PluginConfigParams::KEY_CPU_WEIGHTS_SHARING) {
+            if (val == PluginConfigParams::YES) weightsSharing = true;
+            else if (val == PluginConfigParams::NO) weightsSharing = false;
+            else
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigParams::KEY_CPU_WEIGHTS_SHARING
+                                   << ". Expected only YES/NO";
         } else if (key.compare(PluginConfigParams::KEY_DUMP_EXEC_GRAPH_AS_DOT) == 0) {
             // empty string means that dumping is switched off
             dumpToDot = val;
@@ -139,7 +187,20 @@ void Config::updateProperties() {
         else
             _config.insert({ PluginConfigParams::KEY_DYN_BATCH_ENABLED, PluginConfigParams::NO });
 
+        if (interOpParallelism == true)
+            _config.insert({ PluginConfigParams::KEY_CPU_INTER_OP_PARALLELISM, PluginConfigParams::YES });
+        else
+            _config.insert({ PluginConfigParams::KEY_CPU_INTER_OP_PARALLELISM, PluginConfigParams::NO });
+
+        if (weightsSharing == true)
+            _config.insert({ PluginConfigParams::KEY_CPU_WEIGHTS_SHARING, PluginConfigParams::YES });
+        else
+            _config.insert({ PluginConfigParams::KEY_CPU_WEIGHTS_SHARING, PluginConfigParams::NO });
+
         _config.insert({ PluginConfigParams::KEY_DYN_BATCH_LIMIT, std::to_string(batchLimit) });
+        _config.insert({ PluginConfigParams::KEY_CPU_DYNAMIC_SHAPES_CACHE_SIZE, std::to_string(dynamicShapesCacheSize) });
+        _config.insert({ PluginConfigParams::KEY_CPU_REQUESTS_BATCH_SIZE, std::to_string(requestsBatchSize) });
+        _config.insert({ PluginConfigParams::KEY_CPU_REQUESTS_BATCH_TIMEOUT, std::to_string(requestsBatchTimeout) });
         _config.insert({ PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS, std::to_string(streamExecutorConfig._streams) });
         _config.insert({ PluginConfigParams::KEY_CPU_THREADS_NUM, std::to_string(streamExecutorConfig._threads) });
         _config.insert({ PluginConfigParams::KEY_DUMP_EXEC_GRAPH_AS_DOT, dumpToDot });
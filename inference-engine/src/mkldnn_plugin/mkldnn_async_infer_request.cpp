@@ -3,12 +3,42 @@
 //
 
 #include "mkldnn_async_infer_request.h"
+#include "mkldnn_batching_infer_request.h"
 #include <memory>
 
+namespace {
+/**
+ * Passes the rest of the request pipeline to the batcher which runs it after the batch is inferred
+ */
+class RequestsBatcherExecutor : public InferenceEngine::ITaskExecutor {
+public:
+    RequestsBatcherExecutor(const MKLDNNPlugin::MKLDNNRequestsBatcher::Ptr& requestsBatcher,
+                            MKLDNNPlugin::MKLDNNBatchingInferRequest* request) :
+        _requestsBatcher{requestsBatcher},
+        _request{request} {}
+
+    void run(InferenceEngine::Task task) override {
+        _requestsBatcher->Enqueue(_request, std::move(task));
+    }
+
+private:
+    MKLDNNPlugin::MKLDNNRequestsBatcher::Ptr    _requestsBatcher;
+    MKLDNNPlugin::MKLDNNBatchingInferRequest*   _request;
+};
+}  // namespace
+
 MKLDNNPlugin::MKLDNNAsyncInferRequest::MKLDNNAsyncInferRequest(const InferenceEngine::InferRequestInternal::Ptr& inferRequest,
                                                                const InferenceEngine::ITaskExecutor::Ptr& taskExecutor,
-                                                               const InferenceEngine::ITaskExecutor::Ptr& callbackExecutor)
-        : InferenceEngine::AsyncInferRequestThreadSafeDefault(inferRequest, taskExecutor, callbackExecutor) {}
+                                                               const InferenceEngine::ITaskExecutor::Ptr& callbackExecutor,
+                                                               const MKLDNNRequestsBatcher::Ptr& requestsBatcher)
+        : InferenceEngine::AsyncInferRequestThreadSafeDefault(inferRequest, taskExecutor, callbackExecutor) {
+    if (nullptr != requestsBatcher) {
+        auto batchingRequest = std::dynamic_pointer_cast<MKLDNNBatchingInferRequest>(inferRequest);
+        IE_ASSERT(nullptr != batchingRequest);
+        _pipeline = {{std::make_shared<RequestsBatcherExecutor>(requestsBatcher, batchingRequest.get()),
+                      [batchingRequest] { batchingRequest->CheckInferResult(); }}};
+    }
+}
 
 void MKLDNNPlugin::MKLDNNAsyncInferRequest::Infer_ThreadUnsafe() {
     InferUsingAsync();
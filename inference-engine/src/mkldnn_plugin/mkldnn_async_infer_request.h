@@ -8,14 +8,19 @@
 #include <map>
 #include <cpp_interfaces/impl/ie_infer_async_request_thread_safe_default.hpp>
 #include "mkldnn_infer_request.h"
+#include "mkldnn_requests_batcher.h"
 
 namespace MKLDNNPlugin {
 
 class MKLDNNAsyncInferRequest : public InferenceEngine::AsyncInferRequestThreadSafeDefault {
 public:
+    /**
+     * @param requestsBatcher If it is set the request is queued to be executed in a batch with other requests
+     */
     MKLDNNAsyncInferRequest(const InferenceEngine::InferRequestInternal::Ptr &inferRequest,
                             const InferenceEngine::ITaskExecutor::Ptr &taskExecutor,
-                            const InferenceEngine::ITaskExecutor::Ptr &callbackExecutor);
+                            const InferenceEngine::ITaskExecutor::Ptr &callbackExecutor,
+                            const MKLDNNRequestsBatcher::Ptr &requestsBatcher = nullptr);
 
     void Infer_ThreadUnsafe() override;
 
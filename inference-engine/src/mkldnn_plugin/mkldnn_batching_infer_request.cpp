@@ -0,0 +1,53 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mkldnn_batching_infer_request.h"
+#include "mkldnn_exec_network.h"
+#include "mkldnn_requests_batcher.h"
+
+#include <blob_factory.hpp>
+
+#include <future>
+
+using namespace MKLDNNPlugin;
+using namespace InferenceEngine;
+
+MKLDNNBatchingInferRequest::MKLDNNBatchingInferRequest(InputsDataMap         networkInputs,
+                                                       OutputsDataMap        networkOutputs,
+                                                       MKLDNNExecNetwork::Ptr execNetwork_)
+: InferRequestInternal(networkInputs, networkOutputs)
+, execNetwork(execNetwork_) {
+    for (const auto& input : _networkInputs) {
+        auto& blob = _inputs[input.first];
+        blob = make_blob_with_precision(input.second->getTensorDesc());
+        blob->allocate();
+    }
+    for (const auto& output : _networkOutputs) {
+        auto& blob = _outputs[output.first];
+        blob = make_blob_with_precision(output.second->getTensorDesc());
+        blob->allocate();
+    }
+}
+
+void MKLDNNBatchingInferRequest::InferImpl() {
+    std::promise<void> inferred;
+    execNetwork->GetRequestsBatcher()->Enqueue(this, [&] { inferred.set_value(); });
+    inferred.get_future().wait();
+    CheckInferResult();
+}
+
+void MKLDNNBatchingInferRequest::GetPerformanceCounts(std::map<std::string, InferenceEngineProfileInfo> &perfMap) const {
+    THROW_IE_EXCEPTION << NOT_IMPLEMENTED_str << "Performance counters are not collected for requests executed in batches";
+}
+
+const BlobMap& MKLDNNBatchingInferRequest::PreprocessInputs() {
+    execDataPreprocessing(_inputs);
+    return _inputs;
+}
+
+void MKLDNNBatchingInferRequest::CheckInferResult() const {
+    if (nullptr != _inferException) {
+        std::rethrow_exception(_inferException);
+    }
+}
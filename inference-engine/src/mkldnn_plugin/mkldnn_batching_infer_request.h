@@ -0,0 +1,62 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cpp_interfaces/impl/ie_infer_request_internal.hpp>
+
+#include <exception>
+#include <map>
+#include <memory>
+#include <string>
+
+namespace MKLDNNPlugin {
+
+class MKLDNNExecNetwork;
+
+/**
+ * Infer request of batch 1 which is executed by MKLDNNRequestsBatcher together with other requests.
+ * It only keeps blobs while inference is done by batched requests of the executable network.
+ */
+class MKLDNNBatchingInferRequest : public InferenceEngine::InferRequestInternal {
+public:
+    typedef std::shared_ptr<MKLDNNBatchingInferRequest> Ptr;
+
+    MKLDNNBatchingInferRequest(InferenceEngine::InputsDataMap      networkInputs,
+                               InferenceEngine::OutputsDataMap     networkOutputs,
+                               std::shared_ptr<MKLDNNExecNetwork>  execNetwork);
+
+    void InferImpl() override;
+
+    void GetPerformanceCounts(std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> &perfMap) const override;
+
+    /**
+     * @brief Runs pre-processing of inputs if it is required
+     * @return Input blobs to be copied to the batched request
+     */
+    const InferenceEngine::BlobMap& PreprocessInputs();
+
+    const InferenceEngine::BlobMap& GetOutputs() const {
+        return _outputs;
+    }
+
+    /**
+     * @brief Stores the result of the batch inference the request was executed in
+     * @param exception An exception thrown by the batch inference or nullptr if it succeeded
+     */
+    void SetInferResult(const std::exception_ptr &exception) {
+        _inferException = exception;
+    }
+
+    /**
+     * @brief Rethrows an exception of the last batch inference if any
+     */
+    void CheckInferResult() const;
+
+private:
+    std::shared_ptr<MKLDNNExecNetwork>  execNetwork;
+    std::exception_ptr                  _inferException;
+};
+
+}  // namespace MKLDNNPlugin
@@ -8,6 +8,7 @@
 #include "mkldnn_exec_network.h"
 
 #include "mkldnn_async_infer_request.h"
+#include "mkldnn_batching_infer_request.h"
 #include "mkldnn_infer_request.h"
 #include "mkldnn_memory_state.h"
 #include "mkldnn_itt.h"
@@ -24,7 +25,13 @@
 #include <threading/ie_cpu_streams_executor.hpp>
 #include <ie_system_conf.h>
 #include <threading/ie_thread_affinity.hpp>
+#include <xml_parse_utils.h>
 #include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <fstream>
+#include <future>
+#include <sstream>
 #include <unordered_set>
 #include <utility>
 
@@ -32,26 +39,15 @@ using namespace MKLDNNPlugin;
 using namespace InferenceEngine;
 using namespace InferenceEngine::details;
 
-InferenceEngine::InferRequestInternal::Ptr
-MKLDNNExecNetwork::CreateInferRequestImpl(InferenceEngine::InputsDataMap networkInputs,
-                                          InferenceEngine::OutputsDataMap networkOutputs) {
-    return std::make_shared<MKLDNNInferRequest>(networkInputs, networkOutputs, std::static_pointer_cast<MKLDNNExecNetwork>(shared_from_this()));
-}
-
-MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::ICNNNetwork &network,
-                                     const Config &cfg,
-                                     const MKLDNNExtensionManager::Ptr& extMgr,
-                                     NumaNodesWeights &numaNodesWeights) :
-    InferenceEngine::ExecutableNetworkThreadSafeDefault{nullptr, nullptr},
-    extensionManager(extMgr),
-    _cfg{cfg},
-    _name{network.getName()} {
-    OV_ITT_SCOPED_TASK(itt::domains::MKLDNNPlugin, "MKLDNNExecNetwork::MKLDNNExecNetwork");
+namespace {
+// Should be incremented each time the layout of the exported blob is changed
+constexpr unsigned int exportFormatVersion = 1;
 
+CNNNetworkImplPtr TransformNetwork(const ICNNNetwork &network, const Config &cfg) {
     // we are cloning network if we have statistics and we can transform network.
-    _clonedNetwork = cloneNet(network);
+    auto clonedNetwork = cloneNet(network);
 
-    if (_cfg.lpTransformsMode == Config::LPTransformsMode::On) {
+    if (cfg.lpTransformsMode == Config::LPTransformsMode::On) {
         auto params = LayerTransformation::Params(true,  // updatePrecisions
                                                     true,  // quantizeOutputs
                                                     true,  // weightsToConst
@@ -65,7 +61,7 @@ MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::ICNNNetwork &network
             addCleanup<ScaleShiftToConvolutionTransformation>(
                 LayerTransformation::Params(params).setPrecisionsOnActivations({ Precision::U8 }),
                 "ScaleShift"));
-        transformer.transform(*_clonedNetwork);
+        transformer.transform(*clonedNetwork);
 
         // Check if network is INT8 or Binary.
         // BF16 transformations were disabled since CPU plug-in doesn't support mixed precision execution:
@@ -82,7 +78,7 @@ MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::ICNNNetwork &network
 
         if (with_cpu_x86_bfloat16() && isFloatModel) {
             BF16Transformer bf16Transformer;
-            CNNNetwork cnnetwork(_clonedNetwork);
+            CNNNetwork cnnetwork(clonedNetwork);
             // If enforceBF16 flag was set, BF16 transformation applies for all layers supported by CPU plugin.
             // Overwise, only layers marked as BF16 in 'cnnetwork' will be performed in bfloat16 mode.
             // CPU plugin throws an exception, if marked as BF16 layers have not supported by CPU plugin.
@@ -90,13 +86,152 @@ MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::ICNNNetwork &network
                 bf16Transformer.convertToBFloat16(cnnetwork);
         } else {
             BF16Transformer bf16Transformer;
-            CNNNetwork cnnetwork(_clonedNetwork);
+            CNNNetwork cnnetwork(clonedNetwork);
             bf16Transformer.convertToFloat(cnnetwork);
         }
     }
 
-    MKLDNNGraph::ApplyUnrollPasses(static_cast<ICNNNetwork&>(*_clonedNetwork));
+    MKLDNNGraph::ApplyUnrollPasses(static_cast<ICNNNetwork&>(*clonedNetwork));
+
+    return clonedNetwork;
+}
+
+}  // namespace
+
+InferenceEngine::InferRequestInternal::Ptr
+MKLDNNExecNetwork::CreateInferRequestImpl(InferenceEngine::InputsDataMap networkInputs,
+                                          InferenceEngine::OutputsDataMap networkOutputs) {
+    if (IsRequestsBatchingEnabled()) {
+        return std::make_shared<MKLDNNBatchingInferRequest>(networkInputs, networkOutputs,
+                                                            std::static_pointer_cast<MKLDNNExecNetwork>(shared_from_this()));
+    }
+    return std::make_shared<MKLDNNInferRequest>(networkInputs, networkOutputs, std::static_pointer_cast<MKLDNNExecNetwork>(shared_from_this()));
+}
+
+MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::ICNNNetwork &network,
+                                     const Config &cfg,
+                                     const MKLDNNExtensionManager::Ptr& extMgr,
+                                     NumaNodesWeights &numaNodesWeights,
+                                     const ReshapeCallback &reshapeNetwork) :
+    InferenceEngine::ExecutableNetworkThreadSafeDefault{nullptr, nullptr},
+    extensionManager(extMgr),
+    _cfg{cfg},
+    _name{network.getName()},
+    _reshapeNetwork{reshapeNetwork},
+    _numaNodesWeights{numaNodesWeights, cfg.weightsSharing} {
+    OV_ITT_SCOPED_TASK(itt::domains::MKLDNNPlugin, "MKLDNNExecNetwork::MKLDNNExecNetwork");
+
+    _clonedNetwork = TransformNetwork(network, _cfg);
+
+    CreateGraphs();
+}
+
+MKLDNNExecNetwork::MKLDNNExecNetwork(std::istream &networkModel,
+                                     const Config &cfg,
+                                     const std::map<std::string, std::string> &config,
+                                     const MKLDNNExtensionManager::Ptr& extMgr,
+                                     NumaNodesWeights &numaNodesWeights,
+                                     ICore *core) :
+    InferenceEngine::ExecutableNetworkThreadSafeDefault{nullptr, nullptr},
+    extensionManager(extMgr),
+    _cfg{cfg} {
+    OV_ITT_SCOPED_TASK(itt::domains::MKLDNNPlugin, "MKLDNNExecNetwork::ImportNetwork");
+
+    std::string headerXmlStr;
+    std::getline(networkModel, headerXmlStr);
+
+    pugi::xml_document headerXmlDoc;
+    pugi::xml_parse_result res = headerXmlDoc.load_string(headerXmlStr.c_str());
+    if (res.status != pugi::status_ok) {
+        THROW_IE_EXCEPTION << "Error reading CPU plugin xml header";
+    }
+
+    using namespace XMLParseUtils;
+
+    pugi::xml_node cpuNode = headerXmlDoc.document_element();
+    auto blobVersion = GetUIntAttr(cpuNode, "version", 0);
+    if (blobVersion != exportFormatVersion) {
+        THROW_IE_EXCEPTION << "Unsupported CPU plugin blob version " << blobVersion
+                           << ". Expected version " << exportFormatVersion;
+    }
+
+    // Configuration stored in the blob is applied first, so the import config could override it
+    std::map<std::string, std::string> importedConfigs;
+    auto configsNode = cpuNode.child("configs");
+    for (auto configNode = configsNode.child("config"); !configNode.empty();
+            configNode = configNode.next_sibling("config")) {
+        importedConfigs.emplace(GetStrAttr(configNode, "key"), GetStrAttr(configNode, "value"));
+    }
+    _cfg.readProperties(importedConfigs);
+    _cfg.readProperties(config);
+    if (IsRequestsBatchingEnabled()) {
+        THROW_IE_EXCEPTION << NOT_IMPLEMENTED_str << "Requests batching is not supported for imported networks";
+    }
+
+    // read IR content of the already transformed network
+    std::string xmlString;
+    std::getline(networkModel, xmlString);
+    std::uint64_t dataSize = 0;
+    networkModel.read(reinterpret_cast<char*>(&dataSize), sizeof(dataSize));
+
+    Blob::Ptr dataBlob;
+    if (0 != dataSize) {
+        dataBlob = make_shared_blob<std::uint8_t>(
+            TensorDesc(Precision::U8, {static_cast<std::size_t>(dataSize)}, Layout::C));
+        dataBlob->allocate();
+        networkModel.read(dataBlob->buffer(), dataSize);
+    }
+    if (!networkModel.good()) {
+        THROW_IE_EXCEPTION << "Error reading CPU plugin blob content";
+    }
+
+    auto cnnnetwork = core->ReadNetwork(xmlString, std::move(dataBlob));
+    _clonedNetwork = cloneNet(static_cast<ICNNNetwork&>(cnnnetwork));
+    _name = GetStrAttr(cpuNode, "name", _clonedNetwork->getName().c_str());
+
+    InputsDataMap clonedInputs;
+    _clonedNetwork->getInputsInfo(clonedInputs);
+    InputsDataMap networkInputs;
+    auto inputsNode = cpuNode.child("inputs");
+    for (auto inputNode = inputsNode.child("input"); !inputNode.empty(); inputNode = inputNode.next_sibling("input")) {
+        auto inputName = GetStrAttr(inputNode, "name");
+        auto itInput = clonedInputs.find(inputName);
+        if (itInput == clonedInputs.end()) {
+            THROW_IE_EXCEPTION << "Input " << inputName << " was not found in the imported network";
+        }
+        itInput->second->setPrecision(Precision::FromStr(GetStrAttr(inputNode, "precision")));
+        itInput->second->setLayout(static_cast<Layout>(GetIntAttr(inputNode, "layout")));
+        networkInputs.emplace(*itInput);
+    }
+
+    OutputsDataMap clonedOutputs;
+    auto outputsNode = cpuNode.child("outputs");
+    for (auto outputNode = outputsNode.child("output"); !outputNode.empty(); outputNode = outputNode.next_sibling("output")) {
+        _clonedNetwork->getOutputsInfo(clonedOutputs);
+        if (clonedOutputs.end() == clonedOutputs.find(GetStrAttr(outputNode, "name"))) {
+            // intermediate output which has consumers in the serialized IR
+            _clonedNetwork->addOutput(GetStrAttr(outputNode, "creatorName"), GetUInt64Attr(outputNode, "index"), nullptr);
+        }
+    }
+    _clonedNetwork->getOutputsInfo(clonedOutputs);
+    OutputsDataMap networkOutputs;
+    for (auto outputNode = outputsNode.child("output"); !outputNode.empty(); outputNode = outputNode.next_sibling("output")) {
+        auto outputName = GetStrAttr(outputNode, "name");
+        auto itOutput = clonedOutputs.find(outputName);
+        if (itOutput == clonedOutputs.end()) {
+            THROW_IE_EXCEPTION << "Output " << outputName << " was not found in the imported network";
+        }
+        itOutput->second->setPrecision(Precision::FromStr(GetStrAttr(outputNode, "precision")));
+        itOutput->second->setLayout(static_cast<Layout>(GetIntAttr(outputNode, "layout")));
+        networkOutputs.emplace(*itOutput);
+    }
+    copyInputOutputInfo(networkInputs, networkOutputs, _networkInputs, _networkOutputs);
+
+    _numaNodesWeights = NumaNodesWeights{numaNodesWeights, _cfg.weightsSharing};
+    CreateGraphs();
+}
 
+void MKLDNNExecNetwork::CreateGraphs() {
     if (_cfg.batchLimit > 1) {
         // check topology for applicability
         if (!CanProcessDynBatch(*_clonedNetwork)) {
@@ -104,7 +239,7 @@ MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::ICNNNetwork &network
         }
     }
 
-    if (cfg.exclusiveAsyncRequests) {
+    if (_cfg.exclusiveAsyncRequests) {
         // special case when all InferRequests are muxed into a single queue
         _taskExecutor = ExecutorManager::getInstance()->getExecutor("CPU");
     } else {
@@ -112,7 +247,7 @@ MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::ICNNNetwork &network
         streamsExecutorConfig._name = "CPUStreamsExecutor";
         _taskExecutor = ExecutorManager::getInstance()->getIdleCPUStreamsExecutor(streamsExecutorConfig);
     }
-    if (0 != cfg.streamExecutorConfig._streams) {
+    if (0 != _cfg.streamExecutorConfig._streams) {
         _callbackExecutor = ExecutorManager::getInstance()->getIdleCPUStreamsExecutor(
             IStreamsExecutor::Config{"CPUCallbackExecutor", 1, 0, IStreamsExecutor::ThreadBindingType::NONE});
     } else {
@@ -128,12 +263,7 @@ MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::ICNNNetwork &network
             std::unique_lock<std::mutex> lock{_cfgMutex};
             graph->setConfig(_cfg);
         }
-        int numaNode = 0;
-        auto* streamExecutor = dynamic_cast<InferenceEngine::IStreamsExecutor*>(_taskExecutor.get());
-        if (nullptr != streamExecutor) {
-            numaNode = streamExecutor->GetNumaNodeId();
-        }
-        graph->CreateGraph(static_cast<ICNNNetwork&>(*localNetwork), extensionManager, numaNodesWeights[numaNode]);
+        graph->CreateGraph(static_cast<ICNNNetwork&>(*localNetwork), extensionManager, _numaNodesWeights[GetNumaNodeId()]);
         return graph;
     }};
 
@@ -160,6 +290,117 @@ MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::ICNNNetwork &network
     }
 }
 
+int MKLDNNExecNetwork::GetNumaNodeId() const {
+    auto* streamExecutor = dynamic_cast<InferenceEngine::IStreamsExecutor*>(_taskExecutor.get());
+    return nullptr != streamExecutor ? streamExecutor->GetNumaNodeId() : 0;
+}
+
+MKLDNNGraph::Ptr MKLDNNExecNetwork::GetGraph(const ICNNNetwork::InputShapes &inputShapes) {
+    if (!CanChangeInputShapes()) {
+        THROW_IE_EXCEPTION << "Input shapes of the network " << _name << " cannot be changed";
+    }
+
+    auto& shapedGraphs = _shapedGraphs.local();
+    auto itGraph = std::find_if(shapedGraphs.begin(), shapedGraphs.end(),
+                                [&](const ShapedGraphs::value_type& shapedGraph) {
+                                    return shapedGraph.first == inputShapes;
+                                });
+    if (itGraph != shapedGraphs.end()) {
+        shapedGraphs.splice(shapedGraphs.begin(), shapedGraphs, itGraph);
+        return shapedGraphs.front().second;
+    }
+
+    OV_ITT_SCOPED_TASK(itt::domains::MKLDNNPlugin, "MKLDNNExecNetwork::GetGraph");
+
+    Config cfg;
+    {
+        std::lock_guard<std::mutex> lock{_cfgMutex};
+        cfg = _cfg;
+    }
+    // the graph changes the network passed, so the shared one is cloned (see CreateGraphs)
+    auto network = cloneNet(static_cast<ICNNNetwork&>(*GetShapedNetwork(inputShapes, cfg)));
+    auto graph = std::make_shared<MKLDNNGraph>();
+    graph->setConfig(cfg);
+    // weights are looked up in the same cache as the graphs of the original shapes use
+    graph->CreateGraph(static_cast<ICNNNetwork&>(*network), extensionManager, _numaNodesWeights[GetNumaNodeId()]);
+
+    shapedGraphs.emplace_front(inputShapes, graph);
+    while (shapedGraphs.size() > static_cast<size_t>(cfg.dynamicShapesCacheSize)) {
+        shapedGraphs.pop_back();
+    }
+    return graph;
+}
+
+CNNNetworkImplPtr MKLDNNExecNetwork::GetShapedNetwork(const ICNNNetwork::InputShapes &inputShapes, const Config &cfg) {
+    // Reshape and conversion of the ngraph network do not depend on a stream, so they are done once for all streams.
+    // The cache is locked only to look the shapes up. Streams which need the same shapes at the same time wait for
+    // the first one instead of converting it again, while networks of other shapes are converted concurrently.
+    std::promise<CNNNetworkImplPtr> promise;
+    std::shared_future<CNNNetworkImplPtr> future;
+    {
+        std::lock_guard<std::mutex> lock{_shapedNetworksMutex};
+        auto itNetwork = std::find_if(_shapedNetworks.begin(), _shapedNetworks.end(),
+                                      [&](const ShapedNetworks::value_type& shapedNetwork) {
+                                          return shapedNetwork.first == inputShapes;
+                                      });
+        if (itNetwork != _shapedNetworks.end()) {
+            _shapedNetworks.splice(_shapedNetworks.begin(), _shapedNetworks, itNetwork);
+            future = _shapedNetworks.front().second;
+        } else {
+            _shapedNetworks.emplace_front(inputShapes, promise.get_future().share());
+            while (_shapedNetworks.size() > static_cast<size_t>(cfg.dynamicShapesCacheSize)) {
+                _shapedNetworks.pop_back();
+            }
+        }
+    }
+    if (future.valid()) {
+        return future.get();
+    }
+
+    OV_ITT_SCOPED_TASK(itt::domains::MKLDNNPlugin, "MKLDNNExecNetwork::GetShapedNetwork");
+    try {
+        auto network = TransformNetwork(*_reshapeNetwork(inputShapes), cfg);
+        promise.set_value(network);
+        return network;
+    } catch (...) {
+        // waiting streams get the error, the next request of the shapes tries to convert the network again
+        promise.set_exception(std::current_exception());
+        std::lock_guard<std::mutex> lock{_shapedNetworksMutex};
+        _shapedNetworks.remove_if([&](const ShapedNetworks::value_type& shapedNetwork) {
+            return shapedNetwork.first == inputShapes &&
+                   shapedNetwork.second.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+        });
+        throw;
+    }
+}
+
+MKLDNNRequestsBatcher::Ptr MKLDNNExecNetwork::GetRequestsBatcher() {
+    if (!IsRequestsBatchingEnabled()) {
+        THROW_IE_EXCEPTION << "Requests batching is not enabled for the network " << _name;
+    }
+
+    std::lock_guard<std::mutex> lock{_requestsBatcherMutex};
+    if (nullptr == _requestsBatcher) {
+        InputsDataMap batchedInputs;
+        _clonedNetwork->getInputsInfo(batchedInputs);
+        OutputsDataMap batchedOutputs;
+        _clonedNetwork->getOutputsInfo(batchedOutputs);
+
+        // Batched requests are owned by the network through the batcher, so they do not keep the network alive
+        MKLDNNExecNetwork::Ptr network{std::shared_ptr<void>{}, this};
+        // Every stream can execute its own batch
+        std::vector<InferRequestInternal::Ptr> batchedRequests;
+        for (int i = 0; i < std::max(_cfg.streamExecutorConfig._streams, 1); ++i) {
+            batchedRequests.push_back(std::make_shared<MKLDNNInferRequest>(batchedInputs, batchedOutputs, network));
+        }
+        _requestsBatcher = std::make_shared<MKLDNNRequestsBatcher>(batchedRequests,
+                                                                   static_cast<std::size_t>(_cfg.requestsBatchSize),
+                                                                   std::chrono::microseconds{_cfg.requestsBatchTimeout},
+                                                                   _taskExecutor);
+    }
+    return _requestsBatcher;
+}
+
 void MKLDNNExecNetwork::setProperty(const std::map<std::string, std::string> &properties) {
     {
         std::lock_guard<std::mutex> lock{_cfgMutex};
@@ -170,10 +411,91 @@ void MKLDNNExecNetwork::setProperty(const std::map<std::string, std::string> &pr
     }
 }
 
+void MKLDNNExecNetwork::Export(const std::string &modelFileName) {
+    std::ofstream modelFile(modelFileName, std::ios::out | std::ios::binary);
+    if (!modelFile.is_open()) {
+        THROW_IE_EXCEPTION << "Cannot open file " << modelFileName << " to export the network";
+    }
+    Export(modelFile);
+}
+
+void MKLDNNExecNetwork::ExportImpl(std::ostream &networkModel) {
+    OV_ITT_SCOPED_TASK(itt::domains::MKLDNNPlugin, "MKLDNNExecNetwork::ExportImpl");
+
+    if (CanChangeInputShapes()) {
+        // only the network converted for the original shapes is stored, so it could not be reshaped after import
+        THROW_IE_EXCEPTION << NOT_IMPLEMENTED_str << "Export of the network with dynamic input shapes is not supported";
+    }
+    if (IsRequestsBatchingEnabled()) {
+        // the stored network is compiled for the batch of coalesced requests instead of the original one
+        THROW_IE_EXCEPTION << NOT_IMPLEMENTED_str << "Export of the network with requests batching is not supported";
+    }
+
+    pugi::xml_document doc;
+    auto cpuNode = doc.append_child("cpu");
+    cpuNode.append_attribute("version").set_value(exportFormatVersion);
+    cpuNode.append_attribute("name").set_value(_name.c_str());
+
+    auto inputsNode = cpuNode.append_child("inputs");
+    for (auto&& networkInput : _networkInputs) {
+        auto inputNode = inputsNode.append_child("input");
+        inputNode.append_attribute("name").set_value(networkInput.first.c_str());
+        inputNode.append_attribute("precision").set_value(networkInput.second->getPrecision().name());
+        inputNode.append_attribute("layout").set_value(static_cast<int>(networkInput.second->getLayout()));
+    }
+
+    OutputsDataMap clonedOutputs;
+    _clonedNetwork->getOutputsInfo(clonedOutputs);
+    auto outputsNode = cpuNode.append_child("outputs");
+    for (auto&& networkOutput : _networkOutputs) {
+        auto itOutput = clonedOutputs.find(networkOutput.first);
+        IE_ASSERT(clonedOutputs.end() != itOutput);
+        auto creator = getCreatorLayer(itOutput->second).lock();
+        auto& outDatas = creator->outData;
+        auto itData = std::find(std::begin(outDatas), std::end(outDatas), itOutput->second);
+        IE_ASSERT(outDatas.end() != itData);
+        std::uint64_t index = std::distance(std::begin(outDatas), itData);
+
+        auto outputNode = outputsNode.append_child("output");
+        outputNode.append_attribute("name").set_value(networkOutput.first.c_str());
+        outputNode.append_attribute("creatorName").set_value(creator->name.c_str());
+        outputNode.append_attribute("index").set_value(std::to_string(index).c_str());
+        outputNode.append_attribute("precision").set_value(networkOutput.second->getPrecision().name());
+        outputNode.append_attribute("layout").set_value(static_cast<int>(networkOutput.second->getLayout()));
+    }
+
+    auto configsNode = cpuNode.append_child("configs");
+    {
+        std::lock_guard<std::mutex> lock{_cfgMutex};
+        for (auto&& config : _cfg._config) {
+            auto configNode = configsNode.append_child("config");
+            configNode.append_attribute("key").set_value(config.first.c_str());
+            configNode.append_attribute("value").set_value(config.second.c_str());
+        }
+    }
+
+    doc.save(networkModel, nullptr, pugi::format_raw);
+    networkModel << std::endl;
+
+    // Network is stored after plugin specific transformations (LPT, BF16, unrolling),
+    // so import only creates the graph
+    std::stringstream dataStream;
+    ResponseDesc resp;
+    if (OK != _clonedNetwork->serialize(networkModel, dataStream, &resp)) {
+        THROW_IE_EXCEPTION << resp.msg;
+    }
+    auto dataSize = static_cast<std::uint64_t>(dataStream.tellp());
+    networkModel.write(reinterpret_cast<char*>(&dataSize), sizeof(dataSize));
+    if (0 != dataSize) {
+        networkModel << dataStream.rdbuf();
+    }
+}
+
 void MKLDNNExecNetwork::CreateInferRequest(InferenceEngine::IInferRequest::Ptr &asyncRequest) {
     auto syncRequestImpl = CreateInferRequestImpl(_networkInputs, _networkOutputs);
     syncRequestImpl->setPointerToExecutableNetworkInternal(shared_from_this());
-    auto asyncRequestImpl = std::make_shared<MKLDNNAsyncInferRequest>(syncRequestImpl, _taskExecutor, _callbackExecutor);
+    auto asyncRequestImpl = std::make_shared<MKLDNNAsyncInferRequest>(syncRequestImpl, _taskExecutor, _callbackExecutor,
+        IsRequestsBatchingEnabled() ? GetRequestsBatcher() : nullptr);
     asyncRequest.reset(new InferRequestBase<MKLDNNAsyncInferRequest>(asyncRequestImpl),
                        [](IInferRequest *p) { p->Release(); });
 
@@ -213,6 +535,13 @@ void MKLDNNExecNetwork::GetMetric(const std::string &name, Parameter &result, Re
         metrics.push_back(METRIC_KEY(SUPPORTED_METRICS));
         metrics.push_back(METRIC_KEY(SUPPORTED_CONFIG_KEYS));
         metrics.push_back(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS));
+        metrics.push_back(METRIC_KEY(INFER_REQUESTS_COPIED_BYTES));
+        metrics.push_back(METRIC_KEY(MEMORY_ARENA_SIZE));
+        metrics.push_back(METRIC_KEY(MEMORY_ARENA_LOWER_BOUND));
+        if (IsRequestsBatchingEnabled()) {
+            metrics.push_back(METRIC_KEY(REQUESTS_BATCH_SIZE_HISTOGRAM));
+            metrics.push_back(METRIC_KEY(REQUESTS_QUEUEING_DELAY));
+        }
         result = IE_SET_METRIC(SUPPORTED_METRICS, metrics);
     } else if (name == METRIC_KEY(SUPPORTED_CONFIG_KEYS)) {
         std::vector<std::string> configKeys;
@@ -225,8 +554,33 @@ void MKLDNNExecNetwork::GetMetric(const std::string &name, Parameter &result, Re
         auto option = engConfig._config.find(CONFIG_KEY(CPU_THROUGHPUT_STREAMS));
         IE_ASSERT(option != engConfig._config.end());
         auto streams = std::stoi(option->second);
+        // every stream needs enough requests to fill a batch
+        auto requestsPerStream = IsRequestsBatchingEnabled() ? _cfg.requestsBatchSize : 1;
         result = IE_SET_METRIC(OPTIMAL_NUMBER_OF_INFER_REQUESTS, static_cast<unsigned int>(
-            streams ? streams : 1));
+            (streams ? streams : 1) * requestsPerStream));
+    } else if (name == METRIC_KEY(INFER_REQUESTS_COPIED_BYTES)) {
+        result = IE_SET_METRIC(INFER_REQUESTS_COPIED_BYTES, static_cast<uint64_t>(_copiedBytes));
+    } else if (name == METRIC_KEY(MEMORY_ARENA_SIZE)) {
+        result = IE_SET_METRIC(MEMORY_ARENA_SIZE, static_cast<uint64_t>(_graphs.begin()->get()->GetMemoryArenaSize()));
+    } else if (name == METRIC_KEY(MEMORY_ARENA_LOWER_BOUND)) {
+        result = IE_SET_METRIC(MEMORY_ARENA_LOWER_BOUND,
+                               static_cast<uint64_t>(_graphs.begin()->get()->GetMemoryArenaLowerBound()));
+    } else if (IsRequestsBatchingEnabled() &&
+               (name == METRIC_KEY(REQUESTS_BATCH_SIZE_HISTOGRAM) || name == METRIC_KEY(REQUESTS_QUEUEING_DELAY))) {
+        // the batcher is created with the first request
+        MKLDNNRequestsBatcher::Statistics statistics;
+        statistics.batchSizeHistogram.resize(_cfg.requestsBatchSize + 1, 0);
+        {
+            std::lock_guard<std::mutex> lock{_requestsBatcherMutex};
+            if (nullptr != _requestsBatcher) {
+                statistics = _requestsBatcher->GetStatistics();
+            }
+        }
+        if (name == METRIC_KEY(REQUESTS_BATCH_SIZE_HISTOGRAM)) {
+            result = IE_SET_METRIC(REQUESTS_BATCH_SIZE_HISTOGRAM, statistics.batchSizeHistogram);
+        } else {
+            result = IE_SET_METRIC(REQUESTS_QUEUEING_DELAY, statistics.averageQueueingDelay);
+        }
     } else {
         THROW_IE_EXCEPTION << "Unsupported ExecutableNetwork metric: " << name;
     }
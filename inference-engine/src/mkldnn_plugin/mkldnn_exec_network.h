@@ -8,12 +8,20 @@
 
 #include "mkldnn_graph.h"
 #include "mkldnn_extension_mngr.h"
+#include "mkldnn_requests_batcher.h"
 #include <threading/ie_thread_local.hpp>
+#include <ie_icore.hpp>
 
+#include <functional>
+#include <future>
+#include <list>
 #include <vector>
 #include <memory>
 #include <map>
+#include <mutex>
 #include <string>
+#include <istream>
+#include <ostream>
 #include <legacy/cnn_network_impl.hpp>
 #include <unordered_map>
 
@@ -23,6 +31,12 @@ class MKLDNNExecNetwork: public InferenceEngine::ExecutableNetworkThreadSafeDefa
 public:
     typedef std::shared_ptr<MKLDNNExecNetwork> Ptr;
 
+    /**
+     * @brief Creates a network of the given input shapes converted to be loaded to the plugin
+     */
+    using ReshapeCallback =
+        std::function<InferenceEngine::ICNNNetwork::Ptr(const InferenceEngine::ICNNNetwork::InputShapes&)>;
+
     InferenceEngine::InferRequestInternal::Ptr
     CreateInferRequestImpl(InferenceEngine::InputsDataMap networkInputs,
               InferenceEngine::OutputsDataMap networkOutputs) override;
@@ -30,7 +44,13 @@ public:
     void CreateInferRequest(InferenceEngine::IInferRequest::Ptr &asyncRequest) override;
 
     MKLDNNExecNetwork(const InferenceEngine::ICNNNetwork &network, const Config &cfg,
-                      const MKLDNNExtensionManager::Ptr &extMgr, NumaNodesWeights &weightsSharing);
+                      const MKLDNNExtensionManager::Ptr &extMgr, NumaNodesWeights &weightsSharing,
+                      const ReshapeCallback &reshapeNetwork = {});
+
+    MKLDNNExecNetwork(std::istream &networkModel, const Config &cfg,
+                      const std::map<std::string, std::string> &config,
+                      const MKLDNNExtensionManager::Ptr &extMgr, NumaNodesWeights &weightsSharing,
+                      InferenceEngine::ICore *core);
 
     ~MKLDNNExecNetwork() override = default;
 
@@ -42,11 +62,43 @@ public:
 
     void GetExecGraphInfo(InferenceEngine::ICNNNetwork::Ptr &graphPtr) override;
 
+    using InferenceEngine::ExecutableNetworkInternal::Export;
+
+    void Export(const std::string &modelFileName) override;
+
     std::vector<InferenceEngine::IMemoryStateInternal::Ptr> QueryState() override;
 
     InferenceEngine::ThreadLocal<MKLDNNGraph::Ptr>  _graphs;
 
+    /**
+     * @brief Checks whether infer requests accept input blobs of shapes other than the network ones
+     */
+    bool CanChangeInputShapes() const {
+        return static_cast<bool>(_reshapeNetwork);
+    }
+
+    /**
+     * @brief Returns a graph of the current stream compiled for the given input shapes.
+     * The graph is created on the first request and is cached until it becomes the least recently used one.
+     * The network converted for these shapes is shared by graphs of all streams.
+     */
+    MKLDNNGraph::Ptr GetGraph(const InferenceEngine::ICNNNetwork::InputShapes &inputShapes);
+
+    /**
+     * @brief Checks whether infer requests are coalesced into batches
+     */
+    bool IsRequestsBatchingEnabled() const {
+        return _cfg.requestsBatchSize > 1;
+    }
+
+    /**
+     * @brief Returns the batcher of infer requests. It is created with the first infer request.
+     */
+    MKLDNNRequestsBatcher::Ptr GetRequestsBatcher();
+
 protected:
+    void ExportImpl(std::ostream &networkModel) override;
+
     friend class MKLDNNInferRequest;
     MKLDNNExtensionManager::Ptr extensionManager;
     std::vector<InferenceEngine::IMemoryStateInternal::Ptr> memoryStates;
@@ -54,10 +106,31 @@ protected:
     std::mutex                                  _cfgMutex;
     Config                                      _cfg;
     std::atomic_int                             _numRequests = {0};
+    std::atomic<uint64_t>                       _copiedBytes = {0};
     std::string                                 _name;
+    ReshapeCallback                             _reshapeNetwork;
+    // weights caches of the network, which refer to the plugin ones if weights are shared with other networks
+    NumaNodesWeights                            _numaNodesWeights;
+
+    using ShapedGraphs = std::list<std::pair<InferenceEngine::ICNNNetwork::InputShapes, MKLDNNGraph::Ptr>>;
+    InferenceEngine::ThreadLocal<ShapedGraphs>  _shapedGraphs;
+    // networks which are being converted are stored as well, so streams needing them wait for the conversion
+    using ShapedNetworks = std::list<std::pair<InferenceEngine::ICNNNetwork::InputShapes,
+                                               std::shared_future<InferenceEngine::details::CNNNetworkImplPtr>>>;
+    std::mutex                                  _shapedNetworksMutex;
+    ShapedNetworks                              _shapedNetworks;
+    mutable std::mutex                          _requestsBatcherMutex;
+    MKLDNNRequestsBatcher::Ptr                  _requestsBatcher;
 
 
     bool CanProcessDynBatch(const InferenceEngine::ICNNNetwork &network) const;
+
+    void CreateGraphs();
+
+    int GetNumaNodeId() const;
+
+    InferenceEngine::details::CNNNetworkImplPtr GetShapedNetwork(
+        const InferenceEngine::ICNNNetwork::InputShapes &inputShapes, const Config &cfg);
 };
 
 }  // namespace MKLDNNPlugin
@@ -3,6 +3,7 @@
 //
 
 #include <algorithm>
+#include <cstdint>
 #include <string>
 #include <map>
 #include <vector>
@@ -21,6 +22,7 @@
 #include "mkldnn_memory_solver.hpp"
 #include "mkldnn_itt.h"
 #include <nodes/mkldnn_input_node.h>
+#include <nodes/mkldnn_memory_node.hpp>
 #include <nodes/mkldnn_reorder_node.h>
 
 #include <legacy/graph_tools.hpp>
@@ -91,8 +93,9 @@ void MKLDNNGraph::CreateGraph(const NET &net, const MKLDNNExtensionManager::Ptr&
         MKLDNNWeightsSharing::Ptr &w_cache) {
     if (IsReady())
         ForgetGraphData();
-    // disable caching if graph was created only once
-    weightsCache = config.streamExecutorConfig._streams != 1 ? w_cache : nullptr;
+    // disable caching if graph was created only once and weights are not shared with other networks
+    weightsCache = config.streamExecutorConfig._streams != 1 || config.dynamicShapesCacheSize > 0 || config.weightsSharing
+                   ? w_cache : nullptr;
 
     Replicate(net, extMgr);
     InitGraph();
@@ -356,6 +359,8 @@ void MKLDNNGraph::InitGraph() {
 
     SortTopologically();
 
+    ScheduleExecutionStages();
+
     Allocate();
 
     CreatePrimitives();
@@ -522,6 +527,184 @@ void MKLDNNGraph::InitEdges() {
     }
 }
 
+#if (IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO)
+namespace {
+
+// Minimal amount of work (multiply-accumulate operations for compute bound nodes and processed elements
+// for memory bound ones) which is worth to be given to a separate thread
+constexpr size_t minWorkPerThread = 64 * 1024;
+
+size_t estimateNodeCost(const MKLDNNNodePtr& node) {
+    size_t inputElements = 0;
+    for (size_t i = 0; i < node->getParentEdges().size(); i++) {
+        auto edge = node->getParentEdgeAt(i);
+        if (!edge->getParent()->isConstant())
+            inputElements += edge->getDims().size();
+    }
+
+    size_t outputElements = 0, outputChannels = 0;
+    std::unordered_set<int> outputPorts;  // one output port may be connected to several children
+    for (size_t i = 0; i < node->getChildEdges().size(); i++) {
+        auto edge = node->getChildEdgeAt(i);
+        if (outputPorts.insert(edge->getInputNum()).second) {
+            outputElements += edge->getDims().size();
+            if (edge->getDims().ndims() > 1)
+                outputChannels = std::max<size_t>(outputChannels, edge->getDims()[1]);
+        }
+    }
+
+    switch (node->getType()) {
+        case Convolution:
+        case Deconvolution:
+        case BinaryConvolution:
+        case DeformableConvolution:
+        case FullyConnected: {
+            // each output element accumulates products of one output channel of weights
+            const auto& layer = node->getCnnLayer();
+            if (layer && outputChannels) {
+                auto weights = layer->blobs.find("weights");
+                if (weights != layer->blobs.end() && weights->second)
+                    return outputElements * std::max<size_t>(weights->second->size() / outputChannels, 1);
+            }
+            break;
+        }
+        default:
+            break;
+    }
+    return inputElements + outputElements;
+}
+
+// Nodes which must be finished before the node is started, although they are not connected to it by edges
+std::vector<MKLDNNNodePtr> getHiddenDependencies(const MKLDNNNodePtr& node,
+                                                 const std::map<std::string, MKLDNNNodePtr>& memoryInputs) {
+    std::vector<MKLDNNNodePtr> dependencies;
+
+    // MemoryOutput overwrites the state which MemoryInput with the same id reads
+    if (node->getType() == MemoryOutput) {
+        auto memoryNode = dynamic_cast<MKLDNNMemoryNode*>(node.get());
+        auto input = memoryNode ? memoryInputs.find(memoryNode->getId()) : memoryInputs.end();
+        if (input != memoryInputs.end())
+            dependencies.push_back(input->second);
+    }
+
+    // An output which is in-place with an input may be written to the memory other consumers of the input read.
+    // The memory may come through a chain of in-place views (Split, Reshape, ...), so their consumers are readers too.
+    auto selectedPD = node->getSelectedPrimitiveDescriptor();
+    if (!selectedPD)
+        return dependencies;
+    for (auto& outConf : selectedPD->getConfig().outConfs) {
+        if (outConf.inPlace < 0 || outConf.inPlace >= static_cast<int>(node->getParentEdges().size()))
+            continue;
+
+        auto edge = node->getParentEdgeAt(outConf.inPlace);
+        while (edge && !edge->getParent()->isConstant()) {
+            auto parent = edge->getParent();
+            for (auto& reader : parent->getChildEdgesAtPort(edge->getInputNum())) {
+                if (reader != edge && reader->getChild() != node)
+                    dependencies.push_back(reader->getChild());
+            }
+
+            auto parentPD = parent->getSelectedPrimitiveDescriptor();
+            if (!parentPD || edge->getInputNum() >= static_cast<int>(parentPD->getConfig().outConfs.size()))
+                break;
+            int view = parentPD->getConfig().outConfs[edge->getInputNum()].inPlace;
+            edge = view >= 0 && view < static_cast<int>(parent->getParentEdges().size())
+                   ? parent->getParentEdgeAt(view) : nullptr;
+        }
+    }
+    return dependencies;
+}
+
+}  // namespace
+#endif
+
+void MKLDNNGraph::ScheduleExecutionStages() {
+    executionStages.clear();
+    nodeStages.clear();
+#if (IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO)
+    if (!config.interOpParallelism)
+        return;
+
+    OV_ITT_SCOPED_TASK(itt::domains::MKLDNNPlugin, "MKLDNNGraph::ScheduleExecutionStages");
+
+    std::map<std::string, MKLDNNNodePtr> memoryInputs;
+    for (auto& node : graphNodes) {
+        auto memoryNode = dynamic_cast<MKLDNNMemoryNode*>(node.get());
+        if (node->getType() == MemoryInput && memoryNode)
+            memoryInputs[memoryNode->getId()] = node;
+    }
+
+    std::vector<std::vector<MKLDNNNodePtr>> hiddenDependencies(graphNodes.size());
+    for (auto& node : graphNodes) {
+        if (!node->isConstant())
+            hiddenDependencies[node->execIndex] = getHiddenDependencies(node, memoryInputs);
+    }
+
+    // A node is placed to the stage next to the latest stage of its parents and hidden dependencies. Constant nodes
+    // are executed on load, so they do not hold back the nodes which consume constants. Hidden dependencies may
+    // follow the node in graphNodes order, so stages are refined until they stop changing.
+    nodeStages.resize(graphNodes.size(), 0);
+    for (bool changed = true; changed;) {
+        changed = false;
+        for (auto& node : graphNodes) {
+            if (node->isConstant())
+                continue;
+
+            int stage = 0;
+            for (size_t i = 0; i < node->getParentEdges().size(); i++) {
+                auto parent = node->getParentEdgeAt(i)->getParent();
+                if (!parent->isConstant())
+                    stage = std::max(stage, nodeStages[parent->execIndex] + 1);
+            }
+            for (auto& dependency : hiddenDependencies[node->execIndex]) {
+                if (!dependency->isConstant())
+                    stage = std::max(stage, nodeStages[dependency->execIndex] + 1);
+            }
+
+            // A stage beyond the number of nodes means that hidden dependencies contradict edges,
+            // so the sequential order is the only safe one
+            if (stage >= static_cast<int>(graphNodes.size())) {
+                nodeStages.clear();
+                return;
+            }
+            if (stage != nodeStages[node->execIndex]) {
+                nodeStages[node->execIndex] = stage;
+                changed = true;
+            }
+        }
+    }
+
+    for (auto& node : graphNodes) {
+        if (node->isConstant())
+            continue;
+
+        auto stage = nodeStages[node->execIndex];
+        if (executionStages.size() <= static_cast<size_t>(stage))
+            executionStages.resize(stage + 1);
+        executionStages[stage].nodes.push_back(node);
+    }
+
+    // A node which loads all threads alone gains nothing from being executed side by side with others.
+    // So a stage is executed concurrently only if it has at least two nodes which are not able to do it.
+    const size_t saturationCost = static_cast<size_t>(parallel_get_max_threads()) * minWorkPerThread;
+    bool hasParallelStages = false;
+    for (auto& stage : executionStages) {
+        auto smallNodes = std::count_if(stage.nodes.begin(), stage.nodes.end(), [&](const MKLDNNNodePtr& node) {
+            return node->getType() != Input && node->getType() != Output && estimateNodeCost(node) < saturationCost;
+        });
+        stage.parallel = smallNodes > 1;
+        hasParallelStages |= stage.parallel;
+    }
+
+    // Stages extend the lifetime of tensors, so keep the sequential execution and the tighter memory reuse
+    // if there is nothing to run concurrently
+    if (!hasParallelStages) {
+        executionStages.clear();
+        nodeStages.clear();
+    }
+#endif
+}
+
 static inline bool isConstOutput(MKLDNNEdgePtr edge) {
     return edge->getParent()->isConstant() && !edge->getChild()->isConstant();
 }
@@ -594,15 +777,22 @@ void MKLDNNGraph::AllocateWithReuse() {
     }
     //======= End of WA ============
 
-    const int64_t alignment = 32;  // 32 bytes
+    // Tensors do not share cache lines, and the ones of a page size or bigger are aligned to pages
+    const int64_t alignment = 64;  // bytes
+    const int64_t pageSize = 4096;  // bytes
+
+    // Nodes of one execution stage may run concurrently, so a lifetime of tensors is measured in stages then
+    auto timestamp = [&](const MKLDNNNodePtr& node) {
+        return nodeStages.empty() ? node->execIndex : nodeStages[node->execIndex];
+    };
 
     std::vector<MemorySolver::Box> boxes(edge_clasters.size());
     for (int i = 0; i < edge_clasters.size(); i++) {
         MemorySolver::Box &box = boxes[i];
         box = { std::numeric_limits<int>::max(), 0, 0, i };
         for (auto &edge : edge_clasters[i]) {
-            int e_start = edge->getParent()->execIndex;
-            int e_finish = edge->getChild()->execIndex;
+            int e_start = timestamp(edge->getParent());
+            int e_finish = timestamp(edge->getChild());
 
             const BlockingDesc block_desk = edge->getDesc().getBlockingDesc();
 
@@ -649,12 +839,16 @@ void MKLDNNGraph::AllocateWithReuse() {
         box.size = div_up(box.size, alignment);
     }
 
-    MemorySolver memSolver(boxes);
+    MemorySolver memSolver(boxes, pageSize / alignment);
     size_t total_size = static_cast<size_t>(memSolver.solve()) * alignment;
+    memoryArenaSize = total_size;
+    memoryArenaLowerBound = static_cast<size_t>(std::max<int64_t>(memSolver.maxDepth(), 0)) * alignment;
 
+    // The workspace is extended by a page to align its beginning
     memWorkspace = std::make_shared<MKLDNNMemory>(eng);
-    memWorkspace->Create(MKLDNNMemoryDesc(TensorDesc(Precision::I8, {total_size}, Layout::C)));
-    auto* workspace_ptr = static_cast<int8_t*>(memWorkspace->GetData());
+    memWorkspace->Create(MKLDNNMemoryDesc(TensorDesc(Precision::I8, {total_size + pageSize}, Layout::C)));
+    auto workspace_address = reinterpret_cast<std::uintptr_t>(memWorkspace->GetData());
+    auto* workspace_ptr = reinterpret_cast<int8_t*>(div_up(workspace_address, pageSize) * pageSize);
 
     for (int i = 0; i < edge_clasters.size(); i++) {
         int count = 0;
@@ -692,6 +886,26 @@ void MKLDNNGraph::Allocate() {
 
     // Check all getters. Should work.
     for (auto& edge : graphEdges) edge->validate();
+
+    // Infer requests may bind input and output edges to user blobs, so the original memory is kept to restore it
+    for (auto& input : inputNodes) {
+        for (size_t i = 0; i < input.second->getChildEdges().size(); i++) {
+            auto edge = input.second->getChildEdgeAt(i);
+            defaultEdgePtrs[edge.get()] = edge->getMemory().GetData();
+        }
+    }
+    for (auto& output : outputNodes) {
+        auto edge = output->getParentEdgeAt(0);
+        defaultEdgePtrs[edge.get()] = edge->getMemory().GetData();
+    }
+}
+
+void* MKLDNNGraph::GetDefaultEdgePtr(const MKLDNNEdgePtr& edge) const {
+    auto it = defaultEdgePtrs.find(edge.get());
+    if (it == defaultEdgePtrs.end())
+        THROW_IE_EXCEPTION << "Edge between " << edge->getParent()->getName() << " and " << edge->getChild()->getName()
+                           << " is not an input or output one";
+    return it->second;
 }
 
 void MKLDNNGraph::CreatePrimitives() {
@@ -701,9 +915,11 @@ void MKLDNNGraph::CreatePrimitives() {
     }
 }
 
-void MKLDNNGraph::PushInputData(const std::string& name, const InferenceEngine::Blob::Ptr &in) {
+size_t MKLDNNGraph::PushInputData(const std::string& name, const InferenceEngine::Blob::Ptr &in, bool subtractMean) {
     if (!IsReady()) THROW_IE_EXCEPTION<< "Wrong state. Topology not ready.";
 
+    size_t copiedBytes = 0;
+
     auto input = inputNodes.find(name);
     if (input != inputNodes.end()) {
         MKLDNNDims outDims = input->second->getChildEdgeAt(0)->getDims();
@@ -719,10 +935,11 @@ void MKLDNNGraph::PushInputData(const std::string& name, const InferenceEngine::
             input->second->getChildEdgeAt(0)->getMemory().SetData(
                     MKLDNNExtensionUtils::IEPrecisionToDataType(in->getTensorDesc().getPrecision()),
                     MKLDNNMemory::Convert(l), ext_data_ptr, in->byteSize(), false);
+            copiedBytes = in->byteSize();
         }
 
         // todo: make sure 'name' exists in this map...
-        if (_meanImages.find(name) != _meanImages.end()) {
+        if (subtractMean && _meanImages.find(name) != _meanImages.end()) {
             if (in->getTensorDesc().getPrecision() == InferenceEngine::Precision::FP32) {
                 _meanImages[name].Subtract(outDims, reinterpret_cast<float *>(inter_data_ptr), in->getTensorDesc().getLayout());
             } else {
@@ -732,12 +949,15 @@ void MKLDNNGraph::PushInputData(const std::string& name, const InferenceEngine::
     } else {
         THROW_IE_EXCEPTION << "Input blob for infer '" << name << "' doesn't correspond to input in network";
     }
+    return copiedBytes;
 }
 
-void MKLDNNGraph::PullOutputData(BlobMap &out) {
+size_t MKLDNNGraph::PullOutputData(BlobMap &out) {
     if (!IsReady())
         THROW_IE_EXCEPTION << "Wrong state. Topology not ready.";
 
+    size_t copiedBytes = 0;
+
     for (MKLDNNNodePtr &node : outputNodes) {
         // remove out_ from node name
         std::string name = node->getName().substr(4);
@@ -776,7 +996,9 @@ void MKLDNNGraph::PullOutputData(BlobMap &out) {
         size_t size_to_copy = intr_blob.GetSize() * MB_to_process / MB;
 
         cpu_memcpy_s(ext_blob_ptr, ext_blob->byteSize(), intr_blob_ptr, size_to_copy);
+        copiedBytes += size_to_copy;
     }
+    return copiedBytes;
 }
 
 void MKLDNNGraph::Infer(int batch) {
@@ -784,26 +1006,74 @@ void MKLDNNGraph::Infer(int batch) {
         THROW_IE_EXCEPTION << "Wrong state. Topology is not ready.";
     }
 
-    mkldnn::stream stream = mkldnn::stream(stream::kind::eager);
-    for (int i = 0; i < graphNodes.size(); i++) {
-        PERF(graphNodes[i]);
+    if (!executionStages.empty()) {
+        InferStages(batch);
+    } else {
+        mkldnn::stream stream = mkldnn::stream(stream::kind::eager);
+        for (int i = 0; i < graphNodes.size(); i++) {
+            PERF(graphNodes[i]);
 
-        if (batch > 0)
-            graphNodes[i]->setDynamicBatchLim(batch);
+            if (batch > 0)
+                graphNodes[i]->setDynamicBatchLim(batch);
 
-        ENABLE_DUMP(do_before(DUMP_DIR, graphNodes[i]));
+            ENABLE_DUMP(do_before(DUMP_DIR, graphNodes[i]));
 
-        if (!graphNodes[i]->isConstant()) {
-            OV_ITT_SCOPED_TASK(itt::domains::MKLDNNPlugin, graphNodes[i]->profilingTask);
-            graphNodes[i]->execute(stream);
-        }
+            if (!graphNodes[i]->isConstant()) {
+                OV_ITT_SCOPED_TASK(itt::domains::MKLDNNPlugin, graphNodes[i]->profilingTask);
+                graphNodes[i]->execute(stream);
+            }
 
-        ENABLE_DUMP(do_after(DUMP_DIR, graphNodes[i]));
+            ENABLE_DUMP(do_after(DUMP_DIR, graphNodes[i]));
+        }
     }
 
     if (infer_count != -1) infer_count++;
 }
 
+void MKLDNNGraph::InferStages(int batch) {
+#if (IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO)
+    auto executeNode = [&](const MKLDNNNodePtr& node, mkldnn::stream& stream) {
+        PERF(node);
+
+        if (batch > 0)
+            node->setDynamicBatchLim(batch);
+
+        ENABLE_DUMP(do_before(DUMP_DIR, node));
+
+        {
+            OV_ITT_SCOPED_TASK(itt::domains::MKLDNNPlugin, node->profilingTask);
+            node->execute(stream);
+        }
+
+        ENABLE_DUMP(do_after(DUMP_DIR, node));
+    };
+
+    mkldnn::stream stream = mkldnn::stream(stream::kind::eager);
+    for (auto& stage : executionStages) {
+        if (!stage.parallel) {
+            for (auto& node : stage.nodes)
+                executeNode(node, stream);
+            continue;
+        }
+
+        // Intra-op parallel loops of the nodes share threads of the current arena
+        const tbb::blocked_range<size_t> nodes(0, stage.nodes.size(), 1);
+        tbb::parallel_for(nodes, [&](const tbb::blocked_range<size_t>& r) {
+            for (auto i = r.begin(); i != r.end(); ++i) {
+                // MKLDNN primitives use a scratchpad of the calling thread, so the thread must not take tasks
+                // of other nodes while it waits for its own node
+                tbb::this_task_arena::isolate([&] {
+                    mkldnn::stream nodeStream = mkldnn::stream(stream::kind::eager);
+                    executeNode(stage.nodes[i], nodeStream);
+                });
+            }
+        }, tbb::simple_partitioner());
+    }
+#else
+    THROW_IE_EXCEPTION << "Inter-op parallelism is not supported with the current threading";
+#endif
+}
+
 void MKLDNNGraph::VisitNode(MKLDNNNodePtr node, std::vector<MKLDNNNodePtr>& sortedNodes) {
     if (node->temporary) {
         return;
@@ -14,6 +14,7 @@
 #include "threading/ie_thread_local.hpp"
 #include <map>
 #include <string>
+#include <unordered_map>
 #include <vector>
 #include <memory>
 
@@ -55,8 +56,24 @@ public:
         return _meanImages.find(name) != _meanImages.end();
     }
 
-    void PushInputData(const std::string& name, const InferenceEngine::Blob::Ptr &in);
-    void PullOutputData(InferenceEngine::BlobMap &out);
+    /**
+     * @brief Copies the input blob to the graph input memory unless the memory is the blob one
+     * @param subtractMean false if the mean values are already applied to the blob by the input pre-processing
+     * @return A number of copied bytes
+     */
+    size_t PushInputData(const std::string& name, const InferenceEngine::Blob::Ptr &in, bool subtractMean = true);
+
+    /**
+     * @brief Copies the graph output memory to the output blobs which do not share it
+     * @return A number of copied bytes
+     */
+    size_t PullOutputData(InferenceEngine::BlobMap &out);
+
+    /**
+     * @brief Returns a pointer to the memory the graph allocated for the input or output edge.
+     * An edge memory may be replaced by the one of a user blob, so the pointer is used to switch it back.
+     */
+    void* GetDefaultEdgePtr(const MKLDNNEdgePtr& edge) const;
 
     void Infer(int batch = -1);
 
@@ -76,6 +93,21 @@ public:
         return eng;
     }
 
+    /**
+     * @brief Returns a size in bytes of the memory allocated for intermediate tensors of the graph
+     */
+    size_t GetMemoryArenaSize() const {
+        return memoryArenaSize;
+    }
+
+    /**
+     * @brief Returns a size in bytes the memory for intermediate tensors cannot be less than.
+     * It is the maximal total size of tensors alive at the same time.
+     */
+    size_t GetMemoryArenaLowerBound() const {
+        return memoryArenaLowerBound;
+    }
+
     void GetPerfData(std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> &perfMap) const;
 
     void RemoveDroppedNodes();
@@ -103,7 +135,10 @@ protected:
         outputNodes.clear();
         graphNodes.clear();
         graphEdges.clear();
+        executionStages.clear();
+        nodeStages.clear();
         _meanImages.clear();
+        defaultEdgePtrs.clear();
     }
     Status status;
     Config config;
@@ -115,6 +150,21 @@ protected:
     bool reuse_io_tensors = true;
 
     MKLDNNMemoryPtr memWorkspace;
+    size_t memoryArenaSize = 0;
+    size_t memoryArenaLowerBound = 0;
+
+    /**
+     * @brief A group of nodes which do not depend on each other and may be executed concurrently.
+     * Stages are executed one by one, so a node is started only after all nodes of the previous stages are finished.
+     */
+    struct ExecutionStage {
+        std::vector<MKLDNNNodePtr> nodes;
+        bool parallel = false;
+    };
+    // Filled only if the inter-op parallelism is enabled, otherwise nodes are executed in graphNodes order
+    std::vector<ExecutionStage> executionStages;
+    // Index of the stage a node is executed at, indexed by execIndex
+    std::vector<int> nodeStages;
 
     std::map<std::string, MKLDNNNodePtr> inputNodes;
     std::vector<MKLDNNNodePtr> outputNodes;
@@ -122,6 +172,7 @@ protected:
     std::vector<MKLDNNEdgePtr> graphEdges;
 
     std::map<std::string, MeanImage> _meanImages;
+    std::unordered_map<const MKLDNNEdge*, void*> defaultEdgePtrs;
     std::string _name;
 
     mkldnn::engine eng;
@@ -134,6 +185,8 @@ protected:
     void InitEdges();
     void Allocate();
     void AllocateWithReuse();
+    void ScheduleExecutionStages();
+    void InferStages(int batch);
     void CreatePrimitives();
 
     void do_before(const std::string &dir, const MKLDNNNodePtr &node);
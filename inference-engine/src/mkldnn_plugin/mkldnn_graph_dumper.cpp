@@ -15,6 +15,7 @@
 #include <string>
 #include <memory>
 #include <map>
+#include <chrono>
 
 using namespace InferenceEngine;
 
@@ -283,6 +284,16 @@ std::map<std::string, std::string> extract_node_metadata(const MKLDNNNodePtr &no
 
     serialization_info[ExecGraphInfoSerialization::EXECUTION_ORDER] = std::to_string(node->getExecIndex());
 
+    // Bounds of the latest execution show which nodes were executed concurrently
+    if (node->PerfCounter().executed()) {
+        auto sinceEpoch = [](std::chrono::high_resolution_clock::time_point timePoint) {
+            auto nanoseconds = std::chrono::duration_cast<std::chrono::nanoseconds>(timePoint.time_since_epoch());
+            return std::to_string(nanoseconds.count());
+        };
+        serialization_info["execStartNs"] = sinceEpoch(node->PerfCounter().start());
+        serialization_info["execFinishNs"] = sinceEpoch(node->PerfCounter().finish());
+    }
+
     return serialization_info;
 }
 
@@ -4,6 +4,7 @@
 
 #include "mkldnn_infer_request.h"
 #include "mkldnn_extension_utils.h"
+#include <cstdint>
 #include <vector>
 #include <string>
 #include <map>
@@ -41,7 +42,8 @@ MKLDNNPlugin::MKLDNNInferRequest::~MKLDNNInferRequest() {
 }
 
 template <typename T>
-void MKLDNNPlugin::MKLDNNInferRequest::pushInput(const std::string& inputName, InferenceEngine::Blob::Ptr& inputBlob) {
+void MKLDNNPlugin::MKLDNNInferRequest::pushInput(const std::string& inputName, InferenceEngine::Blob::Ptr& inputBlob,
+                                                 bool subtractMean) {
     InferenceEngine::TBlob<T> *in_f = dynamic_cast<InferenceEngine::TBlob<T> *>(inputBlob.get());
 
     if (in_f == nullptr) {
@@ -52,7 +54,7 @@ void MKLDNNPlugin::MKLDNNInferRequest::pushInput(const std::string& inputName, I
         THROW_IE_EXCEPTION << "Input data was not allocated.";
     }
 
-    graph->PushInputData(inputName, inputBlob);
+    copiedBytes += graph->PushInputData(inputName, inputBlob, subtractMean);
 }
 
 namespace {
@@ -87,8 +89,12 @@ void MKLDNNPlugin::MKLDNNInferRequest::InferImpl() {
     OV_ITT_SCOPED_TASK(itt::domains::MKLDNNPlugin, profilingTask);
 
     graph = execNetwork->_graphs.local().get();
+    copiedBytes = 0;
     {
-        execDataPreprocessing(_inputs);
+        preprocessInputs();
+
+        if (execNetwork->CanChangeInputShapes())
+            selectGraph();
 
         changeDefaultPtr();
 
@@ -101,6 +107,11 @@ void MKLDNNPlugin::MKLDNNInferRequest::InferImpl() {
                                     << input.first;
             }
 
+            if (isNormalizedByPreprocessing(input.first)) {
+                pushInput<float>(input.first, normalizedInputs[input.first], false);
+                continue;
+            }
+
             InferenceEngine::Blob::Ptr iconv;
             InferenceEngine::TBlob<float> *in_f = nullptr;
             switch (input.second->getTensorDesc().getPrecision()) {
@@ -172,7 +183,8 @@ void MKLDNNPlugin::MKLDNNInferRequest::InferImpl() {
 
     graph->Infer(m_curBatch);
 
-    graph->PullOutputData(_outputs);
+    copiedBytes += graph->PullOutputData(_outputs);
+    execNetwork->_copiedBytes += copiedBytes;
 }
 
 void MKLDNNPlugin::MKLDNNInferRequest::GetPerformanceCounts(
@@ -201,12 +213,11 @@ void MKLDNNPlugin::MKLDNNInferRequest::GetBlob(const char *name, InferenceEngine
 
         if (_inputs.find(name) != _inputs.end()) {
             data = _inputs[name];
-            checkBlob(data, name, true);
+            checkBlob(data, name, true, refDims(data));
             return;
         }
 
         InferenceEngine::TensorDesc desc = blobs[name]->getTensorDesc();
-        InferenceEngine::Precision originPrecision = blobs[name]->getTensorDesc().getPrecision();
         if (_networkInputs.find(name) != _networkInputs.end()) {
             InferenceEngine::Layout l = _networkInputs[name]->getLayout();
             InferenceEngine::Precision p = _networkInputs[name]->getPrecision();
@@ -217,10 +228,6 @@ void MKLDNNPlugin::MKLDNNInferRequest::GetBlob(const char *name, InferenceEngine
 
         _inputs[name] = make_blob_with_precision(desc);
         _inputs[name]->allocate();
-        if (desc.getPrecision() == originPrecision &&
-                graph->_meanImages.find(name) == graph->_meanImages.end() && !graph->getProperty().batchLimit) {
-            externalPtr[name] = _inputs[name]->buffer();
-        }
         data = _inputs[name];
         checkBlob(data, name, true);
         return;
@@ -230,16 +237,12 @@ void MKLDNNPlugin::MKLDNNInferRequest::GetBlob(const char *name, InferenceEngine
     if (blobs.find(name) != blobs.end()) {
         if (_outputs.find(name) != _outputs.end()) {
             data = _outputs[name];
-            checkBlob(data, name, false);
+            checkBlob(data, name, false, refDims(data));
             return;
         }
 
         _outputs[name] = make_blob_with_precision(blobs[name]->getTensorDesc());
         _outputs[name]->allocate();
-        if (blobs[name]->getTensorDesc().getPrecision() == InferenceEngine::Precision::FP32 &&
-                !graph->getProperty().batchLimit) {
-            externalPtr[name] = _outputs[name]->buffer();
-        }
         data = _outputs[name];
         checkBlob(data, name, false);
         return;
@@ -286,24 +289,24 @@ void MKLDNNPlugin::MKLDNNInferRequest::SetBlob(const char *name, const Inference
             // pre-processing
             _preProcData[name]->setRoiBlob(data);
         } else {
-            size_t inputSize = foundInput->getTensorDesc().getLayout() != InferenceEngine::Layout::SCALAR
-                ? InferenceEngine::details::product(foundInput->getTensorDesc().getDims())
-                : 1;
-            if (dataSize != inputSize) {
-                THROW_IE_EXCEPTION << "Input blob size is not equal network input size ("
-                                   << dataSize << "!=" << inputSize << ").";
-            }
+            if (execNetwork->CanChangeInputShapes()) {
+                if (foundInput->getTensorDesc().getDims().size() != data->getTensorDesc().getDims().size()) {
+                    THROW_IE_EXCEPTION << PARAMETER_MISMATCH_str << "Failed to set input Blob. Rank mismatch.";
+                }
+            } else {
+                size_t inputSize = foundInput->getTensorDesc().getLayout() != InferenceEngine::Layout::SCALAR
+                    ? InferenceEngine::details::product(foundInput->getTensorDesc().getDims())
+                    : 1;
+                if (dataSize != inputSize) {
+                    THROW_IE_EXCEPTION << "Input blob size is not equal network input size ("
+                                       << dataSize << "!=" << inputSize << ").";
+                }
 
-            if (foundInput->getTensorDesc().getDims() != data->getTensorDesc().getDims()) {
-                THROW_IE_EXCEPTION << PARAMETER_MISMATCH_str << "Failed to set input Blob. Dimensions mismatch.";
+                if (foundInput->getTensorDesc().getDims() != data->getTensorDesc().getDims()) {
+                    THROW_IE_EXCEPTION << PARAMETER_MISMATCH_str << "Failed to set input Blob. Dimensions mismatch.";
+                }
             }
 
-            if (data->getTensorDesc().getPrecision() == InferenceEngine::Precision::FP32 &&
-                graph->_meanImages.find(name) == graph->_meanImages.end() && !graph->getProperty().batchLimit) {
-                externalPtr[name] = data->buffer();
-            } else if (externalPtr.find(name) != externalPtr.end()) {
-                externalPtr.erase(name);
-            }
             _inputs[name] = data;
         }
     } else {
@@ -311,72 +314,190 @@ void MKLDNNPlugin::MKLDNNInferRequest::SetBlob(const char *name, const Inference
             THROW_IE_EXCEPTION << NOT_IMPLEMENTED_str
                                << "cannot set compound blob: supported only for input pre-processing";
         }
-        size_t outputSize = foundOutput->getTensorDesc().getLayout() != InferenceEngine::Layout::SCALAR
-            ? InferenceEngine::details::product(foundOutput->getDims())
-            : 1;
-        if (dataSize != outputSize) {
-            THROW_IE_EXCEPTION << "Output blob size is not equal network output size ("
-                               << dataSize << "!=" << outputSize << ").";
-        }
-        if (foundOutput->getTensorDesc().getDims() != data->getTensorDesc().getDims()) {
-            THROW_IE_EXCEPTION << PARAMETER_MISMATCH_str << "Failed to set output Blob. Dimensions mismatch.";
+        if (execNetwork->CanChangeInputShapes()) {
+            if (foundOutput->getTensorDesc().getDims().size() != data->getTensorDesc().getDims().size()) {
+                THROW_IE_EXCEPTION << PARAMETER_MISMATCH_str << "Failed to set output Blob. Rank mismatch.";
+            }
+        } else {
+            size_t outputSize = foundOutput->getTensorDesc().getLayout() != InferenceEngine::Layout::SCALAR
+                ? InferenceEngine::details::product(foundOutput->getDims())
+                : 1;
+            if (dataSize != outputSize) {
+                THROW_IE_EXCEPTION << "Output blob size is not equal network output size ("
+                                   << dataSize << "!=" << outputSize << ").";
+            }
+            if (foundOutput->getTensorDesc().getDims() != data->getTensorDesc().getDims()) {
+                THROW_IE_EXCEPTION << PARAMETER_MISMATCH_str << "Failed to set output Blob. Dimensions mismatch.";
+            }
         }
         if (foundOutput->getPrecision() != data->getTensorDesc().getPrecision()) {
             THROW_IE_EXCEPTION << PARAMETER_MISMATCH_str
                                << "Failed to set Blob with precision not corresponding to user output precision";
         }
-        if (data->getTensorDesc().getPrecision() == InferenceEngine::Precision::FP32 &&
-                !graph->getProperty().batchLimit) {
-            externalPtr[name] = data->buffer();
-        } else if (externalPtr.find(name) != externalPtr.end()) {
-            externalPtr.erase(name);
-        }
         _outputs[name] = data;
     }
 }
 
+InferenceEngine::SizeVector MKLDNNPlugin::MKLDNNInferRequest::refDims(const InferenceEngine::Blob::Ptr &blob) const {
+    // Blobs of any dimensions are valid if input shapes can be changed, otherwise the network ones are expected
+    return execNetwork->CanChangeInputShapes() ? blob->getTensorDesc().getDims() : InferenceEngine::SizeVector{};
+}
+
+void MKLDNNPlugin::MKLDNNInferRequest::checkBlobs() {
+    for (auto const& input : _inputs) {
+        checkBlob(input.second, input.first, true, refDims(input.second));
+    }
+    for (auto const& output : _outputs) {
+        checkBlob(output.second, output.first, false, refDims(output.second));
+    }
+}
+
+void MKLDNNPlugin::MKLDNNInferRequest::selectGraph() {
+    InferenceEngine::ICNNNetwork::InputShapes inputShapes;
+    bool isOriginalShape = true;
+    for (auto&& input : _inputs) {
+        const auto& dims = input.second->getTensorDesc().getDims();
+        isOriginalShape &= dims == _networkInputs[input.first]->getTensorDesc().getDims();
+        inputShapes.emplace(input.first, dims);
+    }
+
+    if (isOriginalShape) {
+        shapedGraph.reset();
+    } else {
+        shapedGraph = execNetwork->GetGraph(inputShapes);
+        graph = shapedGraph.get();
+    }
+
+    // Output shapes depend on input ones, so output blobs are reallocated if they do not match the graph outputs
+    InferenceEngine::BlobMap graphOutputs;
+    graph->getOutputBlobs(graphOutputs);
+    for (auto&& graphOutput : graphOutputs) {
+        const auto& name = graphOutput.first;
+        const auto& dims = graphOutput.second->getTensorDesc().getDims();
+        auto itNetworkOutput = _networkOutputs.find(name);
+        auto& output = _outputs[name];
+        if (itNetworkOutput == _networkOutputs.end() || (output && output->getTensorDesc().getDims() == dims))
+            continue;
+
+        const auto& networkOutput = itNetworkOutput->second;
+        output = make_blob_with_precision({networkOutput->getPrecision(), dims, networkOutput->getLayout()});
+        output->allocate();
+    }
+}
+
 static inline void changeEdgePtr(const MKLDNNPlugin::MKLDNNEdgePtr &edge, void *newPtr) {
     edge->getMemory().GetPrimitivePtr()->set_data_handle(newPtr);
 }
 
+bool MKLDNNPlugin::MKLDNNInferRequest::canUseBlobMemory(const MKLDNNMemory& memory, const InferenceEngine::Blob::Ptr& blob) const {
+    auto memoryBlob = InferenceEngine::as<InferenceEngine::MemoryBlob>(blob);
+    if (!memoryBlob || memoryBlob->byteSize() != memory.GetSize())
+        return false;
+
+    // The blob must have the same dense layout (no ROI offsets or paddings) and precision as the graph memory
+    const auto& blobDesc = memoryBlob->getTensorDesc();
+    const InferenceEngine::TensorDesc memoryDesc = MKLDNNMemoryDesc(memory.GetDescriptor());
+    if (blobDesc.getPrecision() != memoryDesc.getPrecision() || blobDesc.getBlockingDesc() != memoryDesc.getBlockingDesc())
+        return false;
+
+    // Kernels expect at least naturally aligned elements
+    void* data = memoryBlob->buffer();
+    return reinterpret_cast<std::uintptr_t>(data) % blobDesc.getPrecision().size() == 0;
+}
+
+void MKLDNNPlugin::MKLDNNInferRequest::preprocessInputs() {
+    InferenceEngine::BlobMap inputs;
+    for (auto& input : _inputs) {
+        if (!isNormalizedByPreprocessing(input.first)) {
+            inputs[input.first] = input.second;
+            continue;
+        }
+
+        InferenceEngine::TensorDesc desc = input.second->getTensorDesc();
+        desc.setPrecision(InferenceEngine::Precision::FP32);
+        auto& normalized = normalizedInputs[input.first];
+        if (!normalized || normalized->getTensorDesc() != desc) {
+            normalized = InferenceEngine::make_shared_blob<float>(desc);
+            normalized->allocate();
+        }
+        // Resize, color conversion, conversion to FP32 and mean values are applied in a single pass,
+        // instead of converting the U8 blob and subtracting the mean image in the graph afterwards
+        _preProcData[input.first]->execute(normalized, _networkInputs[input.first]->getPreProcess(), false, m_curBatch, true);
+    }
+    execDataPreprocessing(inputs);
+}
+
+bool MKLDNNPlugin::MKLDNNInferRequest::isNormalizedByPreprocessing(const std::string& name) const {
+    if (_preProcData.find(name) == _preProcData.end() || !graph->hasMeanImageFor(name))
+        return false;
+
+    auto input = _networkInputs.find(name);
+    if (input == _networkInputs.end() || input->second->getPrecision() != InferenceEngine::Precision::U8)
+        return false;
+
+    // Only mean values are supported by the pre-processing, the graph does not apply scales
+    const auto& preProcess = input->second->getPreProcess();
+    if (preProcess.getMeanVariant() != InferenceEngine::MEAN_VALUE)
+        return false;
+    for (size_t c = 0; c < preProcess.getNumberOfChannels(); c++) {
+        if (preProcess[c]->stdScale != 1.0f)
+            return false;
+    }
+    return true;
+}
+
 void MKLDNNPlugin::MKLDNNInferRequest::changeDefaultPtr() {
-    for (auto& it : externalPtr) {
+    // Only a part of the graph memory is processed with a dynamic batch, so it is always copied
+    if (graph->getProperty().batchLimit)
+        return;
+
+    // Edges of the graph are shared by the requests of the stream, so an edge bound to a blob of another request
+    // is switched back to the graph memory if the blob of this request cannot be used
+    for (auto& it : _inputs) {
         auto input = graph->inputNodes.find(it.first);
-        if (input != graph->inputNodes.end()) {
-            if (input->second->getChildEdgeAt(0)->getMemory().GetPrimitive().get_data_handle() == it.second)
-                continue;
-            // Input cannot be in-place with other primitives
-            bool canBeInPlace = true;
-            for (size_t i = 0; canBeInPlace && i < input->second->getChildEdges().size(); i++) {
-                auto& child = input->second->getChildEdgeAt(i)->getChild();
-                if (child->isConstant())
-                    canBeInPlace = false;
+        if (input == graph->inputNodes.end())
+            THROW_IE_EXCEPTION << "Cannot find input blob: " << it.first;
+
+        // The normalized blob already has the mean values applied, so the graph can read it directly
+        const bool normalized = isNormalizedByPreprocessing(it.first);
+        const auto& blob = normalized ? normalizedInputs[it.first] : it.second;
+        auto inputEdge = input->second->getChildEdgeAt(0);
+        void* ptr = (normalized || !graph->hasMeanImageFor(it.first)) && canUseBlobMemory(inputEdge->getMemory(), blob)
+                  ? blob->buffer().as<void*>() : graph->GetDefaultEdgePtr(inputEdge);
+        if (inputEdge->getMemory().GetPrimitive().get_data_handle() == ptr)
+            continue;
+        // Input cannot be in-place with other primitives
+        bool canBeInPlace = true;
+        for (size_t i = 0; canBeInPlace && i < input->second->getChildEdges().size(); i++) {
+            auto& child = input->second->getChildEdgeAt(i)->getChild();
+            if (child->isConstant())
+                canBeInPlace = false;
 #if defined(COMPILED_CPU_MKLDNN_CONCAT_NODE)
-                auto* concat = dynamic_cast<MKLDNNConcatNode *>(child.get());
-                if (canBeInPlace && concat && concat->isOptimized())
-                    canBeInPlace = false;
+            auto* concat = dynamic_cast<MKLDNNConcatNode *>(child.get());
+            if (canBeInPlace && concat && concat->isOptimized())
+                canBeInPlace = false;
 #endif
-                // Cannot be in-place before split because split is using different ptrs without offsets
+            // Cannot be in-place before split because split is using different ptrs without offsets
 #if defined(COMPILED_CPU_MKLDNN_SPLIT_NODE)
-                auto* split = dynamic_cast<MKLDNNSplitNode *>(child.get());
-                if (canBeInPlace && split)
-                    canBeInPlace = false;
+            auto* split = dynamic_cast<MKLDNNSplitNode *>(child.get());
+            if (canBeInPlace && split)
+                canBeInPlace = false;
 #endif
 
-                if (child->isInplace())
+            if (child->isInplace())
+                canBeInPlace = false;
+            for (size_t j = 0; canBeInPlace && j < child->getChildEdges().size(); j++) {
+                if (child->getChildEdgeAt(j)->getMemory().GetPrimitive().get_data_handle() ==
+                        input->second->getChildEdgeAt(i)->getMemory().GetPrimitive().get_data_handle())
                     canBeInPlace = false;
-                for (size_t j = 0; canBeInPlace && j < child->getChildEdges().size(); j++) {
-                    if (child->getChildEdgeAt(j)->getMemory().GetPrimitive().get_data_handle() ==
-                            input->second->getChildEdgeAt(i)->getMemory().GetPrimitive().get_data_handle())
-                        canBeInPlace = false;
-                }
-            }
-            for (size_t i = 0; canBeInPlace && i < input->second->getChildEdges().size(); i++) {
-                changeEdgePtr(input->second->getChildEdgeAt(i), it.second);
             }
-            continue;
         }
+        for (size_t i = 0; canBeInPlace && i < input->second->getChildEdges().size(); i++) {
+            changeEdgePtr(input->second->getChildEdgeAt(i), ptr);
+        }
+    }
 
+    for (auto& it : _outputs) {
         MKLDNNNodePtr output;
         for (auto& out : graph->outputNodes) {
             if (out->getName() == "out_" + it.first) {
@@ -384,33 +505,35 @@ void MKLDNNPlugin::MKLDNNInferRequest::changeDefaultPtr() {
                 break;
             }
         }
-        if (output) {
-            if (output->getParentEdgeAt(0)->getMemory().GetPrimitive().get_data_handle() == it.second)
-                continue;
-            bool canBeInPlace = true;
-            void * defaultPtr = output->getParentEdgeAt(0)->getMemory().GetPrimitivePtr()->get_data_handle();
-            // Cannot be in-place after concat because concat is using different ptrs without offsets
-            auto parent = output->getParentEdgeAt(0)->getParent();
-            MKLDNNNodePtr previousParent;
-            do {
-                previousParent = parent;
-                if (parent->getChildEdges().size() != 1 || parent->isConstant() || parent->isInplace()) {
-                    canBeInPlace = false;
-                    break;
-                }
+        if (!output)
+            THROW_IE_EXCEPTION << "Cannot find output blob: " << it.first;
+
+        auto outputEdge = output->getParentEdgeAt(0);
+        void* ptr = canUseBlobMemory(outputEdge->getMemory(), it.second)
+                  ? it.second->buffer().as<void*>() : graph->GetDefaultEdgePtr(outputEdge);
+        void* currentPtr = outputEdge->getMemory().GetPrimitivePtr()->get_data_handle();
+        if (currentPtr == ptr)
+            continue;
+        bool canBeInPlace = true;
+        // Cannot be in-place after concat because concat is using different ptrs without offsets
+        auto parent = outputEdge->getParent();
+        MKLDNNNodePtr previousParent;
+        do {
+            previousParent = parent;
+            if (parent->getChildEdges().size() != 1 || parent->isConstant() || parent->isInplace()) {
+                canBeInPlace = false;
+                break;
+            }
 
-                for (size_t i = 0; i < parent->getParentEdges().size(); i++) {
-                    if (parent->getParentEdgeAt(i)->getMemory().GetPrimitivePtr()->get_data_handle() == defaultPtr) {
-                        parent = parent->getParentEdgeAt(i)->getParent();
-                        break;
-                    }
+            for (size_t i = 0; i < parent->getParentEdges().size(); i++) {
+                if (parent->getParentEdgeAt(i)->getMemory().GetPrimitivePtr()->get_data_handle() == currentPtr) {
+                    parent = parent->getParentEdgeAt(i)->getParent();
+                    break;
                 }
-            } while (previousParent != parent);
-            if (canBeInPlace)
-                changeEdgePtr(output->getParentEdgeAt(0), it.second);
-            continue;
-        }
-        THROW_IE_EXCEPTION << "Cannot find input/output blob: " << it.first;
+            }
+        } while (previousParent != parent);
+        if (canBeInPlace)
+            changeEdgePtr(outputEdge, ptr);
     }
 }
 
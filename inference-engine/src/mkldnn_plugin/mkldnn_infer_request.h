@@ -43,13 +43,31 @@ public:
 
     void SetBatch(int batch = -1) override;
 
+    void checkBlobs() override;
+
+    /**
+     * @brief Returns a number of bytes copied between the request blobs and the graph memory by the last inference
+     */
+    size_t GetCopiedBytes() const {
+        return copiedBytes;
+    }
+
 private:
-    template <typename T> void pushInput(const std::string& inputName, InferenceEngine::Blob::Ptr& inputBlob);
+    template <typename T> void pushInput(const std::string& inputName, InferenceEngine::Blob::Ptr& inputBlob, bool subtractMean = true);
 
+    void preprocessInputs();
+    bool isNormalizedByPreprocessing(const std::string& name) const;
     void changeDefaultPtr();
+    bool canUseBlobMemory(const MKLDNNMemory& memory, const InferenceEngine::Blob::Ptr& blob) const;
+    void selectGraph();
+    InferenceEngine::SizeVector refDims(const InferenceEngine::Blob::Ptr &blob) const;
+
     std::shared_ptr<MKLDNNExecNetwork>  execNetwork;
     MKLDNNGraph*                        graph = nullptr;
-    std::map<std::string, void*>        externalPtr;
+    MKLDNNGraph::Ptr                    shapedGraph;
+    size_t                              copiedBytes = 0;
+    // FP32 blobs the pre-processing writes U8 inputs to with the mean values applied
+    InferenceEngine::BlobMap            normalizedInputs;
     openvino::itt::handle_t             profilingTask;
 };
 }  // namespace MKLDNNPlugin
@@ -7,12 +7,15 @@
 #include <details/ie_exception.hpp>
 
 #include <algorithm>
+#include <limits>
+#include <utility>
 #include <vector>
 #include <map>
 
 namespace MKLDNNPlugin {
 
-MemorySolver::MemorySolver(const std::vector<Box>& boxes) : _boxes(boxes) {
+MemorySolver::MemorySolver(const std::vector<Box>& boxes, int64_t largeBoxAlignment)
+    : _boxes(boxes), _large_box_alignment(std::max<int64_t>(largeBoxAlignment, 1)) {
     int max_ts = 0;
     // TODO: add validation of data correctness:
     // 1. Box.start >= 0 and Box.finish >= -1
@@ -45,55 +48,37 @@ MemorySolver::MemorySolver(const std::vector<Box>& boxes) : _boxes(boxes) {
     _time_duration = ts_f - rm_ts_f;
 }
 
-inline bool popupTogetherWith(MemorySolver::Box &box_new, const MemorySolver::Box &box_old) {
-    if (box_new.id+box_new.size > box_old.id &&
-        box_old.id+box_old.size > box_new.id) {
-        // Move the new one up. There is an intersection
-        box_new.id = box_old.id + box_old.size;
-        return true;
-    } else {
-        return false;
+int64_t MemorySolver::solve() {
+    // Placements of strategies are compared and the first of the best ones is kept
+    const Strategy strategies[] = {Strategy::GreedyBySize, Strategy::GreedyByBreadth, Strategy::BestFit};
+
+    int64_t min_required = -1;
+    std::vector<int64_t> best_offsets;
+    for (auto strategy : strategies) {
+        std::vector<int64_t> offsets;
+        auto required = solve(strategy, offsets);
+        if (min_required == -1 || required < min_required) {
+            min_required = required;
+            best_offsets = std::move(offsets);
+        }
     }
-}
 
-int64_t MemorySolver::solve() {
-    maxTopDepth();  // at first make sure that we no need more for boxes sorted by box.start
-    std::vector<std::vector<const Box*>> time_slots(_time_duration);
-    for (auto & slot : time_slots) slot.reserve(_top_depth);  // 2D array [_time_duration][_top_depth]
-
-    // Sort be box size. First is biggest
-    // Comment this line to check other order of box putting
-    std::sort(_boxes.begin(), _boxes.end(), [](const Box& l, const Box& r)
-        { return l.size > r.size; });
-
-    int64_t _min_required = 0;
-
-    for (Box& box : _boxes) {
-        // start from bottom and will lift it up if intersect with other present
-        int64_t id = box.id;
-        box.id = 0;  // id will be used as a temp offset storage
-        bool popped_up;
-        do {
-            popped_up = false;
-            for (int i_slot = box.start; i_slot <= box.finish; i_slot++) {
-                for (auto *box_in_slot : time_slots[i_slot]) {
-                    // intersect with already stored boxes for all covered time slots
-                    // and move up the new one if needed
-                    popped_up |= popupTogetherWith(box, *box_in_slot);
-                }
-            }
-        } while (popped_up);
+    _offsets.clear();
+    for (size_t i = 0; i < _boxes.size(); i++)
+        _offsets[_boxes[i].id] = best_offsets[i];
 
-        // add current box to covered time slot
-        for (int i_slot = box.start; i_slot <= box.finish; i_slot++)
-            time_slots[i_slot].push_back(&box);
+    return min_required;
+}
 
-        // store the max top bound for each box
-        _min_required = std::max(_min_required, box.id + box.size);
-        _offsets[id] = box.id;  // TODO: move to constructor (use .insert instead of [])
-    }
+int64_t MemorySolver::solve(Strategy strategy) {
+    std::vector<int64_t> offsets;
+    auto min_required = solve(strategy, offsets);
+
+    _offsets.clear();
+    for (size_t i = 0; i < _boxes.size(); i++)
+        _offsets[_boxes[i].id] = offsets[i];
 
-    return _min_required;
+    return min_required;
 }
 
 int64_t MemorySolver::maxDepth() {
@@ -114,6 +99,138 @@ int64_t MemorySolver::getOffset(int id) const {
 
 //======== Private =============//
 
+namespace {
+
+inline int64_t alignUp(int64_t value, int64_t alignment) {
+    return (value + alignment - 1) / alignment * alignment;
+}
+
+inline bool intersectInTime(const MemorySolver::Box& l, const MemorySolver::Box& r) {
+    return l.start <= r.finish && r.start <= l.finish;
+}
+
+}  // namespace
+
+int64_t MemorySolver::solve(Strategy strategy, std::vector<int64_t>& offsets) const {
+    offsets = place(getOrder(strategy), strategy == Strategy::BestFit);
+    compact(offsets);
+
+    int64_t min_required = 0;
+    for (size_t i = 0; i < _boxes.size(); i++)
+        min_required = std::max(min_required, offsets[i] + _boxes[i].size);
+    return min_required;
+}
+
+std::vector<size_t> MemorySolver::getOrder(Strategy strategy) const {
+    // boxes are sorted by start and finish ts in the constructor, so it is the execution order
+    std::vector<size_t> order(_boxes.size());
+    for (size_t i = 0; i < order.size(); i++) order[i] = i;
+
+    auto by_size = [&](size_t l, size_t r) { return _boxes[l].size > _boxes[r].size; };
+
+    switch (strategy) {
+    case Strategy::GreedyBySize:
+        std::stable_sort(order.begin(), order.end(), by_size);
+        break;
+    case Strategy::GreedyByBreadth: {
+        // breadth of a time stamp is a total size of boxes alive at it
+        int duration = 0;
+        for (const Box& box : _boxes) duration = std::max(duration, box.finish + 1);
+        std::vector<int64_t> breadth(duration, 0);
+        for (const Box& box : _boxes)
+            for (int ts = box.start; ts <= box.finish; ts++) breadth[ts] += box.size;
+
+        std::vector<int> time_stamps(duration);
+        for (int ts = 0; ts < duration; ts++) time_stamps[ts] = ts;
+        std::stable_sort(time_stamps.begin(), time_stamps.end(), [&](int l, int r) { return breadth[l] > breadth[r]; });
+
+        order.clear();
+        std::vector<bool> ordered(_boxes.size(), false);
+        for (int ts : time_stamps) {
+            std::vector<size_t> alive;
+            for (size_t i = 0; i < _boxes.size() && _boxes[i].start <= ts; i++)
+                if (!ordered[i] && ts <= _boxes[i].finish) alive.push_back(i);
+            std::stable_sort(alive.begin(), alive.end(), by_size);
+            for (size_t i : alive) {
+                ordered[i] = true;
+                order.push_back(i);
+            }
+        }
+        break;
+    }
+    case Strategy::BestFit:
+        break;
+    default:
+        THROW_IE_EXCEPTION << "Unknown memory solver strategy";
+    }
+    return order;
+}
+
+int64_t MemorySolver::findOffset(size_t box, const std::vector<int64_t>& offsets,
+                                 const std::vector<bool>& placed, bool best_fit) const {
+    const Box& target = _boxes[box];
+    const int64_t alignment = target.size >= _large_box_alignment ? _large_box_alignment : 1;
+
+    // Mem-axis intervals occupied at the live time of the box. Boxes are sorted by start, so the ones
+    // starting after the box are skipped.
+    std::vector<std::pair<int64_t, int64_t>> occupied;
+    for (size_t i = 0; i < _boxes.size() && _boxes[i].start <= target.finish; i++) {
+        if (i != box && placed[i] && intersectInTime(target, _boxes[i]))
+            occupied.emplace_back(offsets[i], offsets[i] + _boxes[i].size);
+    }
+    std::sort(occupied.begin(), occupied.end());
+
+    int64_t best_offset = -1;
+    int64_t best_gap = std::numeric_limits<int64_t>::max();
+    int64_t bottom = 0;
+    for (const auto& interval : occupied) {
+        int64_t offset = alignUp(bottom, alignment);
+        if (offset + target.size <= interval.first) {
+            if (!best_fit)
+                return offset;
+            int64_t gap = interval.first - bottom;
+            if (gap < best_gap) {
+                best_gap = gap;
+                best_offset = offset;
+            }
+        }
+        bottom = std::max(bottom, interval.second);
+    }
+    return best_offset != -1 ? best_offset : alignUp(bottom, alignment);
+}
+
+std::vector<int64_t> MemorySolver::place(const std::vector<size_t>& order, bool best_fit) const {
+    std::vector<int64_t> offsets(_boxes.size(), 0);
+    std::vector<bool> placed(_boxes.size(), false);
+    for (size_t box : order) {
+        offsets[box] = findOffset(box, offsets, placed, best_fit);
+        placed[box] = true;
+    }
+    return offsets;
+}
+
+void MemorySolver::compact(std::vector<int64_t>& offsets) const {
+    std::vector<size_t> order(_boxes.size());
+    for (size_t i = 0; i < order.size(); i++) order[i] = i;
+    std::vector<bool> placed(_boxes.size(), true);
+
+    // The lowest gap is never above the current offset, so boxes only move down. A box may move on every pass
+    // on long chains though, so the number of passes is limited: most of the gain comes from the first ones.
+    static constexpr int maxPasses = 4;
+    for (int pass = 0; pass < maxPasses; ++pass) {
+        bool moved = false;
+        std::stable_sort(order.begin(), order.end(), [&](size_t l, size_t r) { return offsets[l] < offsets[r]; });
+        for (size_t box : order) {
+            auto offset = findOffset(box, offsets, placed, false);
+            if (offset < offsets[box]) {
+                offsets[box] = offset;
+                moved = true;
+            }
+        }
+        if (!moved) break;
+    }
+}
+
 void MemorySolver::calcDepth() {
     int64_t top_depth = 0;
     int64_t depth = 0;
@@ -10,6 +10,7 @@
 
 #include "ie_api.h"
 
+#include <stddef.h>
 #include <stdint.h>
 
 #include <vector>
@@ -42,6 +43,9 @@ namespace MKLDNNPlugin {
  *
  *  NOTE!
  *  Exec order is predefined.
+ *
+ *  The problem is NP-hard, so several heuristics (see Strategy) are tried and the best placement is taken.
+ *  The lower bound of the memory size is the maximal sum of sizes of boxes alive at the same time (maxDepth).
  */
 
 class MemorySolver {
@@ -65,14 +69,38 @@ public:
         int64_t id;
     };
 
-    explicit MemorySolver(const std::vector<Box>& boxes);
+    /** @brief Heuristic used to place boxes on the Mem axis */
+    enum class Strategy {
+        /** The biggest boxes are placed first, each one to the lowest gap it fits */
+        GreedyBySize,
+        /**
+         * Boxes alive at the time stamps of the biggest total size of alive boxes are placed first,
+         * each one to the lowest gap it fits
+         */
+        GreedyByBreadth,
+        /** Boxes are placed in the execution order, each one to the smallest gap it fits */
+        BestFit,
+    };
+
+    /**
+     * @param boxes Boxes to place
+     * @param largeBoxAlignment Offsets of boxes which size is not less than the value are aligned to it.
+     *        It allows to align big data to memory pages while the rest is packed densely.
+     */
+    explicit MemorySolver(const std::vector<Box>& boxes, int64_t largeBoxAlignment = 1);
 
     /**
-     * @brief Solve memory location with maximal reuse.
+     * @brief Solve memory location with maximal reuse. All strategies are tried and the best one is used.
      * @return Size of common memory blob required for storing all
      */
     int64_t solve();
 
+    /**
+     * @brief Solve memory location with maximal reuse using the particular strategy.
+     * @return Size of common memory blob required for storing all
+     */
+    int64_t solve(Strategy strategy);
+
     /** Provides calculated offset for specified box id */
     int64_t getOffset(int id) const;
 
@@ -84,11 +112,21 @@ public:
 private:
     std::vector<Box> _boxes;
     std::map<int64_t, int64_t> _offsets;
+    int64_t _large_box_alignment = 1;
     int64_t _top_depth = -1;
     int64_t _depth = -1;
     int _time_duration = -1;
 
     void calcDepth();
+
+    /** Places boxes in the given order and returns offsets indexed as _boxes */
+    std::vector<int64_t> place(const std::vector<size_t>& order, bool best_fit) const;
+    /** Moves each box down to the lowest gap it fits without moving the others */
+    void compact(std::vector<int64_t>& offsets) const;
+    /** Finds an offset for the box which does not intersect with the placed ones */
+    int64_t findOffset(size_t box, const std::vector<int64_t>& offsets, const std::vector<bool>& placed, bool best_fit) const;
+    std::vector<size_t> getOrder(Strategy strategy) const;
+    int64_t solve(Strategy strategy, std::vector<int64_t>& offsets) const;
 };
 
 }  // namespace MKLDNNPlugin
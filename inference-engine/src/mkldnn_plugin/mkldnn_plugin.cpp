@@ -11,6 +11,7 @@
 #include <legacy/net_pass.h>
 #include <threading/ie_executor_manager.hpp>
 #include <memory>
+#include <fstream>
 #include <ie_plugin_config.hpp>
 #include <vector>
 #include <tuple>
@@ -128,6 +129,30 @@ static void Transformation(ICNNNetwork::Ptr& clonedNetwork) {
     }
 }
 
+static ICNNNetwork::Ptr ConvertNetwork(const ICNNNetwork& network) {
+    std::shared_ptr<ICNNNetwork> clonedNetwork = cloneNetwork(network);
+    bool is_transformed = false;
+    if (clonedNetwork->getFunction()) {
+        Transformation(clonedNetwork);
+        is_transformed = true;
+    }
+    auto implNetwork = std::dynamic_pointer_cast<details::CNNNetworkImpl>(clonedNetwork);
+    if (implNetwork) {
+        // valid for CNNNetworkImpl only, while there's no API in ICNNNetwork to change network
+        ConstTransformer transformator(implNetwork.get());
+        transformator.fullTrim();
+        if (!is_transformed) {
+            NetPass::ConvertPrecision(*implNetwork, Precision::I64, Precision::I32);
+            NetPass::ConvertPrecision(*implNetwork, Precision::U64, Precision::I32);
+            NetPass::ConvertPrecision(*implNetwork, Precision::U32, Precision::I32);
+            NetPass::ConvertPrecision(*implNetwork, Precision::FP16, Precision::FP32);
+            NetPass::ConvertPrecision(*implNetwork, Precision::BOOL, Precision::U8);
+            NetPass::ConvertPrecision(*implNetwork, Precision::U16, Precision::I32);
+        }
+    }
+    return clonedNetwork;
+}
+
 InferenceEngine::ExecutableNetworkInternal::Ptr
 Engine::LoadExeNetworkImpl(const InferenceEngine::ICNNNetwork &network, const std::map<std::string, std::string> &config) {
     OV_ITT_SCOPED_TASK(itt::domains::MKLDNNPlugin, "Engine::LoadExeNetworkImpl");
@@ -159,28 +184,82 @@ Engine::LoadExeNetworkImpl(const InferenceEngine::ICNNNetwork &network, const st
         conf.batchLimit = static_cast<int>(network.getBatchSize());
     }
 
-    std::shared_ptr<ICNNNetwork> clonedNetwork = cloneNetwork(network);
-    bool is_transformed = false;
-    if (clonedNetwork->getFunction()) {
-        Transformation(clonedNetwork);
-        is_transformed = true;
+    MKLDNNExecNetwork::ReshapeCallback reshapeNetwork;
+    if (conf.dynamicShapesCacheSize > 0) {
+        if (!network.getFunction()) {
+            THROW_IE_EXCEPTION << "Dynamic input shapes are supported only for networks represented by ngraph::Function";
+        }
+        if (conf.enableDynamicBatch) {
+            THROW_IE_EXCEPTION << "Dynamic input shapes cannot be used together with the dynamic batch";
+        }
+        // the original network is kept to be reshaped and converted again for other input shapes
+        std::shared_ptr<ICNNNetwork> originalNetwork = cloneNetwork(network);
+        reshapeNetwork = [originalNetwork] (const ICNNNetwork::InputShapes& inputShapes) {
+            auto reshapedNetwork = cloneNetwork(*originalNetwork);
+            ResponseDesc resp;
+            if (OK != reshapedNetwork->reshape(inputShapes, &resp)) {
+                THROW_IE_EXCEPTION << resp.msg;
+            }
+            return ConvertNetwork(*reshapedNetwork);
+        };
     }
-    auto implNetwork = std::dynamic_pointer_cast<details::CNNNetworkImpl>(clonedNetwork);
-    if (implNetwork) {
-        // valid for CNNNetworkImpl only, while there's no API in ICNNNetwork to change network
-        ConstTransformer transformator(implNetwork.get());
-        transformator.fullTrim();
-        if (!is_transformed) {
-            NetPass::ConvertPrecision(*implNetwork, Precision::I64, Precision::I32);
-            NetPass::ConvertPrecision(*implNetwork, Precision::U64, Precision::I32);
-            NetPass::ConvertPrecision(*implNetwork, Precision::U32, Precision::I32);
-            NetPass::ConvertPrecision(*implNetwork, Precision::FP16, Precision::FP32);
-            NetPass::ConvertPrecision(*implNetwork, Precision::BOOL, Precision::U8);
-            NetPass::ConvertPrecision(*implNetwork, Precision::U16, Precision::I32);
+
+    std::shared_ptr<ICNNNetwork> batchedNetwork;
+    if (conf.requestsBatchSize > 1) {
+        if (conf.enableDynamicBatch || conf.dynamicShapesCacheSize > 0) {
+            THROW_IE_EXCEPTION << "Requests batching cannot be used together with the dynamic batch or dynamic input shapes";
+        }
+        if (network.getBatchSize() != 1) {
+            THROW_IE_EXCEPTION << "Requests batching is supported only for networks of batch 1";
+        }
+        // data of the coalesced requests is concatenated along the outermost dimension
+        auto isBatchOutermost = [] (Layout layout) {
+            return layout == Layout::NC || layout == Layout::NCHW || layout == Layout::NHWC ||
+                   layout == Layout::NCDHW || layout == Layout::NDHWC;
+        };
+        OutputsDataMap networkOutputs;
+        network.getOutputsInfo(networkOutputs);
+        for (auto&& input : _networkInputs) {
+            if (!isBatchOutermost(input.second->getLayout()))
+                THROW_IE_EXCEPTION << "Requests batching does not support input " << input.first << " of layout " << input.second->getLayout();
+        }
+        for (auto&& output : networkOutputs) {
+            if (!isBatchOutermost(output.second->getLayout()))
+                THROW_IE_EXCEPTION << "Requests batching does not support output " << output.first << " of layout " << output.second->getLayout();
         }
+
+        // the network is compiled for the maximal batch, each inference is limited by the number of coalesced requests
+        batchedNetwork = cloneNetwork(network);
+        ResponseDesc resp;
+        if (OK != batchedNetwork->setBatchSize(conf.requestsBatchSize, &resp)) {
+            THROW_IE_EXCEPTION << resp.msg;
+        }
+        conf.enableDynamicBatch = true;
+        conf.batchLimit = conf.requestsBatchSize;
+    }
+
+    auto clonedNetwork = ConvertNetwork(batchedNetwork ? *batchedNetwork : network);
+    return std::make_shared<MKLDNNExecNetwork>(*clonedNetwork, conf, extensionManager, weightsSharing, reshapeNetwork);
+}
+
+ExecutableNetwork Engine::ImportNetworkImpl(std::istream &networkModel, const std::map<std::string, std::string> &config) {
+    OV_ITT_SCOPED_TASK(itt::domains::MKLDNNPlugin, "Engine::ImportNetworkImpl");
+
+    if (GetCore() == nullptr) {
+        THROW_IE_EXCEPTION << "Please, work with CPU device via InferencEngine::Core object";
     }
 
-    return std::make_shared<MKLDNNExecNetwork>(*clonedNetwork, conf, extensionManager, weightsSharing);
+    auto execNetwork = std::make_shared<MKLDNNExecNetwork>(networkModel, engConfig, config, extensionManager, weightsSharing, GetCore());
+    execNetwork->SetPointerToPlugin(shared_from_this());
+    return make_executable_network(execNetwork);
+}
+
+IExecutableNetwork::Ptr Engine::ImportNetwork(const std::string &modelFileName, const std::map<std::string, std::string> &config) {
+    std::ifstream modelFile(modelFileName, std::ios::in | std::ios::binary);
+    if (!modelFile.is_open()) {
+        THROW_IE_EXCEPTION << "Cannot open file " << modelFileName << " to import the network";
+    }
+    return ImportNetwork(modelFile, config);
 }
 
 void Engine::SetConfig(const std::map<std::string, std::string> &config) {
@@ -223,6 +302,9 @@ Parameter Engine::GetMetric(const std::string& name, const std::map<std::string,
         metrics.push_back(METRIC_KEY(SUPPORTED_CONFIG_KEYS));
         metrics.push_back(METRIC_KEY(RANGE_FOR_ASYNC_INFER_REQUESTS));
         metrics.push_back(METRIC_KEY(RANGE_FOR_STREAMS));
+        metrics.push_back(METRIC_KEY(IMPORT_EXPORT_SUPPORT));
+        metrics.push_back(METRIC_KEY(SHARED_WEIGHTS_STORED_BYTES));
+        metrics.push_back(METRIC_KEY(SHARED_WEIGHTS_SAVED_BYTES));
         IE_SET_METRIC_RETURN(SUPPORTED_METRICS, metrics);
     } else if (name == METRIC_KEY(FULL_DEVICE_NAME)) {
         std::string brand_string;
@@ -269,6 +351,12 @@ Parameter Engine::GetMetric(const std::string& name, const std::map<std::string,
     } else if (name == METRIC_KEY(RANGE_FOR_STREAMS)) {
         std::tuple<unsigned int, unsigned int> range = std::make_tuple(1, parallel_get_max_threads());
         IE_SET_METRIC_RETURN(RANGE_FOR_STREAMS, range);
+    } else if (name == METRIC_KEY(IMPORT_EXPORT_SUPPORT)) {
+        IE_SET_METRIC_RETURN(IMPORT_EXPORT_SUPPORT, true);
+    } else if (name == METRIC_KEY(SHARED_WEIGHTS_STORED_BYTES)) {
+        IE_SET_METRIC_RETURN(SHARED_WEIGHTS_STORED_BYTES, weightsSharing.getStatistics().storedBytes);
+    } else if (name == METRIC_KEY(SHARED_WEIGHTS_SAVED_BYTES)) {
+        IE_SET_METRIC_RETURN(SHARED_WEIGHTS_SAVED_BYTES, weightsSharing.getStatistics().savedBytes);
     } else {
         THROW_IE_EXCEPTION << "Unsupported metric key " << name;
     }
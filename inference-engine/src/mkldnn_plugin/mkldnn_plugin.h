@@ -25,6 +25,14 @@ public:
     LoadExeNetworkImpl(const InferenceEngine::ICNNNetwork &network,
                        const std::map<std::string, std::string> &config) override;
 
+    using InferenceEngine::InferencePluginInternal::ImportNetwork;
+
+    InferenceEngine::IExecutableNetwork::Ptr ImportNetwork(const std::string &modelFileName,
+                                                           const std::map<std::string, std::string> &config) override;
+
+    InferenceEngine::ExecutableNetwork ImportNetworkImpl(std::istream &networkModel,
+                                                         const std::map<std::string, std::string> &config) override;
+
     void AddExtension(InferenceEngine::IExtensionPtr extension) override;
 
     void SetConfig(const std::map<std::string, std::string> &config) override;
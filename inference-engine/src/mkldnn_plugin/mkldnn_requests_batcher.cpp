@@ -0,0 +1,222 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mkldnn_requests_batcher.h"
+#include "mkldnn_batching_infer_request.h"
+#include "mkldnn_itt.h"
+
+#include <blob_factory.hpp>
+#include <blob_transform.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <iterator>
+#include <string>
+
+using namespace MKLDNNPlugin;
+using namespace InferenceEngine;
+
+namespace {
+
+bool IsInterleavedLayoutPair(Layout lhs, Layout rhs) {
+    return (lhs == NCHW && rhs == NHWC) || (lhs == NHWC && rhs == NCHW) ||
+           (lhs == NCDHW && rhs == NDHWC) || (lhs == NDHWC && rhs == NCDHW);
+}
+
+/**
+ * Copies a blob to a blob of the same precision and dimensions, but of another layout or with strides of ROI
+ */
+void CopyBlob(const Blob::Ptr &src, const Blob::Ptr &dst) {
+    const auto &srcDesc = src->getTensorDesc();
+    const auto &dstDesc = dst->getTensorDesc();
+    const auto &dims = srcDesc.getDims();
+    if (IsInterleavedLayoutPair(srcDesc.getLayout(), dstDesc.getLayout()) &&
+        dstDesc == TensorDesc{dstDesc.getPrecision(), dims, dstDesc.getLayout()}) {
+        // blob_copy is vectorized for such conversions, but supports strides of the source only
+        blob_copy(src, dst);
+        return;
+    }
+
+    // returns element strides in the order of dimensions
+    auto getStrides = [&] (const TensorDesc &desc) {
+        const auto &blockingDesc = desc.getBlockingDesc();
+        if (blockingDesc.getOrder().size() != dims.size()) {
+            THROW_IE_EXCEPTION << "Blobs of blocked layouts are not supported by batched requests";
+        }
+        SizeVector strides(dims.size());
+        for (std::size_t i = 0; i < dims.size(); ++i) {
+            strides[blockingDesc.getOrder()[i]] = blockingDesc.getStrides()[i];
+        }
+        return strides;
+    };
+    const auto srcStrides = getStrides(srcDesc);
+    const auto dstStrides = getStrides(dstDesc);
+    const auto elementSize = srcDesc.getPrecision().size();
+    auto srcData = src->cbuffer().as<const std::uint8_t*>() +
+                   srcDesc.getBlockingDesc().getOffsetPadding() * elementSize;
+    auto dstData = dst->buffer().as<std::uint8_t*>() +
+                   dstDesc.getBlockingDesc().getOffsetPadding() * elementSize;
+    SizeVector index(dims.size(), 0);
+    for (std::size_t i = 0; i < src->size(); ++i) {
+        std::size_t srcOffset = 0;
+        std::size_t dstOffset = 0;
+        for (std::size_t d = 0; d < dims.size(); ++d) {
+            srcOffset += index[d] * srcStrides[d];
+            dstOffset += index[d] * dstStrides[d];
+        }
+        std::memcpy(dstData + dstOffset * elementSize, srcData + srcOffset * elementSize, elementSize);
+        for (auto d = dims.size(); d-- > 0;) {
+            if (++index[d] < dims[d]) {
+                break;
+            }
+            index[d] = 0;
+        }
+    }
+}
+
+}  // namespace
+
+MKLDNNRequestsBatcher::MKLDNNRequestsBatcher(const std::vector<InferRequestInternal::Ptr> &batchedRequests,
+                                             std::size_t batchSize,
+                                             std::chrono::microseconds timeout,
+                                             const ITaskExecutor::Ptr &taskExecutor) :
+    _batchSize{batchSize},
+    _timeout{timeout},
+    _taskExecutor{taskExecutor},
+    _idleRequests{batchedRequests},
+    _batchSizeHistogram(batchSize + 1, 0) {
+    if (_idleRequests.empty()) {
+        THROW_IE_EXCEPTION << "No batched infer request was created";
+    }
+    _thread = std::thread{[this] { Run(); }};
+}
+
+MKLDNNRequestsBatcher::~MKLDNNRequestsBatcher() {
+    {
+        std::lock_guard<std::mutex> lock{_mutex};
+        _stop = true;
+    }
+    _queueCondVar.notify_all();
+    if (_thread.joinable()) {
+        _thread.join();
+    }
+}
+
+void MKLDNNRequestsBatcher::Enqueue(MKLDNNBatchingInferRequest *request, Task task) {
+    {
+        std::lock_guard<std::mutex> lock{_mutex};
+        _queue.push_back({request, std::move(task), Clock::now()});
+    }
+    _queueCondVar.notify_one();
+}
+
+MKLDNNRequestsBatcher::Statistics MKLDNNRequestsBatcher::GetStatistics() const {
+    std::lock_guard<std::mutex> lock{_mutex};
+    Statistics statistics;
+    statistics.batchSizeHistogram = _batchSizeHistogram;
+    if (0 != _executedRequests) {
+        statistics.averageQueueingDelay = static_cast<float>(_totalQueueingDelay / _executedRequests);
+    }
+    return statistics;
+}
+
+void MKLDNNRequestsBatcher::Run() {
+    std::unique_lock<std::mutex> lock{_mutex};
+    for (;;) {
+        _queueCondVar.wait(lock, [&] { return (_stop || !_queue.empty()) && !_idleRequests.empty(); });
+        if (_queue.empty()) {
+            // stopped and all queued requests are executed
+            break;
+        }
+
+        // Waits for other requests until the oldest one is timed out
+        auto deadline = _queue.front().queued + _timeout;
+        _queueCondVar.wait_until(lock, deadline, [&] { return _stop || _queue.size() >= _batchSize; });
+
+        auto batch = std::make_shared<Batch>();
+        auto batchEnd = std::next(_queue.begin(), std::min(_queue.size(), _batchSize));
+        batch->requests.assign(std::make_move_iterator(_queue.begin()), std::make_move_iterator(batchEnd));
+        _queue.erase(_queue.begin(), batchEnd);
+        batch->batchedRequest = std::move(_idleRequests.back());
+        _idleRequests.pop_back();
+
+        lock.unlock();
+        _taskExecutor->run([this, batch] {
+            InferBatch(*batch);
+        });
+        lock.lock();
+    }
+}
+
+void MKLDNNRequestsBatcher::InferBatch(Batch &batch) {
+    OV_ITT_SCOPED_TASK(itt::domains::MKLDNNPlugin, "MKLDNNRequestsBatcher::InferBatch");
+
+    const auto started = Clock::now();
+    auto &batchedRequest = batch.batchedRequest;
+    auto &requests = batch.requests;
+    std::exception_ptr exception;
+    try {
+        // returns a blob of batch 1 sharing the i-th request data in the batched blob
+        auto getSlice = [&] (const std::string &name, const Blob::Ptr &blob, const Blob::Ptr &batchedBlob,
+                             std::size_t i) {
+            const auto byteSize = blob->byteSize();
+            if (batchedBlob->byteSize() != byteSize * _batchSize) {
+                THROW_IE_EXCEPTION << "Blob " << name << " of size " << byteSize << " does not match the batched one of size "
+                                   << batchedBlob->byteSize();
+            }
+            const auto &batchedDesc = batchedBlob->getTensorDesc();
+            auto dims = batchedDesc.getDims();
+            dims[0] = 1;
+            return make_blob_with_precision(TensorDesc{batchedDesc.getPrecision(), dims, batchedDesc.getLayout()},
+                                            batchedBlob->buffer().as<std::uint8_t*>() + byteSize * i);
+        };
+        // blobs of the layout of the batched ones are copied as is, others are reordered
+        auto copy = [] (const Blob::Ptr &src, const Blob::Ptr &dst) {
+            if (src->getTensorDesc() == dst->getTensorDesc()) {
+                std::memcpy(dst->buffer().as<std::uint8_t*>(), src->cbuffer().as<const std::uint8_t*>(),
+                            src->byteSize());
+            } else {
+                CopyBlob(src, dst);
+            }
+        };
+
+        for (std::size_t i = 0; i < requests.size(); ++i) {
+            for (auto &&input : requests[i].request->PreprocessInputs()) {
+                Blob::Ptr batchedInput;
+                batchedRequest->GetBlob(input.first.c_str(), batchedInput);
+                copy(input.second, getSlice(input.first, input.second, batchedInput, i));
+            }
+        }
+
+        batchedRequest->SetBatch(static_cast<int>(requests.size()));
+        batchedRequest->Infer();
+
+        for (std::size_t i = 0; i < requests.size(); ++i) {
+            for (auto &&output : requests[i].request->GetOutputs()) {
+                Blob::Ptr batchedOutput;
+                batchedRequest->GetBlob(output.first.c_str(), batchedOutput);
+                copy(getSlice(output.first, output.second, batchedOutput, i), output.second);
+            }
+        }
+    } catch (...) {
+        exception = std::current_exception();
+    }
+
+    {
+        std::lock_guard<std::mutex> lock{_mutex};
+        _batchSizeHistogram[requests.size()]++;
+        for (auto &&request : requests) {
+            _totalQueueingDelay += std::chrono::duration<double, std::milli>(started - request.queued).count();
+        }
+        _executedRequests += requests.size();
+        // batched requests do not own the network, so they must not outlive the batcher in finished tasks
+        _idleRequests.push_back(std::move(batchedRequest));
+    }
+    _queueCondVar.notify_one();
+
+    for (auto &&request : requests) {
+        request.request->SetInferResult(exception);
+        request.task();
+    }
+}
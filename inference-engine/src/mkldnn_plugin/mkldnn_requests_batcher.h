@@ -0,0 +1,85 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cpp_interfaces/impl/ie_infer_request_internal.hpp>
+#include <threading/ie_itask_executor.hpp>
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace MKLDNNPlugin {
+
+class MKLDNNBatchingInferRequest;
+
+/**
+ * Coalesces concurrently started infer requests of batch 1 into inferences of requests of the maximal batch
+ *
+ * A batch is executed once it is full or the oldest queued request waits longer than the timeout.
+ * Inputs of the queued requests are copied to a batched request, its outputs are copied back after inference.
+ * The number of batched requests limits the number of batches executed simultaneously.
+ */
+class MKLDNNRequestsBatcher {
+public:
+    typedef std::shared_ptr<MKLDNNRequestsBatcher> Ptr;
+
+    struct Statistics {
+        std::vector<unsigned int> batchSizeHistogram;  // number of inferences per batch size
+        float averageQueueingDelay = 0.f;              // in milliseconds
+    };
+
+    MKLDNNRequestsBatcher(const std::vector<InferenceEngine::InferRequestInternal::Ptr> &batchedRequests,
+                          std::size_t batchSize,
+                          std::chrono::microseconds timeout,
+                          const InferenceEngine::ITaskExecutor::Ptr &taskExecutor);
+
+    ~MKLDNNRequestsBatcher();
+
+    /**
+     * @brief Queues the request to be executed in a batch
+     * @param request A request of batch 1
+     * @param task Is run when outputs of the request are filled or the batch inference fails
+     */
+    void Enqueue(MKLDNNBatchingInferRequest *request, InferenceEngine::Task task);
+
+    Statistics GetStatistics() const;
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    struct QueuedRequest {
+        MKLDNNBatchingInferRequest *request;
+        InferenceEngine::Task       task;
+        Clock::time_point           queued;
+    };
+    struct Batch {
+        InferenceEngine::InferRequestInternal::Ptr  batchedRequest;
+        std::vector<QueuedRequest>                  requests;
+    };
+
+    void Run();
+    void InferBatch(Batch &batch);
+
+    const std::size_t                                       _batchSize;
+    const std::chrono::microseconds                         _timeout;
+    InferenceEngine::ITaskExecutor::Ptr                     _taskExecutor;
+    mutable std::mutex                                      _mutex;
+    std::condition_variable                                 _queueCondVar;
+    std::deque<QueuedRequest>                               _queue;
+    std::vector<InferenceEngine::InferRequestInternal::Ptr> _idleRequests;
+    bool                                                    _stop = false;
+    std::vector<unsigned int>                               _batchSizeHistogram;
+    std::uint64_t                                           _executedRequests = 0;
+    double                                                  _totalQueueingDelay = 0.;
+    std::thread                                             _thread;
+};
+
+}  // namespace MKLDNNPlugin
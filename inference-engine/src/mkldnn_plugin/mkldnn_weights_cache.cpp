@@ -5,17 +5,106 @@
 #include "mkldnn_weights_cache.hpp"
 
 #include <ie_system_conf.h>
+#include <cstring>
 #include <memory>
+#include <sstream>
+#include <string>
 
 namespace MKLDNNPlugin {
 
 const SimpleDataHash MKLDNNWeightsSharing::simpleCRC;
 
+MKLDNNWeightsSharing::MKLDNNWeightsSharing(const Ptr& shared) : shared(shared) {}
+
+MKLDNNMemoryPtr MKLDNNWeightsSharing::findOrCreate(const std::string& layerName, size_t index,
+                                                   const InferenceEngine::Blob::Ptr& blob, const MKLDNNMemoryDesc& desc,
+                                                   std::function<MKLDNNMemoryPtr(void)> create) {
+    const auto key = GetKey(blob, desc);
+    if (shared != nullptr) {
+        // the layer name is not a part of the key, so equal weights of different layers and networks are shared
+        std::stringstream user;
+        user << static_cast<const void*>(this) << "_" << layerName;
+        return shared->findOrCreate(key, user.str(), blob, create);
+    }
+    return findOrCreate(layerName + "_" + std::to_string(index) + "_" + key, layerName, nullptr, create);
+}
+
+MKLDNNMemoryPtr MKLDNNWeightsSharing::findOrCreate(const std::string& key, const std::string& user,
+                                                   const InferenceEngine::Blob::Ptr& blob,
+                                                   const std::function<MKLDNNMemoryPtr(void)>& create) {
+    std::unique_lock<std::mutex> lock(guard);
+    auto found = sharedWeights.find(key);
+    if (found == sharedWeights.end()) {
+        found = sharedWeights.emplace(key, SharedMemory{create(), blob, {}}).first;
+    } else if (blob != nullptr && found->second.source != blob) {
+        const auto& source = found->second.source;
+        if (source->byteSize() != blob->byteSize() ||
+            0 != std::memcmp(source->cbuffer().as<const void*>(), blob->cbuffer().as<const void*>(),
+                             blob->byteSize())) {
+            // hash collision: the weights are different, so they are not cached
+            return create();
+        }
+    }
+    found->second.users[user]++;
+
+    // Every caller gets its own reference, so the cache knows when the memory is not used anymore.
+    // The reference also owns the memory, so it stays valid even if the cache is destroyed first.
+    std::weak_ptr<MKLDNNWeightsSharing> weakCache = shared_from_this();
+    MKLDNNMemoryPtr memory = found->second.memory;
+    return MKLDNNMemoryPtr(memory.get(), [weakCache, memory, key, user](MKLDNNMemory*) {
+        if (auto cache = weakCache.lock())
+            cache->release(key, user);
+    });
+}
+
+void MKLDNNWeightsSharing::release(const std::string& key, const std::string& user) {
+    std::unique_lock<std::mutex> lock(guard);
+    auto found = sharedWeights.find(key);
+    if (found == sharedWeights.end())
+        return;
+    auto& users = found->second.users;
+    auto foundUser = users.find(user);
+    if (foundUser != users.end() && 0 == --foundUser->second)
+        users.erase(foundUser);
+    if (users.empty())
+        sharedWeights.erase(found);
+}
+
+MKLDNNWeightsSharing::Statistics MKLDNNWeightsSharing::getStatistics() const {
+    std::unique_lock<std::mutex> lock(guard);
+    Statistics statistics;
+    for (auto&& sharedMemory : sharedWeights) {
+        const uint64_t size = sharedMemory.second.memory->GetSize();
+        statistics.storedBytes += size;
+        // graphs of several streams or input shapes of one network refer to the same layer, which saves nothing
+        statistics.savedBytes += size * (sharedMemory.second.users.size() - 1);
+    }
+    return statistics;
+}
+
+std::string MKLDNNWeightsSharing::GetKey(const InferenceEngine::Blob::Ptr& blob, const MKLDNNMemoryDesc& desc) {
+    const auto& blobDesc = blob->getTensorDesc();
+    std::stringstream key;
+    key << simpleCRC.hash(blob->cbuffer().as<const unsigned char*>(), blob->byteSize())
+        << "_" << blob->byteSize() << "_" << blobDesc.getPrecision().name();
+    for (auto dim : blobDesc.getDims())
+        key << "_" << dim;
+    key << "_" << static_cast<int>(desc.getDataType()) << "_" << static_cast<int>(desc.getFormat());
+    for (auto dim : desc.getDims().ToSizeVector())
+        key << "_" << dim;
+    return key.str();
+}
+
 NumaNodesWeights::NumaNodesWeights() {
     for (auto numa_id : InferenceEngine::getAvailableNUMANodes())
         _cache_map[numa_id] = std::make_shared<MKLDNNWeightsSharing>();
 }
 
+NumaNodesWeights::NumaNodesWeights(const NumaNodesWeights& shared, bool shareByContent) {
+    for (auto&& cache : shared._cache_map)
+        _cache_map[cache.first] = std::make_shared<MKLDNNWeightsSharing>(shareByContent ? cache.second : nullptr);
+}
+
 MKLDNNWeightsSharing::Ptr& NumaNodesWeights::operator[](int numa_id) {
     auto found = _cache_map.find(numa_id);
     if (found == _cache_map.end())
@@ -30,4 +119,14 @@ const MKLDNNWeightsSharing::Ptr& NumaNodesWeights::operator[](int numa_id) const
     return found->second;
 }
 
+MKLDNNWeightsSharing::Statistics NumaNodesWeights::getStatistics() const {
+    MKLDNNWeightsSharing::Statistics statistics;
+    for (auto&& cache : _cache_map) {
+        auto numaNodeStatistics = cache.second->getStatistics();
+        statistics.storedBytes += numaNodeStatistics.storedBytes;
+        statistics.savedBytes += numaNodeStatistics.savedBytes;
+    }
+    return statistics;
+}
+
 }  // namespace MKLDNNPlugin
@@ -49,28 +49,65 @@ protected:
  * Caching store of MKLDNNMemory objects
  * Will return a cached object or create new one
  *
+ * A store is created per executable network and is shared by graphs of all its streams. Weights are addressed by
+ * the layer name and content. If the store refers to a store shared by networks, the weights are addressed by
+ * content only and are kept in the shared store, so identical weights of different layers and networks are stored once.
+ * An object is released when the last reference returned by findOrCreate is released.
+ *
  * Is a thread safe
  */
-class MKLDNNWeightsSharing {
+class MKLDNNWeightsSharing : public std::enable_shared_from_this<MKLDNNWeightsSharing> {
 public:
     typedef std::shared_ptr<MKLDNNWeightsSharing> Ptr;
-    MKLDNNMemoryPtr findOrCreate(const std::string& name_hash,
-                             std::function<MKLDNNMemoryPtr(void)> create) {
-        std::unique_lock<std::mutex> lock(guard);
-        auto found = sharedWeights.find(name_hash);
-
-        MKLDNNMemoryPtr ptr;
-        if (found == sharedWeights.end() || !(ptr = found->second.lock())) {
-            ptr = create();
-            sharedWeights[name_hash] = ptr;
-        }
-        return ptr;
-    }
+
+    struct Statistics {
+        uint64_t storedBytes = 0;  // size of all stored objects
+        uint64_t savedBytes = 0;   // size of objects which were reused by other layers instead of being created again
+    };
+
+    /**
+     * @param shared A store shared by networks, or nullptr to share weights between graphs of one network only
+     */
+    explicit MKLDNNWeightsSharing(const Ptr& shared = nullptr);
+
+    /**
+     * @brief Finds weights of a layer reordered to the given memory descriptor or creates them
+     * @param layerName A name of the layer the weights belong to
+     * @param index An index of the layer internal blob
+     * @param blob Original weights
+     * @param desc A descriptor of memory the weights are reordered to
+     * @param create Creates the reordered weights if they are not found
+     */
+    MKLDNNMemoryPtr findOrCreate(const std::string& layerName, size_t index, const InferenceEngine::Blob::Ptr& blob,
+                                 const MKLDNNMemoryDesc& desc, std::function<MKLDNNMemoryPtr(void)> create);
+
+    Statistics getStatistics() const;
+
     static const SimpleDataHash& GetHashFunc () { return simpleCRC; }
 
 protected:
-    std::unordered_map<std::string, std::weak_ptr<MKLDNNMemory>> sharedWeights;
-    std::mutex guard;
+    struct SharedMemory {
+        MKLDNNMemoryPtr memory;
+        // original weights, which are compared with the ones of a found object, since the key holds a hash only
+        InferenceEngine::Blob::Ptr source;
+        // number of references per layer which uses the object
+        std::map<std::string, size_t> users;
+    };
+
+    MKLDNNMemoryPtr findOrCreate(const std::string& key, const std::string& user,
+                                 const InferenceEngine::Blob::Ptr& blob,
+                                 const std::function<MKLDNNMemoryPtr(void)>& create);
+
+    void release(const std::string& key, const std::string& user);
+
+    /**
+     * @brief Creates a key of weights which does not depend on a layer or a network the weights belong to
+     */
+    static std::string GetKey(const InferenceEngine::Blob::Ptr& blob, const MKLDNNMemoryDesc& desc);
+
+    Ptr shared;
+    std::unordered_map<std::string, SharedMemory> sharedWeights;
+    mutable std::mutex guard;
     static const SimpleDataHash simpleCRC;
 };
 
@@ -83,9 +120,18 @@ class NumaNodesWeights {
 public:
     NumaNodesWeights();
 
+    /**
+     * @brief Creates stores of one network
+     * @param shared Stores shared by networks, which are used if weights are shared by content
+     * @param shareByContent Whether weights are shared with other networks
+     */
+    NumaNodesWeights(const NumaNodesWeights& shared, bool shareByContent);
+
     MKLDNNWeightsSharing::Ptr& operator[](int i);
     const MKLDNNWeightsSharing::Ptr& operator[](int i) const;
 
+    MKLDNNWeightsSharing::Statistics getStatistics() const;
+
 private:
     std::map<int, MKLDNNWeightsSharing::Ptr> _cache_map;
 };
@@ -334,14 +334,7 @@ void MKLDNNDepthwiseNode::specificPrepareMemory5D(mkldnn::primitive_desc_iterato
 
         MKLDNNMemoryPtr ptr;
         if (weightCache != nullptr) {
-            const uint64_t data_hash = weightCache->GetHashFunc().hash(
-                    internalBlob->buffer(), internalBlob->byteSize());
-
-            const std::string string_hash = getName() + "_" + std::to_string(i)
-                                            + "_" + std::to_string(internalBlob->byteSize())
-                                            + "_" + std::to_string(data_hash);
-
-            ptr = weightCache->findOrCreate(string_hash, create);
+            ptr = weightCache->findOrCreate(getName(), i, internalBlob, intDescs[i], create);
         } else {
             ptr = create();
         }
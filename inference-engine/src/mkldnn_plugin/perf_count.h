@@ -20,6 +20,11 @@ public:
 
     uint64_t avg() { return (num == 0) ? 0 : duration / num; }
 
+    // Bounds of the latest iteration
+    std::chrono::high_resolution_clock::time_point start() const { return __start; }
+    std::chrono::high_resolution_clock::time_point finish() const { return __finish; }
+    bool executed() const { return num != 0; }
+
 private:
     void start_itr() {
         __start = std::chrono::high_resolution_clock::now();
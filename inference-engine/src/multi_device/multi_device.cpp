@@ -3,6 +3,9 @@
 //
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////
+#include <algorithm>
+#include <cmath>
+#include <limits>
 #include <string>
 #include <vector>
 #include <iostream>
@@ -79,6 +82,7 @@ MultiDeviceAsyncInferRequest::MultiDeviceAsyncInferRequest(
         void run(Task task) override {
             auto workerInferRequest = _this->_workerInferRequest;
             workerInferRequest->_task = std::move(task);
+            workerInferRequest->_startTime = std::chrono::steady_clock::now();
             workerInferRequest->_inferRequest.StartAsync();
         };
         MultiDeviceAsyncInferRequest* _this = nullptr;
@@ -116,6 +120,84 @@ MultiDeviceAsyncInferRequest::~MultiDeviceAsyncInferRequest() {
     StopAndWait();
 }
 
+// ------------------------------DeviceStatistics----------------------------
+
+constexpr int DeviceStatistics::bucketsPerOctave;
+constexpr std::size_t DeviceStatistics::numBuckets;
+constexpr double DeviceStatistics::averageLatencyWeight;
+
+DeviceStatistics::DeviceStatistics() {
+    for (auto&& bucket : _histogram) {
+        bucket = 0;
+    }
+}
+
+void DeviceStatistics::RequestStarted() {
+    ++_inflight;
+}
+
+void DeviceStatistics::RequestCompleted(double latencyMs) {
+    const auto firstInference = 0 == _inferences.load();
+    auto average = _averageLatency.load();
+    auto newAverage = 0.0;
+    do {
+        newAverage = firstInference ? latencyMs
+                                    : average + averageLatencyWeight * (latencyMs - average);
+    } while (!_averageLatency.compare_exchange_weak(average, newAverage));
+    auto maxLatency = _maxLatency.load();
+    while (maxLatency < latencyMs && !_maxLatency.compare_exchange_weak(maxLatency, latencyMs)) {}
+
+    const auto latencyUs = std::max(0.0, latencyMs * 1000.0);
+    const auto bucket = static_cast<std::size_t>(bucketsPerOctave * std::log2(latencyUs + 1.0));
+    ++_histogram[std::min(bucket, numBuckets - 1)];
+    // counters are updated after the latency, so the scheduler does not see a sampled device without the latency
+    ++_inferences;
+    --_inflight;
+}
+
+double DeviceStatistics::GetExpectedCompletionTime(std::size_t numWorkerRequests) const {
+    const auto inflight = std::max(_inflight.load(), 0);
+    if (0 == _inferences.load()) {
+        // a device without samples gets a single probe request until its latency is known
+        return 0 == inflight ? 0.0 : std::numeric_limits<double>::infinity();
+    }
+    // the device completes all the requests it is busy with and the new one, using all its worker requests in parallel
+    return (inflight + 1) * _averageLatency.load() / std::max<std::size_t>(numWorkerRequests, 1);
+}
+
+float DeviceStatistics::GetAverageLatency() const {
+    return static_cast<float>(_averageLatency.load());
+}
+
+std::vector<float> DeviceStatistics::GetLatencyPercentiles() const {
+    std::array<std::uint64_t, numBuckets> histogram;
+    std::uint64_t total = 0;
+    for (std::size_t i = 0; i < numBuckets; ++i) {
+        histogram[i] = _histogram[i].load();
+        total += histogram[i];
+    }
+    const auto maxLatency = static_cast<float>(_maxLatency.load());
+    std::vector<float> percentiles;
+    for (auto&& percentile : {0.5, 0.9, 0.99}) {
+        const auto rank = static_cast<std::uint64_t>(std::ceil(percentile * total));
+        std::uint64_t count = 0;
+        std::size_t bucket = 0;
+        for (; bucket < numBuckets - 1; ++bucket) {
+            count += histogram[bucket];
+            if (count >= rank) break;
+        }
+        // the upper bound of the bucket, which never exceeds the maximal observed latency
+        const auto latencyMs = (std::exp2(static_cast<double>(bucket + 1) / bucketsPerOctave) - 1.0) / 1000.0;
+        percentiles.push_back(0 == total ? 0.0f : std::min(static_cast<float>(latencyMs), maxLatency));
+    }
+    percentiles.push_back(maxLatency);
+    return percentiles;
+}
+
+unsigned int DeviceStatistics::GetNumberOfInferences() const {
+    return _inferences.load();
+}
+
 // ------------------------------MultiDeviceExecutableNetwork----------------------------
 
 thread_local MultiDeviceExecutableNetwork::WorkerInferRequest* MultiDeviceExecutableNetwork::_thisWorkerInferRequest = nullptr;
@@ -145,16 +227,21 @@ MultiDeviceExecutableNetwork::MultiDeviceExecutableNetwork(const DeviceMap<Infer
                                                            const std::unordered_map<std::string, InferenceEngine::Parameter>&   config,
                                                            const bool                                                           needPerfCounters) :
     InferenceEngine::ExecutableNetworkThreadSafeDefault(nullptr, std::make_shared<InferenceEngine::ImmediateExecutor>()),
-    _devicePriorities{networkDevices},
+    _devicePriorities{std::make_shared<const std::vector<DeviceInformation>>(networkDevices)},
     _networksPerDevice{networksPerDevice},
     _config{config},
     _needPerfCounters{needPerfCounters} {
     _taskExecutor.reset();
+    auto itPolicy = _config.find(MultiDeviceConfigParams::KEY_MULTI_SCHEDULING_POLICY);
+    if (itPolicy != _config.end() &&
+        itPolicy->second.as<std::string>() == MultiDeviceConfigParams::MULTI_MIN_COMPLETION_TIME) {
+        _schedulingPolicy = SchedulingPolicy::MinCompletionTime;
+    }
     for (auto&& networkValue : _networksPerDevice) {
         auto& device  = networkValue.first;
         auto& network = networkValue.second;
 
-        auto itNumRequests = std::find_if(_devicePriorities.cbegin(), _devicePriorities.cend(),
+        auto itNumRequests = std::find_if(networkDevices.cbegin(), networkDevices.cend(),
                 [&device](const DeviceInformation& d){ return d.deviceName == device;});
         unsigned int optimalNum = 0;
         try {
@@ -165,10 +252,11 @@ MultiDeviceExecutableNetwork::MultiDeviceExecutableNetwork(const DeviceMap<Infer
                     << "support OPTIMAL_NUMBER_OF_INFER_REQUESTS ExecutableNetwork metric. "
                     << "Failed to query the metric for the " << device << " with error:" << iie.what();
         }
-        const auto numRequests = (_devicePriorities.end() == itNumRequests ||
+        const auto numRequests = (networkDevices.end() == itNumRequests ||
             itNumRequests->numRequestsPerDevices == -1) ? optimalNum : itNumRequests->numRequestsPerDevices;
         auto& workerRequests = _workerRequests[device];
         auto& idleWorkerRequests = _idleWorkerRequests[device];
+        auto* statisticsPtr = &(_deviceStatistics[device]);
         workerRequests.resize(numRequests);
         auto* idleWorkerRequestsPtr = &(idleWorkerRequests);
         for (auto&& workerRequest : workerRequests) {
@@ -176,8 +264,10 @@ MultiDeviceExecutableNetwork::MultiDeviceExecutableNetwork(const DeviceMap<Infer
             auto* workerRequestPtr = &workerRequest;
             idleWorkerRequests.push(workerRequestPtr);
             workerRequest._inferRequest.SetCompletionCallback<std::function<void(InferRequest, StatusCode)>>(
-                [workerRequestPtr, this, device, idleWorkerRequestsPtr] (InferRequest , StatusCode status) mutable {
+                [workerRequestPtr, this, device, idleWorkerRequestsPtr, statisticsPtr] (InferRequest , StatusCode status) mutable {
                     IdleGuard idleGuard{workerRequestPtr, *idleWorkerRequestsPtr};
+                    statisticsPtr->RequestCompleted(std::chrono::duration<double, std::milli>(
+                        std::chrono::steady_clock::now() - workerRequestPtr->_startTime).count());
                     workerRequestPtr->_status = status;
                     {
                         auto capturedTask = std::move(workerRequestPtr->_task);
@@ -192,21 +282,51 @@ MultiDeviceExecutableNetwork::MultiDeviceExecutableNetwork(const DeviceMap<Infer
     }
 }
 
+bool MultiDeviceExecutableNetwork::ScheduleToDevice(const DeviceName& device) {
+    auto& idleWorkerRequests = _idleWorkerRequests.at(device);
+    WorkerInferRequest* workerRequestPtr = nullptr;
+    if (idleWorkerRequests.try_pop(workerRequestPtr)) {
+        IdleGuard idleGuard{workerRequestPtr, idleWorkerRequests};
+        Task inferPipelineTask;
+        if (_inferPipelineTasks.try_pop(inferPipelineTask)) {
+            _thisWorkerInferRequest = workerRequestPtr;
+            _deviceStatistics.at(device).RequestStarted();
+            inferPipelineTask();
+            idleGuard.Release();
+            return true;
+        }
+    }
+    return false;
+}
+
 void MultiDeviceExecutableNetwork::ScheduleToWorkerInferRequest() {
-    auto devices = [&] {
-        std::lock_guard<std::mutex> lock(_mutex);
-        return _devicePriorities;
-    }();
-    for (auto&& device : devices) {
-        auto& idleWorkerRequests = _idleWorkerRequests[device.deviceName];
-        WorkerInferRequest* workerRequestPtr = nullptr;
-        if (idleWorkerRequests.try_pop(workerRequestPtr)) {
-            IdleGuard idleGuard{workerRequestPtr, idleWorkerRequests};
-            Task inferPipelineTask;
-            if (_inferPipelineTasks.try_pop(inferPipelineTask)) {
-                _thisWorkerInferRequest = workerRequestPtr;
-                inferPipelineTask();
-                idleGuard.Release();
+    auto devices = std::atomic_load(&_devicePriorities);
+    if (SchedulingPolicy::Priority == _schedulingPolicy) {
+        for (auto&& device : *devices) {
+            if (ScheduleToDevice(device.deviceName)) {
+                break;
+            }
+        }
+    } else {
+        // Devices without completed requests are probed first to get their latencies.
+        // Equal expected completion times are resolved by the devices priority.
+        std::vector<std::pair<double, const DeviceInformation*>> candidates;
+        for (auto&& device : *devices) {
+            auto completionTime = _deviceStatistics.at(device.deviceName).GetExpectedCompletionTime(
+                _workerRequests.at(device.deviceName).size());
+            if (completionTime < std::numeric_limits<double>::infinity()) {
+                candidates.emplace_back(completionTime, &device);
+            }
+        }
+        std::stable_sort(candidates.begin(), candidates.end(),
+            [] (const std::pair<double, const DeviceInformation*>& lhs,
+                const std::pair<double, const DeviceInformation*>& rhs) {
+                return lhs.first < rhs.first;
+            });
+        // If the best device has no idle worker requests, the next best idle one takes the task.
+        // If no device is idle, the task waits, as the completion of any request calls the scheduler again
+        for (auto&& candidate : candidates) {
+            if (ScheduleToDevice(candidate.second->deviceName)) {
                 break;
             }
         }
@@ -223,7 +343,7 @@ void MultiDeviceExecutableNetwork::run(Task inferPipelineTask) {
 MultiDeviceExecutableNetwork::~MultiDeviceExecutableNetwork() {
     {
         std::lock_guard<std::mutex> lock(_mutex);
-        _devicePriorities.clear();
+        std::atomic_store(&_devicePriorities, std::make_shared<const std::vector<DeviceInformation>>());
     }
     _terminate = true;
     /* NOTE: The only threads that use `MultiDeviceExecutableNetwork` Context are those that are used by Worker infer requests.
@@ -276,7 +396,7 @@ void MultiDeviceExecutableNetwork::SetConfig(const std::map<std::string, Inferen
                             " device was not in the original device list!";
                 }
             }
-            _devicePriorities = metaDevices;
+            std::atomic_store(&_devicePriorities, std::make_shared<const std::vector<DeviceInformation>>(metaDevices));
 
             // update value in config
             _config[MultiDeviceConfigParams::KEY_MULTI_DEVICE_PRIORITIES] = priorities->second;
@@ -318,11 +438,32 @@ void MultiDeviceExecutableNetwork::GetMetric(const std::string &name, Parameter
             METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS),
             METRIC_KEY(SUPPORTED_METRICS),
             METRIC_KEY(NETWORK_NAME),
-            METRIC_KEY(SUPPORTED_CONFIG_KEYS)
+            METRIC_KEY(SUPPORTED_CONFIG_KEYS),
+            METRIC_KEY(MULTI_DEVICE_AVERAGE_LATENCY),
+            METRIC_KEY(MULTI_DEVICE_LATENCY_PERCENTILES),
+            METRIC_KEY(MULTI_DEVICE_INFERENCES)
         });
     } else if (name == METRIC_KEY(SUPPORTED_CONFIG_KEYS)) {
         std::vector<std::string> configKeys = { MultiDeviceConfigParams::KEY_MULTI_DEVICE_PRIORITIES };
         result = IE_SET_METRIC(SUPPORTED_CONFIG_KEYS, configKeys);
+    } else if (name == METRIC_KEY(MULTI_DEVICE_AVERAGE_LATENCY)) {
+        std::map<std::string, float> latencies;
+        for (auto&& statistics : _deviceStatistics) {
+            latencies[statistics.first] = statistics.second.GetAverageLatency();
+        }
+        result = IE_SET_METRIC(MULTI_DEVICE_AVERAGE_LATENCY, latencies);
+    } else if (name == METRIC_KEY(MULTI_DEVICE_LATENCY_PERCENTILES)) {
+        std::map<std::string, std::vector<float>> percentiles;
+        for (auto&& statistics : _deviceStatistics) {
+            percentiles[statistics.first] = statistics.second.GetLatencyPercentiles();
+        }
+        result = IE_SET_METRIC(MULTI_DEVICE_LATENCY_PERCENTILES, percentiles);
+    } else if (name == METRIC_KEY(MULTI_DEVICE_INFERENCES)) {
+        std::map<std::string, unsigned int> inferences;
+        for (auto&& statistics : _deviceStatistics) {
+            inferences[statistics.first] = statistics.second.GetNumberOfInferences();
+        }
+        result = IE_SET_METRIC(MULTI_DEVICE_INFERENCES, inferences);
     } else {
         THROW_IE_EXCEPTION << "Unsupported Network metric: " << name;
     }
@@ -422,6 +563,9 @@ Parameter MultiDeviceInferencePlugin::GetConfig(const std::string& name,
         } else {
             return { it->second };
         }
+    } else if (name == MULTI_CONFIG_KEY(SCHEDULING_POLICY)) {
+        auto it = _config.find(MULTI_CONFIG_KEY(SCHEDULING_POLICY));
+        return { it == _config.end() ? std::string{MultiDeviceConfigParams::MULTI_PRIORITY} : it->second };
     } else {
         THROW_IE_EXCEPTION << "Unsupported config key: " << name;
     }
@@ -454,6 +598,7 @@ InferenceEngine::Parameter MultiDeviceInferencePlugin::GetMetric(const std::stri
     } else if (name == METRIC_KEY(SUPPORTED_CONFIG_KEYS)) {
         std::vector<std::string> configKeys = {
             MultiDeviceConfigParams::KEY_MULTI_DEVICE_PRIORITIES,
+            MultiDeviceConfigParams::KEY_MULTI_SCHEDULING_POLICY,
             CONFIG_KEY_INTERNAL(AGGREGATED_PLUGIN)};
         IE_SET_METRIC_RETURN(SUPPORTED_CONFIG_KEYS, configKeys);
     } else {
@@ -473,11 +618,21 @@ ExecutableNetworkInternal::Ptr MultiDeviceInferencePlugin::LoadExeNetworkImpl(co
         THROW_IE_EXCEPTION << "KEY_MULTI_DEVICE_PRIORITIES key is not set for MULTI device";
     }
 
+    auto policy = fullConfig.find(MultiDeviceConfigParams::KEY_MULTI_SCHEDULING_POLICY);
+    if (policy != fullConfig.end() &&
+        policy->second != MultiDeviceConfigParams::MULTI_PRIORITY &&
+        policy->second != MultiDeviceConfigParams::MULTI_MIN_COMPLETION_TIME) {
+        THROW_IE_EXCEPTION << "Unsupported value of KEY_MULTI_SCHEDULING_POLICY: " << policy->second;
+    }
+
     auto metaDevices = ParseMetaDevices(priorities->second, fullConfig);
 
     // collect the settings that are applicable to the devices we are loading the network to
     std::unordered_map<std::string, InferenceEngine::Parameter> multiNetworkConfig;
     multiNetworkConfig.insert(*priorities);
+    if (policy != fullConfig.end()) {
+        multiNetworkConfig.insert(*policy);
+    }
 
     DeviceMap<ExecutableNetwork> executableNetworkPerDevice;
     for (auto& p : metaDevices) {
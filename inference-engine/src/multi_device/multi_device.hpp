@@ -5,7 +5,9 @@
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 #pragma once
 
+#include <array>
 #include <atomic>
+#include <chrono>
 #include <mutex>
 #include <queue>
 #include <unordered_map>
@@ -54,6 +56,34 @@ public:
     void SetBlobsToAnotherRequest(InferenceEngine::InferRequest& req);
 };
 
+// Lock-free latency statistics of a single device: the number of requests in flight, EWMA and histogram of latencies
+class DeviceStatistics {
+public:
+    DeviceStatistics();
+
+    void RequestStarted();
+    void RequestCompleted(double latencyMs);
+
+    // Expected time (in ms) a new request completes with, if it is scheduled to the device now
+    double GetExpectedCompletionTime(std::size_t numWorkerRequests) const;
+    float GetAverageLatency() const;
+    // Returns {p50, p90, p99, max} latencies in milliseconds
+    std::vector<float> GetLatencyPercentiles() const;
+    unsigned int GetNumberOfInferences() const;
+
+protected:
+    // Each octave of microseconds is split into 8 buckets which gives about 9% resolution up to ~70 minutes
+    static constexpr int bucketsPerOctave = 8;
+    static constexpr std::size_t numBuckets = 32 * bucketsPerOctave;
+    static constexpr double averageLatencyWeight = 0.2;
+
+    std::atomic<int>                                    _inflight = {0};
+    std::atomic<unsigned int>                           _inferences = {0};
+    std::atomic<double>                                 _averageLatency = {0.0};
+    std::atomic<double>                                 _maxLatency = {0.0};
+    std::array<std::atomic<std::uint64_t>, numBuckets>  _histogram;
+};
+
 #if ((IE_THREAD == IE_THREAD_TBB) || (IE_THREAD == IE_THREAD_TBB_AUTO))
 template <typename T>
 using ThreadSafeQueue = tbb::concurrent_queue<T>;
@@ -96,6 +126,11 @@ public:
         InferenceEngine::InferRequest   _inferRequest;
         Task                            _task;
         InferenceEngine::StatusCode     _status = InferenceEngine::StatusCode::OK;
+        std::chrono::steady_clock::time_point _startTime;
+    };
+    enum class SchedulingPolicy {
+        Priority,
+        MinCompletionTime
     };
     using NotBusyWorkerRequests = ThreadSafeQueue<WorkerInferRequest*>;
 
@@ -114,15 +149,19 @@ public:
     ~MultiDeviceExecutableNetwork() override;
 
     void ScheduleToWorkerInferRequest();
+    bool ScheduleToDevice(const DeviceName& device);
 
     static thread_local WorkerInferRequest*                     _thisWorkerInferRequest;
     std::atomic_bool                                            _terminate = {false};
     std::mutex                                                  _mutex;
-    std::vector<DeviceInformation>                              _devicePriorities;
+    // accessed with std::atomic_load/std::atomic_store, so the scheduler does not take the _mutex
+    std::shared_ptr<const std::vector<DeviceInformation>>       _devicePriorities;
     DeviceMap<InferenceEngine::ExecutableNetwork>               _networksPerDevice;
     ThreadSafeQueue<Task>                                       _inferPipelineTasks;
     DeviceMap<NotBusyWorkerRequests>                            _idleWorkerRequests;
     DeviceMap<std::vector<WorkerInferRequest>>                  _workerRequests;
+    DeviceMap<DeviceStatistics>                                 _deviceStatistics;
+    SchedulingPolicy                                            _schedulingPolicy = SchedulingPolicy::Priority;
     std::unordered_map<std::string, InferenceEngine::Parameter> _config;
     bool                                                        _needPerfCounters = false;
 };
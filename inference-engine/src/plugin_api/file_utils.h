@@ -138,6 +138,14 @@ inline bool fileExist(const std::basic_string<C> &fileName) {
     return fileExist(fileName.c_str());
 }
 
+/**
+ * @brief Creates a directory including all missing parent directories
+ * @ingroup ie_dev_api_file_utils
+ * @param dirPath - path to a directory to create
+ * @throws InferenceEngineException if the directory cannot be created
+ */
+INFERENCE_ENGINE_API_CPP(void) createDirectoryRecursive(const std::string& dirPath);
+
 /**
  * @brief CPP Interface function to combint path with filename. The function supports UNICODE path
  * @ingroup ie_dev_api_file_utils
@@ -186,6 +186,28 @@ void copyRow_32F(const float in[],
                  float out[],
                  int length);
 
+void normalizeRow_8U32F(const uint8_t in[],
+                        float out[],
+                        float mean,
+                        float scale,
+                        int length);
+
+void normalizeRow_32F(const float in[],
+                      float out[],
+                      float mean,
+                      float scale,
+                      int length);
+
+void calcRowNearest_8U(uint8_t dst[],
+                       const uint8_t src[],
+                       const int mapsx[],
+                       int length);
+
+void calcRowNearest_32F(float dst[],
+                        const float src[],
+                        const int mapsx[],
+                        int length);
+
 }  // namespace neon
 }  // namespace kernels
 }  // namespace gapi
@@ -557,6 +557,22 @@ void copyRow_32F(const float in[], float out[], int length) {
     copyRow_32F_impl(in, out, length);
 }
 
+void normalizeRow_8U32F(const uint8_t in[], float out[], float mean, float scale, int length) {
+    normalizeRow_impl(in, out, mean, scale, length);
+}
+
+void normalizeRow_32F(const float in[], float out[], float mean, float scale, int length) {
+    normalizeRow_impl(in, out, mean, scale, length);
+}
+
+void calcRowNearest_8U(uint8_t dst[], const uint8_t src[], const int mapsx[], int length) {
+    calcRowNearest_8U_impl(dst, src, mapsx, length);
+}
+
+void calcRowNearest_32F(float dst[], const float src[], const int mapsx[], int length) {
+    calcRowNearest_32F_impl(dst, src, mapsx, length);
+}
+
 void calcRowLinear_32F(float *dst[],
                        const float *src0[],
                        const float *src1[],
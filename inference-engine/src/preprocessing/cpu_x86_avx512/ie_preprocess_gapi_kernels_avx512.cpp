@@ -639,6 +639,14 @@ void copyRow_32F(const float in[], float out[], int length) {
     copyRow_32F_impl(in, out, length);
 }
 
+void calcRowNearest_8U(uint8_t dst[], const uint8_t src[], const int mapsx[], int length) {
+    calcRowNearest_8U_impl(dst, src, mapsx, length);
+}
+
+void calcRowNearest_32F(float dst[], const float src[], const int mapsx[], int length) {
+    calcRowNearest_32F_impl(dst, src, mapsx, length);
+}
+
 void calcRowLinear_32F(float *dst[],
                        const float *src0[],
                        const float *src1[],
@@ -200,6 +200,16 @@ void copyRow_32F(const float in[],
                  float out[],
                  int length);
 
+void calcRowNearest_8U(uint8_t dst[],
+                       const uint8_t src[],
+                       const int mapsx[],
+                       int length);
+
+void calcRowNearest_32F(float dst[],
+                        const float src[],
+                        const int mapsx[],
+                        int length);
+
 }  // namespace avx512
 }  // namespace kernels
 }  // namespace gapi
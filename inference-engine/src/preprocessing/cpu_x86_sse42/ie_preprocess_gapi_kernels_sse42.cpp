@@ -1348,6 +1348,22 @@ void copyRow_32F(const float in[],
     copyRow_32F_impl(in, out, length);
 }
 
+void normalizeRow_8U32F(const uint8_t in[], float out[], float mean, float scale, int length) {
+    normalizeRow_impl(in, out, mean, scale, length);
+}
+
+void normalizeRow_32F(const float in[], float out[], float mean, float scale, int length) {
+    normalizeRow_impl(in, out, mean, scale, length);
+}
+
+void calcRowNearest_8U(uint8_t dst[], const uint8_t src[], const int mapsx[], int length) {
+    calcRowNearest_8U_impl(dst, src, mapsx, length);
+}
+
+void calcRowNearest_32F(float dst[], const float src[], const int mapsx[], int length) {
+    calcRowNearest_32F_impl(dst, src, mapsx, length);
+}
+
 }  // namespace kernels
 }  // namespace gapi
 }  // namespace InferenceEngine
@@ -18,6 +18,7 @@
 
 #include <memory>
 #include <algorithm>
+#include <vector>
 
 namespace InferenceEngine {
 
@@ -689,6 +690,44 @@ size_t resize_get_buffer_size(Blob::Ptr inBlob, Blob::Ptr outBlob, const ResizeA
     return 0;
 }
 
+template<typename data_t>
+void resize_nearest(const Blob::Ptr inBlob, Blob::Ptr outBlob) {
+    auto dstDims = outBlob->getTensorDesc().getDims();
+    auto srcDims = inBlob->getTensorDesc().getDims();
+
+    const int dwidth = static_cast<int>(dstDims[3]);
+    const int dheight = static_cast<int>(dstDims[2]);
+    const int swidth = static_cast<int>(srcDims[3]);
+    const int sheight = static_cast<int>(srcDims[2]);
+    const int channels = static_cast<int>(srcDims[1]);
+
+    const auto& src_strides = inBlob->getTensorDesc().getBlockingDesc().getStrides();
+    const auto& dst_strides = outBlob->getTensorDesc().getBlockingDesc().getStrides();
+
+    auto *sptr = static_cast<data_t*>(inBlob->buffer()) + inBlob->getTensorDesc().getBlockingDesc().getOffsetPadding();
+    auto *dptr = static_cast<data_t*>(outBlob->buffer()) + outBlob->getTensorDesc().getBlockingDesc().getOffsetPadding();
+
+    const double scale_x = static_cast<double>(swidth) / dwidth;
+    const double scale_y = static_cast<double>(sheight) / dheight;
+
+    // the center of the destination pixel is projected to the source, the same as the G-API kernel does
+    std::vector<int> xofs(dwidth);
+    for (int dx = 0; dx < dwidth; dx++) {
+        xofs[dx] = (std::min)(static_cast<int>((dx + 0.5) * scale_x), swidth - 1);
+    }
+
+    for (int c = 0; c < channels; c++) {
+        for (int dy = 0; dy < dheight; dy++) {
+            const int sy = (std::min)(static_cast<int>((dy + 0.5) * scale_y), sheight - 1);
+            const data_t* srow = sptr + c * src_strides[1] + sy * src_strides[2];
+            data_t* drow = dptr + c * dst_strides[1] + dy * dst_strides[2];
+            for (int dx = 0; dx < dwidth; dx++) {
+                drow[dx] = srow[xofs[dx]];
+            }
+        }
+    }
+}
+
 void resize(Blob::Ptr inBlob, Blob::Ptr outBlob, const ResizeAlgorithm &algorithm) {
     if (inBlob->getTensorDesc().getLayout() != NCHW || outBlob->getTensorDesc().getLayout() != NCHW)
         THROW_IE_EXCEPTION << "Resize supports only NCHW layout";
@@ -697,6 +736,15 @@ void resize(Blob::Ptr inBlob, Blob::Ptr outBlob, const ResizeAlgorithm &algorith
           (inBlob->getTensorDesc().getPrecision() == Precision::FP32 && outBlob->getTensorDesc().getPrecision() == Precision::FP32)))
         THROW_IE_EXCEPTION << "Resize supports only U8 and FP32 precisions";
 
+    if (algorithm == RESIZE_NEAREST) {
+        if (inBlob->getTensorDesc().getPrecision() == Precision::U8) {
+            resize_nearest<uint8_t>(inBlob, outBlob);
+        } else {
+            resize_nearest<float>(inBlob, outBlob);
+        }
+        return;
+    }
+
     if (algorithm != RESIZE_BILINEAR && algorithm != RESIZE_AREA)
         THROW_IE_EXCEPTION << "Unsupported resize algorithm type";
 
@@ -749,6 +797,41 @@ void resize(Blob::Ptr inBlob, Blob::Ptr outBlob, const ResizeAlgorithm &algorith
 
 //----------------------------------------------------------------------
 
+namespace {
+
+// Converts the dense NCHW input to the FP32 output of any 4D layout applying (x - mean) * scale per channel
+template<typename data_t>
+void normalizeBlob(const Blob::Ptr &inBlob, const Blob::Ptr &outBlob, const PreprocEngine::Normalization &normalization) {
+    const auto &dims = outBlob->getTensorDesc().getDims();
+    const auto &blockingDesc = outBlob->getTensorDesc().getBlockingDesc();
+
+    // strides of the output in the logical NCHW order
+    SizeVector dstStrides(4);
+    for (size_t i = 0; i < 4; i++) {
+        dstStrides[blockingDesc.getOrder()[i]] = blockingDesc.getStrides()[i];
+    }
+
+    const auto *src = inBlob->cbuffer().as<const data_t*>() + inBlob->getTensorDesc().getBlockingDesc().getOffsetPadding();
+    auto *dst = static_cast<float*>(outBlob->buffer()) + blockingDesc.getOffsetPadding();
+
+    for (size_t n = 0; n < dims[0]; n++) {
+        for (size_t c = 0; c < dims[1]; c++) {
+            const float mean = normalization[c].first;
+            const float scale = normalization[c].second;
+            for (size_t h = 0; h < dims[2]; h++) {
+                auto *dstRow = dst + n * dstStrides[0] + c * dstStrides[1] + h * dstStrides[2];
+                for (size_t w = 0; w < dims[3]; w++) {
+                    dstRow[w * dstStrides[3]] = (static_cast<float>(*src++) - mean) * scale;
+                }
+            }
+        }
+    }
+}
+
+}  // namespace
+
+//----------------------------------------------------------------------
+
 using namespace Resize;
 
 /**
@@ -773,7 +856,8 @@ public:
 
     Blob::Ptr getRoiBlob() const override;
 
-    void execute(Blob::Ptr &outBlob, const PreProcessInfo& info, bool serial, int batchSize = -1) override;
+    void execute(Blob::Ptr &outBlob, const PreProcessInfo& info, bool serial, int batchSize = -1,
+                 bool normalize = false) override;
 
     void Release() noexcept override;
 
@@ -798,7 +882,7 @@ Blob::Ptr PreProcessData::getRoiBlob() const {
 }
 
 void PreProcessData::execute(Blob::Ptr &outBlob, const PreProcessInfo& info, bool serial,
-        int batchSize) {
+        int batchSize, bool normalize) {
     OV_ITT_SCOPED_TASK(itt::domains::IEPreproc, "Preprocessing");
 
     auto algorithm = info.getResizeAlgorithm();
@@ -815,13 +899,37 @@ void PreProcessData::execute(Blob::Ptr &outBlob, const PreProcessInfo& info, boo
 
     batchSize = PreprocEngine::getCorrectBatchSize(batchSize, _roiBlob);
 
+    PreprocEngine::Normalization normalization;
+    if (normalize) {
+        if (info.getMeanVariant() != MEAN_VALUE) {
+            THROW_IE_EXCEPTION << "Only mean values can be applied by input pre-processing";
+        }
+        if (outBlob->getTensorDesc().getPrecision() != Precision::FP32) {
+            THROW_IE_EXCEPTION << "Mean values can be applied by input pre-processing only to FP32 blobs";
+        }
+        for (size_t c = 0; c < info.getNumberOfChannels(); c++) {
+            normalization.emplace_back(info[c]->meanValue, info[c]->stdScale);
+        }
+    }
+
     if (!_preproc) {
         _preproc.reset(new PreprocEngine);
     }
-    if (_preproc->preprocessWithGAPI(_roiBlob, outBlob, algorithm, fmt, serial, batchSize)) {
+    if (_preproc->preprocessWithGAPI(_roiBlob, outBlob, algorithm, fmt, serial, batchSize, normalization,
+                                     info.getLetterbox(), info.getPadValue())) {
         return;
     }
 
+    if (info.getLetterbox() && algorithm != NO_RESIZE) {
+        THROW_IE_EXCEPTION << "Letterbox resize is unsupported in this mode. "
+                              "Use default pre-processing instead to keep the aspect ratio.";
+    }
+
+    if (_roiBlob->is<BatchedBlob>()) {
+        THROW_IE_EXCEPTION << "Batched blob pre-processing is unsupported in this mode. "
+                              "Use default pre-processing instead to process batched blobs.";
+    }
+
     if (batchSize > 1) {
         THROW_IE_EXCEPTION << "Batch pre-processing is unsupported in this mode. "
                               "Use default pre-processing instead to process batches.";
@@ -853,7 +961,23 @@ void PreProcessData::execute(Blob::Ptr &outBlob, const PreProcessInfo& info, boo
         res_in = _roiBlob;
     }
 
-    if (outBlob->getTensorDesc().getLayout() == NHWC) {
+    const auto roiPrecision = _roiBlob->getTensorDesc().getPrecision();
+    if (normalize) {
+        if (normalization.size() != outBlob->getTensorDesc().getDims()[1]) {
+            THROW_IE_EXCEPTION << "Number of mean values " << normalization.size()
+                               << " != number of channels " << outBlob->getTensorDesc().getDims()[1];
+        }
+        // resize in the input precision, then convert to FP32 and apply mean values in a single pass
+        if (!_tmp2 || _tmp2->size() != outBlob->size() || _tmp2->getTensorDesc().getPrecision() != roiPrecision) {
+            if (roiPrecision == Precision::FP32) {
+                _tmp2 = make_shared_blob<float>({Precision::FP32, outBlob->getTensorDesc().getDims(), Layout::NCHW});
+            } else {
+                _tmp2 = make_shared_blob<uint8_t>({Precision::U8, outBlob->getTensorDesc().getDims(), Layout::NCHW});
+            }
+            _tmp2->allocate();
+        }
+        res_out = _tmp2;
+    } else if (outBlob->getTensorDesc().getLayout() == NHWC) {
         if (!_tmp2 || _tmp2->size() != outBlob->size()) {
             if (outBlob->getTensorDesc().getPrecision() == Precision::FP32) {
                 _tmp2 = make_shared_blob<float>({Precision::FP32, outBlob->getTensorDesc().getDims(), Layout::NCHW});
@@ -872,7 +996,14 @@ void PreProcessData::execute(Blob::Ptr &outBlob, const PreProcessInfo& info, boo
         resize(res_in, res_out, algorithm);
     }
 
-    if (res_out == _tmp2) {
+    if (normalize) {
+        OV_ITT_SCOPED_TASK(itt::domains::IEPreproc, "Normalize");
+        if (roiPrecision == Precision::FP32) {
+            normalizeBlob<float>(_tmp2, outBlob, normalization);
+        } else {
+            normalizeBlob<uint8_t>(_tmp2, outBlob, normalization);
+        }
+    } else if (res_out == _tmp2) {
         OV_ITT_SCOPED_TASK(itt::domains::IEPreproc, "Reorder after");
         blob_copy(_tmp2, outBlob);
     }
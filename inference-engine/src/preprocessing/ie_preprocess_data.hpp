@@ -52,8 +52,11 @@ public:
      * @param info pre-processing info that specifies resize algorithm and color format.
      * @param serial disable OpenMP threading if the value set to true.
      * @param batchSize batch size for pre-processing.
+     * @param normalize apply mean values and scales of the info while converting the data to the FP32 output blob,
+     * so the plugin does not need a separate pass over the input.
      */
-    virtual void execute(Blob::Ptr &outBlob, const PreProcessInfo& info, bool serial, int batchSize = -1) = 0;
+    virtual void execute(Blob::Ptr &outBlob, const PreProcessInfo& info, bool serial, int batchSize = -1,
+                         bool normalize = false) = 0;
 
     virtual void isApplicable(const Blob::Ptr &src, const Blob::Ptr &dst) = 0;
 };
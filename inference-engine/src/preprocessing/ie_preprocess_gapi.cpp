@@ -10,6 +10,9 @@
 #include <string>
 #include <unordered_map>
 #include <functional>
+#include <iterator>
+#include <limits>
+#include <cmath>
 
 // Careful reader, don't worry -- it is not the whole OpenCV,
 // it is just a single stand-alone component of it
@@ -175,6 +178,18 @@ std::vector<std::vector<cv::gapi::own::Mat>> bind_to_blob(const I420Blob::Ptr& i
     return batched_input_plane_mats;
 }
 
+// every image of the batch is a separate blob (e.g. a decoded frame), bind each one as a batch item
+template<typename BlobTypePtr>
+std::vector<std::vector<cv::gapi::own::Mat>> bind_to_blob(const std::vector<BlobTypePtr>& inBlobs,
+                                                          int batch_size) {
+    std::vector<std::vector<cv::gapi::own::Mat>> batched_input_plane_mats(batch_size);
+    for (int i = 0; i < batch_size; ++i) {
+        batched_input_plane_mats[i] = std::move(bind_to_blob(inBlobs[i], 1)[0]);
+    }
+
+    return batched_input_plane_mats;
+}
+
 template<typename... Ts, int... IIs>
 std::vector<cv::GMat> to_vec_impl(std::tuple<Ts...> &&gmats, cv::detail::Seq<IIs...>) {
     return { std::get<IIs>(gmats)... };
@@ -393,6 +408,177 @@ G::Desc getGDesc(G::Desc in_desc_y, const MemoryBlob::Ptr &) {
     return in_desc_y;
 }
 
+// a batch of separate images is described by its first image: all images have the same geometry
+template<typename BlobTypePtr>
+void validateBlob(const std::vector<BlobTypePtr> &inBlobs) {
+    for (const auto& blob : inBlobs) {
+        validateBlob(blob);
+    }
+}
+
+template<typename BlobTypePtr>
+const std::pair<const TensorDesc&, Layout> getTensorDescAndLayout(const std::vector<BlobTypePtr> &inBlobs) {
+    return getTensorDescAndLayout(inBlobs.front());
+}
+
+template<typename BlobTypePtr>
+G::Desc getGDesc(G::Desc in_desc_y, const std::vector<BlobTypePtr> &inBlobs) {
+    return getGDesc(in_desc_y, inBlobs.front());
+}
+
+// according to the IE's current design, input blob batch size _must_ match networks's expected
+// batch size, even if the actual processing batch size (set on infer request) is different.
+template<typename BlobTypePtr>
+void validateBatchSize(const G::Desc &in_desc, const G::Desc &out_desc, const BlobTypePtr &) {
+    if (in_desc.d.N != out_desc.d.N) {
+        THROW_IE_EXCEPTION  << "Input blob batch size is invalid: (input blob) "
+                            << in_desc.d.N << " != " << out_desc.d.N << " (expected by network)";
+    }
+}
+
+// a batch of separate images may be smaller than the network's batch
+template<typename BlobTypePtr>
+void validateBatchSize(const G::Desc &in_desc, const G::Desc &out_desc, const std::vector<BlobTypePtr> &inBlobs) {
+    if (in_desc.d.N != 1 || static_cast<int>(inBlobs.size()) > out_desc.d.N) {
+        THROW_IE_EXCEPTION  << "Input blob batch size is invalid: (input blobs) "
+                            << inBlobs.size() << " > " << out_desc.d.N << " (expected by network)";
+    }
+}
+
+bool sameTensorGeometry(const TensorDesc &lhs, const TensorDesc &rhs) {
+    // strides and offsets don't matter: every image is bound with its own ones
+    return lhs.getPrecision() == rhs.getPrecision()
+        && lhs.getLayout() == rhs.getLayout()
+        && lhs.getDims() == rhs.getDims();
+}
+
+// true if all images of the batch can be processed by the same compiled graph
+bool sameGeometry(const BatchedBlob::Ptr &blob, int batch_size) {
+    const auto& first = blob->getBlob(0);
+    auto compound_first = as<CompoundBlob>(first);
+    for (int i = 1; i < batch_size; i++) {
+        const auto& item = blob->getBlob(i);
+        auto compound_item = as<CompoundBlob>(item);
+        if (compound_first && compound_item) {
+            // NV12/I420 images: every plane must match
+            for (size_t p = 0; p < compound_first->size(); p++) {
+                if (!sameTensorGeometry(compound_first->getBlob(p)->getTensorDesc(),
+                                        compound_item->getBlob(p)->getTensorDesc())) {
+                    return false;
+                }
+            }
+        } else if (!sameTensorGeometry(first->getTensorDesc(), item->getTensorDesc())) {
+            return false;
+        }
+    }
+    return true;
+}
+
+template<typename T>
+std::vector<typename T::Ptr> batchItems(const BatchedBlob::Ptr &blob, int batch_size, ColorFormat in_fmt,
+                                        const char *expected) {
+    std::vector<typename T::Ptr> items;
+    items.reserve(batch_size);
+    for (int i = 0; i < batch_size; i++) {
+        auto item = as<T>(blob->getBlob(i));
+        if (!item) {
+            THROW_IE_EXCEPTION  << "Unsupported input blob for color format " << in_fmt
+                                << ": expected " << expected;
+        }
+        items.push_back(std::move(item));
+    }
+    return items;
+}
+
+// the largest centered rectangle of the output image which keeps the input aspect ratio
+cv::gapi::own::Rect letterboxRect(const G::Dims &in, const G::Dims &out) {
+    const double scale = (std::min)(static_cast<double>(out.W) / in.W, static_cast<double>(out.H) / in.H);
+    const int width  = (std::max)(1, (std::min)(out.W, static_cast<int>(std::lround(in.W * scale))));
+    const int height = (std::max)(1, (std::min)(out.H, static_cast<int>(std::lround(in.H * scale))));
+    return cv::gapi::own::Rect((out.W - width) / 2, (out.H - height) / 2, width, height);
+}
+
+// pad value is given in the input domain, so it gets the same mean values and scales as the image
+std::vector<float> padValues(float pad_value, const PreprocEngine::Normalization &normalization, int channels) {
+    std::vector<float> values(channels, pad_value);
+    if (!normalization.empty()) {
+        if (static_cast<int>(normalization.size()) != channels) {
+            THROW_IE_EXCEPTION << "Number of mean values " << normalization.size()
+                               << " != number of channels " << channels;
+        }
+        for (int c = 0; c < channels; c++) {
+            values[c] = (pad_value - normalization[c].first) * normalization[c].second;
+        }
+    }
+    return values;
+}
+
+template<typename T> T padCast(float value) {
+    return static_cast<T>((std::max)(static_cast<float>((std::numeric_limits<T>::min)()),
+                          (std::min)(static_cast<float>((std::numeric_limits<T>::max)()), std::round(value))));
+}
+
+template<> float padCast<float>(float value) {
+    return value;
+}
+
+template<typename T>
+void fillLetterboxBorder(const MemoryBlob::Ptr &blob, const cv::gapi::own::Rect &rect,
+                         const std::vector<float> &values, int batch_size) {
+    const auto desc = G::decompose(blob);
+    T* ptr = blob->buffer().as<T*>() + blob->getTensorDesc().getBlockingDesc().getOffsetPadding();
+
+    for (int n = 0; n < batch_size; n++) {
+        for (int c = 0; c < desc.d.C; c++) {
+            const T value = padCast<T>(values[c]);
+            for (int h = 0; h < desc.d.H; h++) {
+                T* row = ptr + n * desc.s.N + c * desc.s.C + h * desc.s.H;
+                const bool inside = h >= rect.y && h < rect.y + rect.height;
+                for (int w = 0; w < desc.d.W; w++) {
+                    if (inside && w == rect.x) {
+                        w += rect.width - 1;
+                        continue;
+                    }
+                    row[w * desc.s.W] = value;
+                }
+            }
+        }
+    }
+}
+
+void fillLetterboxBorder(const MemoryBlob::Ptr &blob, const cv::gapi::own::Rect &rect,
+                         const std::vector<float> &values, int batch_size) {
+    switch (blob->getTensorDesc().getPrecision()) {
+    case Precision::U8:   fillLetterboxBorder<uint8_t>(blob, rect, values, batch_size); break;
+    case Precision::U16:  fillLetterboxBorder<uint16_t>(blob, rect, values, batch_size); break;
+    case Precision::FP32: fillLetterboxBorder<float>(blob, rect, values, batch_size); break;
+    default: THROW_IE_EXCEPTION << "Unsupported data type";
+    }
+}
+
+// shares the memory of the blob, but describes only the letterbox rectangle of every image in the batch
+MemoryBlob::Ptr letterboxBlob(const MemoryBlob::Ptr &blob, const cv::gapi::own::Rect &rect) {
+    const auto& desc = blob->getTensorDesc();
+    const auto roi_desc = make_roi_desc(desc, ROI{0, static_cast<size_t>(rect.x), static_cast<size_t>(rect.y),
+                                                  static_cast<size_t>(rect.width), static_cast<size_t>(rect.height)}, true);
+
+    // ROI descriptor covers a single image: restore the batch, it is the outermost dimension for NCHW and NHWC
+    auto dims = roi_desc.getDims();
+    dims[0] = desc.getDims()[0];
+    const auto& blk = roi_desc.getBlockingDesc();
+    auto blk_dims = blk.getBlockDims();
+    blk_dims[0] = dims[0];
+    const TensorDesc letterbox_desc(desc.getPrecision(), dims,
+        BlockingDesc(blk_dims, blk.getOrder(), blk.getOffsetPadding(), blk.getOffsetPaddingToData(), blk.getStrides()));
+
+    switch (desc.getPrecision()) {
+    case Precision::U8:   return make_shared_blob<uint8_t>(letterbox_desc, blob->buffer().as<uint8_t*>());
+    case Precision::U16:  return make_shared_blob<uint16_t>(letterbox_desc, blob->buffer().as<uint16_t*>());
+    case Precision::FP32: return make_shared_blob<float>(letterbox_desc, blob->buffer().as<float*>());
+    default: THROW_IE_EXCEPTION << "Unsupported data type";
+    }
+}
+
 class PlanarColorConversions {
     using GMats = std::vector<cv::GMat>;
     using CvtFunction = std::function<GMats(const GMats&, Layout, Layout, ResizeAlgorithm)>;
@@ -549,7 +735,8 @@ cv::GComputation buildGraph(const G::Desc &in_desc,
                             Layout out_layout,
                             ResizeAlgorithm algorithm,
                             ColorFormat input_color_format,
-                            ColorFormat output_color_format) {
+                            ColorFormat output_color_format,
+                            const PreprocEngine::Normalization& normalization) {
     // perform basic validation to ensure our assumptions about input and output are correct
     validateColorFormats(in_desc, out_desc, in_layout, out_layout, input_color_format,
         output_color_format);
@@ -572,9 +759,15 @@ cv::GComputation buildGraph(const G::Desc &in_desc,
     const auto io_color_formats = std::make_tuple(input_color_format, output_color_format);
     const bool drop_channel = (io_color_formats == std::make_tuple(ColorFormat::RGBX, ColorFormat::RGB)) ||
                               (io_color_formats == std::make_tuple(ColorFormat::BGRX, ColorFormat::BGR));
+    // YUV420 input may also be normalized to FP32 in the same pass: every resized row is converted
+    // straight away, so no full size RGB image is ever materialized
+    const bool fused_normalization = specific_yuv420_input_handling && !normalization.empty()
+                                  && out_desc.prec == CV_32F
+                                  && static_cast<int>(normalization.size()) == out_desc.d.C;
     const bool specific_case_of_preproc = ((in_layout == NHWC || specific_yuv420_input_handling)
                                         && (in_desc.d.C == 3 || specific_yuv420_input_handling || drop_channel)
-                                        && ((in_desc.prec == CV_8U) && (in_desc.prec == out_desc.prec))
+                                        && ((in_desc.prec == CV_8U) && (in_desc.prec == out_desc.prec || fused_normalization))
+                                        && (normalization.empty() || fused_normalization)
                                         && (algorithm == RESIZE_BILINEAR)
                                         && (input_color_format == ColorFormat::RAW
                                             || input_color_format == output_color_format
@@ -609,6 +802,12 @@ cv::GComputation buildGraph(const G::Desc &in_desc,
             std::reverse(planes.begin(), planes.end());
         }
 
+        if (fused_normalization) {
+            for (size_t i = 0; i < planes.size(); i++) {
+                planes[i] = gapi::NormalizePlane::on(planes[i], normalization[i].first, normalization[i].second);
+            }
+        }
+
         std::vector<cv::GMat> outputs;
         if (out_layout == NHWC) {
             outputs.emplace_back(gapi::Merge3::on(planes[0], planes[1], planes[2]));
@@ -642,6 +841,7 @@ cv::GComputation buildGraph(const G::Desc &in_desc,
             switch (ar) {
             case RESIZE_AREA:     return cv::INTER_AREA;
             case RESIZE_BILINEAR: return cv::INTER_LINEAR;
+            case RESIZE_NEAREST:  return cv::INTER_NEAREST;
             default: THROW_IE_EXCEPTION << "Unsupported resize operation";
             }
         } (algorithm);
@@ -664,7 +864,24 @@ cv::GComputation buildGraph(const G::Desc &in_desc,
         outputs = planes;
     }
 
-    if ((in_desc.prec != out_desc.prec) || need_tmp_prec_conv) {
+    if (!normalization.empty()) {
+        if (out_desc.prec != CV_32F) {
+            THROW_IE_EXCEPTION << "[G-API] mean values and scales can only be applied to FP32 output";
+        }
+        if (static_cast<int>(normalization.size()) != out_desc.d.C) {
+            THROW_IE_EXCEPTION << "[G-API] number of mean values and scales != network's expected number of channels: "
+                               << normalization.size() << " != " << out_desc.d.C;
+        }
+
+        // the conversion to FP32 and the normalization are done by the same kernel,
+        // so planes are written to the output only once
+        for (size_t i = 0; i < outputs.size(); i++) {
+            if (in_desc.prec == CV_16U && !need_tmp_prec_conv) {
+                outputs[i] = gapi::ConvertDepth::on(outputs[i], tmp_prec);
+            }
+            outputs[i] = gapi::NormalizePlane::on(outputs[i], normalization[i].first, normalization[i].second);
+        }
+    } else if ((in_desc.prec != out_desc.prec) || need_tmp_prec_conv) {
         auto convert_prec = [](const std::vector<cv::GMat> & src_gmats, int dst_precision) {
             std::vector<cv::GMat> dst_gmats;
             std::transform(src_gmats.begin(), src_gmats.end(), std::back_inserter(dst_gmats), [&](cv::GMat const& m){
@@ -684,31 +901,31 @@ cv::GComputation buildGraph(const G::Desc &in_desc,
 }
 }  // anonymous namespace
 
-PreprocEngine::PreprocEngine() : _lastComp(parallel_get_max_threads()) {}
+constexpr std::size_t PreprocEngine::_maxCachedCalls;
+
+PreprocEngine::PreprocEngine() = default;
 
-PreprocEngine::Update PreprocEngine::needUpdate(const CallDesc &newCallOrig) const {
+PreprocEngine::Update PreprocEngine::needUpdate(const CallDesc &lastCall, const CallDesc &newCallOrig) {
     // Given our knowledge about Fluid, full graph rebuild is required
     // if and only if:
-    // 0. This is the first call ever
     // 1. precision has changed (affects kernel versions)
     // 2. layout has changed (affects graph topology)
     // 3. algorithm has changed (affects kernel version)
     // 4. dimensions have changed from downscale to upscale or vice-versa if interpolation is AREA
     // 5. color format has changed (affects graph topology)
-    if (!_lastCall) {
-        return Update::REBUILD;
-    }
-
+    // 6. mean values or scales have changed (graph parameters)
     BlobDesc last_in;
     BlobDesc last_out;
     ResizeAlgorithm last_algo = ResizeAlgorithm::NO_RESIZE;
-    std::tie(last_in, last_out, last_algo) = *_lastCall;
+    Normalization last_norm;
+    std::tie(last_in, last_out, last_algo, last_norm) = lastCall;
 
     CallDesc newCall = newCallOrig;
     BlobDesc new_in;
     BlobDesc new_out;
     ResizeAlgorithm new_algo = ResizeAlgorithm::NO_RESIZE;
-    std::tie(new_in, new_out, new_algo) = newCall;
+    Normalization new_norm;
+    std::tie(new_in, new_out, new_algo, new_norm) = newCall;
 
     // Declare two empty vectors per each call
     SizeVector last_in_size;
@@ -724,7 +941,7 @@ PreprocEngine::Update PreprocEngine::needUpdate(const CallDesc &newCallOrig) con
     new_out_size.swap(std::get<2>(new_out));
 
     // If anything (except input sizes) changes, rebuild is required
-    if (last_in != new_in || last_out != new_out || last_algo != new_algo) {
+    if (last_in != new_in || last_out != new_out || last_algo != new_algo || last_norm != new_norm) {
         return Update::REBUILD;
     }
 
@@ -757,6 +974,34 @@ PreprocEngine::Update PreprocEngine::needUpdate(const CallDesc &newCallOrig) con
     return Update::NOTHING;
 }
 
+PreprocEngine::Update PreprocEngine::findCall(const CallDesc &newCall) {
+    // On success, the call found is moved to the front of the cache
+    auto hit = std::find_if(_calls.begin(), _calls.end(), [&](const CompiledCall &call) {
+        return call.desc == newCall;
+    });
+    if (hit != _calls.end()) {
+        _calls.splice(_calls.begin(), _calls, hit);
+        return Update::NOTHING;
+    }
+
+    if (_calls.size() >= _maxCachedCalls) {
+        // the cache is full: a stream of always new input sizes (ROIs) would evict graphs all
+        // the time, so reshape the oldest suitable graph rather than build a new one
+        auto suitable = std::find_if(_calls.rbegin(), _calls.rend(), [&](const CompiledCall &call) {
+            return needUpdate(call.desc, newCall) == Update::RESHAPE;
+        });
+        if (suitable != _calls.rend()) {
+            _calls.splice(_calls.begin(), _calls, std::prev(suitable.base()));
+            _calls.front().desc = newCall;
+            return Update::RESHAPE;
+        }
+        _calls.pop_back();
+    }
+
+    _calls.emplace_front(newCall, parallel_get_max_threads());
+    return Update::REBUILD;
+}
+
 bool PreprocEngine::useGAPI() {
     static const bool NO_GAPI = [](const char *str) -> bool {
         std::string var(str ? str : "");
@@ -769,6 +1014,18 @@ bool PreprocEngine::useGAPI() {
 void PreprocEngine::checkApplicabilityGAPI(const Blob::Ptr &src, const Blob::Ptr &dst) {
     // Note: src blob is the ROI blob, dst blob is the network's input blob
 
+    // batched blob: every item is pre-processed into its own batch item of dst
+    if (auto batched = src->as<BatchedBlob>()) {
+        if (dst->getTensorDesc().getDims().empty() || batched->size() > dst->getTensorDesc().getDims()[0]) {
+            THROW_IE_EXCEPTION << "Preprocessing is not applicable. Number of blobs in batched blob "
+                               << batched->size() << " exceeds network's batch size";
+        }
+        for (size_t i = 0; i < batched->size(); i++) {
+            checkApplicabilityGAPI(batched->getBlob(i), dst);
+        }
+        return;
+    }
+
     // src is either a memory blob, an NV12, or an I420 blob
     const bool yuv420_blob = src->is<NV12Blob>() || src->is<I420Blob>();
     if (!src->is<MemoryBlob>() && !yuv420_blob) {
@@ -807,7 +1064,17 @@ int PreprocEngine::getCorrectBatchSize(int batch, const Blob::Ptr& blob) {
         THROW_IE_EXCEPTION << "Input pre-processing is called with invalid batch size " << batch;
     }
 
-    if (blob->is<CompoundBlob>()) {
+    if (blob->is<BatchedBlob>()) {
+        // every underlying blob is an image of the batch
+        const int items = static_cast<int>(blob->size());
+        if (batch > items) {
+            THROW_IE_EXCEPTION  << "Provided batch size " << batch << " exceeds the number of blobs "
+                                << items << " in batched blob";
+        }
+        if (batch < 0) {
+            batch = items;
+        }
+    } else if (blob->is<CompoundBlob>()) {
         // batch size must always be 1 in compound blob case
         if (batch > 1) {
             THROW_IE_EXCEPTION  << "Provided input blob batch size " << batch
@@ -822,7 +1089,7 @@ int PreprocEngine::getCorrectBatchSize(int batch, const Blob::Ptr& blob) {
     return batch;
 }
 
-void PreprocEngine::executeGraph(Opt<cv::GComputation>& lastComputation,
+void PreprocEngine::executeGraph(CompiledCall& call,
     const std::vector<std::vector<cv::gapi::own::Mat>>& batched_input_plane_mats,
     std::vector<std::vector<cv::gapi::own::Mat>>& batched_output_plane_mats, int batch_size, bool omp_serial,
     Update update) {
@@ -836,59 +1103,69 @@ void PreprocEngine::executeGraph(Opt<cv::GComputation>& lastComputation,
     // to suppress unused warnings
     (void)(omp_serial);
 
-    // Split the whole graph into `total_slices` slices, where
-    // `total_slices` is provided by the parallel runtime and assumed
-    // to be number of threads used.  However it is not guaranteed
-    // that an actual number of threads will be as assumed, so it
+    // Split the work into `total_slices` slices, where `total_slices` is provided by the parallel
+    // runtime (i.e. by the arena of the calling stream) and assumed to be number of threads used.
+    // However it is not guaranteed that an actual number of threads will be as assumed, so it
     // possible that all slices are processed by the same thread.
     //
+    // Slices are arranged as a grid of batch groups by tiles: every slice computes the same tile
+    // (a stripe of rows) of every image of its group. Whole images are preferred as long as there
+    // are enough images in batch to occupy all threads, since every tile has its own overhead
+    // (border rows are read twice, compiled object state is cold).
     parallel_nt_static(thread_num, [&, this](int slice_n, const int total_slices) {
         OV_ITT_SCOPED_TASK(itt::domains::IEPreproc, _perf_exec_tile);
 
-        auto& compiled = _lastComp[slice_n];
-        if (Update::REBUILD == update || Update::RESHAPE == update) {
-            //  need to compile (or reshape) own object for a particular ROI
-            OV_ITT_SCOPED_TASK(itt::domains::IEPreproc, _perf_graph_compiling);
-
-            using cv::gapi::own::Rect;
-
-            // current design implies all images in batch are equal
-            const auto& input_plane_mats = batched_input_plane_mats[0];
-            const auto& output_plane_mats = batched_output_plane_mats[0];
+        const int batch_groups = (std::min)(batch_size, total_slices);
+        const int total_tiles = total_slices / batch_groups;
+        const int group_n = slice_n / total_tiles;
+        const int tile_n = slice_n % total_tiles;
+        if (group_n >= batch_groups) return;  // no job for current thread
+
+        // current design implies all images in batch are equal
+        const auto& input_plane_mats = batched_input_plane_mats[0];
+        const auto& output_plane_mats = batched_output_plane_mats[0];
+
+        auto lines_per_tile = output_plane_mats[0].rows / total_tiles;
+        const auto remainder = output_plane_mats[0].rows % total_tiles;
+
+        // remainder shows how many tiles must calculate 1 additional row. now these additions
+        // must also be addressed in rect's Y coordinate:
+        int roi_y = 0;
+        if (tile_n < remainder) {
+            lines_per_tile++;  // 1 additional row
+            roi_y = tile_n * lines_per_tile;  // all previous rois have lines+1 rows
+        } else {
+            // remainder rois have lines+1 rows, the rest prior to tile_n have lines rows
+            roi_y = remainder * (lines_per_tile + 1) + (tile_n - remainder) * lines_per_tile;
+        }
 
-            auto lines_per_thread = output_plane_mats[0].rows / total_slices;
-            const auto remainder = output_plane_mats[0].rows % total_slices;
+        if (lines_per_tile <= 0) return;  // no job for current thread
 
-            // remainder shows how many threads must calculate 1 additional row. now these additions
-            // must also be addressed in rect's Y coordinate:
-            int roi_y = 0;
-            if (slice_n < remainder) {
-                lines_per_thread++;  // 1 additional row
-                roi_y = slice_n * lines_per_thread;  // all previous rois have lines+1 rows
-            } else {
-                // remainder rois have lines+1 rows, the rest prior to slice_n have lines rows
-                roi_y =
-                    remainder * (lines_per_thread + 1) + (slice_n - remainder) * lines_per_thread;
-            }
+        using cv::gapi::own::Rect;
+        const auto roi = Rect{0, roi_y, output_plane_mats[0].cols, lines_per_tile};
 
-            if (lines_per_thread <= 0) return;  // no job for current thread
+        auto& compiled = call.compiled[slice_n];
+        auto& compiled_roi = call.tiles[slice_n];
+        // a slice may get another tile if the number of threads or batch size has changed
+        const bool recompile = !compiled || Update::REBUILD == update || !(compiled_roi == roi);
+        if (recompile || Update::RESHAPE == update) {
+            //  need to compile (or reshape) own object for a particular ROI
+            OV_ITT_SCOPED_TASK(itt::domains::IEPreproc, _perf_graph_compiling);
 
-            auto roi = Rect{0, roi_y, output_plane_mats[0].cols, lines_per_thread};
             std::vector<Rect> rois(output_plane_mats.size(), roi);
 
             // TODO: make a ROI a runtime argument to avoid
             // recompilations
             auto args = cv::compile_args(gapi::preprocKernels(), cv::GFluidOutputRois{std::move(rois)});
-            if (Update::REBUILD == update) {
-                auto& computation = lastComputation.value();
-                compiled = computation.compile(descrs_of(input_plane_mats), std::move(args));
+            if (recompile) {
+                compiled = call.computation.value().compile(descrs_of(input_plane_mats), std::move(args));
+                compiled_roi = roi;
             } else {
-                IE_ASSERT(compiled);
                 compiled.reshape(descrs_of(input_plane_mats), std::move(args));
             }
         }
 
-        for (int i = 0; i < batch_size; ++i) {
+        for (int i = group_n; i < batch_size; i += batch_groups) {
             const auto& input_plane_mats = batched_input_plane_mats[i];
             auto& output_plane_mats = batched_output_plane_mats[i];
 
@@ -906,7 +1183,7 @@ void PreprocEngine::executeGraph(Opt<cv::GComputation>& lastComputation,
 template<typename BlobTypePtr>
 bool PreprocEngine::preprocessBlob(const BlobTypePtr &inBlob, MemoryBlob::Ptr &outBlob,
     ResizeAlgorithm algorithm, ColorFormat in_fmt, ColorFormat out_fmt, bool omp_serial,
-    int batch_size) {
+    int batch_size, const Normalization& normalization, bool letterbox, float pad_value) {
 
     validateBlob(inBlob);
 
@@ -915,24 +1192,28 @@ bool PreprocEngine::preprocessBlob(const BlobTypePtr &inBlob, MemoryBlob::Ptr &o
     const auto& in_desc_ie = desc_and_layout.first;
     const auto  in_layout  = desc_and_layout.second;
 
-    const auto& out_desc_ie = outBlob->getTensorDesc();
     validateTensorDesc(in_desc_ie);
-    validateTensorDesc(out_desc_ie);
+    validateTensorDesc(outBlob->getTensorDesc());
 
+    // For YUV420, check batch via Y plane descriptor
+    const G::Desc in_desc = G::decompose(in_desc_ie);
+
+    // with letterboxing the graph only writes the centered ROI of the network's input blob,
+    // the rest of it is filled here
+    MemoryBlob::Ptr dstBlob = outBlob;
+    if (letterbox && algorithm != NO_RESIZE) {
+        const auto full_desc = G::decompose(outBlob);
+        const auto rect = letterboxRect(in_desc.d, full_desc.d);
+        const int fill_batch = batch_size > 0 ? batch_size : full_desc.d.N;
+        fillLetterboxBorder(outBlob, rect, padValues(pad_value, normalization, full_desc.d.C), fill_batch);
+        dstBlob = letterboxBlob(outBlob, rect);
+    }
 
+    const auto& out_desc_ie = dstBlob->getTensorDesc();
     const auto out_layout = out_desc_ie.getLayout();
+    const G::Desc out_desc = G::decompose(out_desc_ie);
 
-    // For YUV420, check batch via Y plane descriptor
-    const G::Desc
-        in_desc =  G::decompose(in_desc_ie),
-        out_desc = G::decompose(out_desc_ie);
-
-    // according to the IE's current design, input blob batch size _must_ match networks's expected
-    // batch size, even if the actual processing batch size (set on infer request) is different.
-    if (in_desc.d.N != out_desc.d.N) {
-        THROW_IE_EXCEPTION  << "Input blob batch size is invalid: (input blob) "
-                            << in_desc.d.N << " != " << out_desc.d.N << " (expected by network)";
-    }
+    validateBatchSize(in_desc, out_desc, inBlob);
 
     // sanity check batch size
     if (batch_size > out_desc.d.N) {
@@ -948,40 +1229,85 @@ bool PreprocEngine::preprocessBlob(const BlobTypePtr &inBlob, MemoryBlob::Ptr &o
                                             out_layout,
                                             out_desc_ie.getDims(),
                                             out_fmt },
-                                  algorithm };
-    const Update update = needUpdate(thisCall);
-
-    Opt<cv::GComputation> _lastComputation;
-    if (Update::REBUILD == update || Update::RESHAPE == update) {
-        _lastCall = cv::util::make_optional(std::move(thisCall));
-
-        if (Update::REBUILD == update) {
-            //  rebuild the graph
-            OV_ITT_SCOPED_TASK(itt::domains::IEPreproc, _perf_graph_building);
-            // FIXME: what is a correct G::Desc to be passed for NV12/I420 case?
-            auto custom_desc = getGDesc(in_desc, inBlob);
-            _lastComputation = cv::util::make_optional(
+                                  algorithm,
+                                  normalization };
+    const Update update = findCall(thisCall);
+    auto& call = _calls.front();
+
+    if (Update::REBUILD == update) {
+        //  rebuild the graph
+        OV_ITT_SCOPED_TASK(itt::domains::IEPreproc, _perf_graph_building);
+        // FIXME: what is a correct G::Desc to be passed for NV12/I420 case?
+        auto custom_desc = getGDesc(in_desc, inBlob);
+        try {
+            call.computation = cv::util::make_optional(
                 buildGraph(custom_desc,
                            out_desc,
                            in_layout,
                            out_layout,
                            algorithm,
                            in_fmt,
-                           out_fmt));
+                           out_fmt,
+                           normalization));
+        } catch (...) {
+            // don't keep the call which has no graph
+            _calls.pop_front();
+            throw;
         }
     }
 
     auto batched_input_plane_mats  = bind_to_blob(inBlob,  batch_size);
-    auto batched_output_plane_mats = bind_to_blob(outBlob, batch_size);
+    auto batched_output_plane_mats = bind_to_blob(dstBlob, batch_size);
 
-    executeGraph(_lastComputation, batched_input_plane_mats, batched_output_plane_mats, batch_size,
+    executeGraph(call, batched_input_plane_mats, batched_output_plane_mats, batch_size,
         omp_serial, update);
 
     return true;
 }
 
+bool PreprocEngine::preprocessBatched(const BatchedBlob::Ptr &inBlob, MemoryBlob::Ptr &outBlob,
+    const ResizeAlgorithm &algorithm, ColorFormat in_fmt, ColorFormat out_fmt, bool omp_serial,
+    int batch_size, const Normalization& normalization, bool letterbox, float pad_value) {
+    const auto& out_dims = outBlob->getTensorDesc().getDims();
+    if (batch_size < 0) {
+        batch_size = static_cast<int>(inBlob->size());
+    }
+    if (static_cast<size_t>(batch_size) > out_dims[0]) {
+        THROW_IE_EXCEPTION  << "Provided batch size is invalid: (provided)"
+                            << batch_size << " > " << out_dims[0] << " (expected by network)";
+    }
+
+    // Images of the same size (e.g. frames of a video stream) are processed as one batch: a single
+    // graph call for all of them, parallelized over the batch and written straight into the network's
+    // input blob
+    if (batch_size > 1 && sameGeometry(inBlob, batch_size)) {
+        switch (in_fmt) {
+        case ColorFormat::NV12:
+            return preprocessBlob(batchItems<NV12Blob>(inBlob, batch_size, in_fmt, "NV12Blob"), outBlob,
+                algorithm, in_fmt, out_fmt, omp_serial, batch_size, normalization, letterbox, pad_value);
+        case ColorFormat::I420:
+            return preprocessBlob(batchItems<I420Blob>(inBlob, batch_size, in_fmt, "I420Blob"), outBlob,
+                algorithm, in_fmt, out_fmt, omp_serial, batch_size, normalization, letterbox, pad_value);
+        default:
+            return preprocessBlob(batchItems<MemoryBlob>(inBlob, batch_size, in_fmt, "MemoryBlob"), outBlob,
+                algorithm, in_fmt, out_fmt, omp_serial, batch_size, normalization, letterbox, pad_value);
+        }
+    }
+
+    // Images of the batch may have different sizes, so every one is a separate call. It is written
+    // directly into its batch item of the network's input blob: no intermediate copies are made
+    for (int i = 0; i < batch_size; i++) {
+        Blob::Ptr outItem = outBlob->createROI(ROI{static_cast<size_t>(i), 0, 0, out_dims[3], out_dims[2]});
+        preprocessWithGAPI(inBlob->getBlob(i), outItem, algorithm, in_fmt, omp_serial, 1,
+            normalization, letterbox, pad_value);
+    }
+
+    return true;
+}
+
 bool PreprocEngine::preprocessWithGAPI(const Blob::Ptr &inBlob, Blob::Ptr &outBlob,
-        const ResizeAlgorithm& algorithm, ColorFormat in_fmt, bool omp_serial, int batch_size) {
+        const ResizeAlgorithm& algorithm, ColorFormat in_fmt, bool omp_serial, int batch_size,
+        const Normalization& normalization, bool letterbox, float pad_value) {
     if (!useGAPI()) {
         return false;
     }
@@ -994,6 +1320,11 @@ bool PreprocEngine::preprocessWithGAPI(const Blob::Ptr &inBlob, Blob::Ptr &outBl
         THROW_IE_EXCEPTION  << "Unsupported network's input blob type: expected MemoryBlob";
     }
 
+    if (auto inBatchedBlob = as<BatchedBlob>(inBlob)) {
+        return preprocessBatched(inBatchedBlob, outMemoryBlob, algorithm, in_fmt, out_fmt, omp_serial,
+            batch_size, normalization, letterbox, pad_value);
+    }
+
     // FIXME: refactor the code below. there must be a better way to handle the difference
 
     // if input color format is not NV12, a MemoryBlob is expected. otherwise, NV12Blob is expected
@@ -1005,7 +1336,7 @@ bool PreprocEngine::preprocessWithGAPI(const Blob::Ptr &inBlob, Blob::Ptr &outBl
                                 << ": expected NV12Blob";
         }
         return preprocessBlob(inNV12Blob, outMemoryBlob, algorithm, in_fmt, out_fmt, omp_serial,
-            batch_size);
+            batch_size, normalization, letterbox, pad_value);
     }
     case ColorFormat::I420: {
         auto inI420Blob = as<I420Blob>(inBlob);
@@ -1014,7 +1345,7 @@ bool PreprocEngine::preprocessWithGAPI(const Blob::Ptr &inBlob, Blob::Ptr &outBl
                                 << ": expected I420Blob";
         }
         return preprocessBlob(inI420Blob, outMemoryBlob, algorithm, in_fmt, out_fmt, omp_serial,
-            batch_size);
+            batch_size, normalization, letterbox, pad_value);
     }
 
     default:
@@ -1024,7 +1355,7 @@ bool PreprocEngine::preprocessWithGAPI(const Blob::Ptr &inBlob, Blob::Ptr &outBl
                                 << ": expected MemoryBlob";
         }
         return preprocessBlob(inMemoryBlob, outMemoryBlob, algorithm, in_fmt, out_fmt, omp_serial,
-            batch_size);
+            batch_size, normalization, letterbox, pad_value);
     }
 }
 }  // namespace InferenceEngine
@@ -8,10 +8,13 @@
 #include "ie_compound_blob.h"
 #include "ie_input_info.hpp"
 
+#include <list>
 #include <tuple>
+#include <utility>
 #include <vector>
 #include <opencv2/gapi/gcompiled.hpp>
 #include <opencv2/gapi/gcomputation.hpp>
+#include <opencv2/gapi/own/types.hpp>
 #include <opencv2/gapi/util/optional.hpp>
 #include "ie_profiling.hpp"
 #include <openvino/itt.hpp>
@@ -22,12 +25,31 @@
 namespace InferenceEngine {
 
 class PreprocEngine {
+public:
+    // per-channel mean value and scale, applied as (x - mean) * scale
+    using Normalization = std::vector<std::pair<float, float>>;
+
+private:
     using BlobDesc = std::tuple<Precision, Layout, SizeVector, ColorFormat>;
-    using CallDesc = std::tuple<BlobDesc, BlobDesc, ResizeAlgorithm>;
+    using CallDesc = std::tuple<BlobDesc, BlobDesc, ResizeAlgorithm, Normalization>;
     template<typename T> using Opt = cv::util::optional<T>;
 
-    Opt<CallDesc> _lastCall;
-    std::vector<cv::GCompiled> _lastComp;
+    // Graph compiled for a particular call: every parallel worker owns a compiled object
+    // which computes its own tile (a stripe of rows) of the output
+    struct CompiledCall {
+        CallDesc desc;
+        Opt<cv::GComputation> computation;
+        std::vector<cv::GCompiled> compiled;
+        std::vector<cv::gapi::own::Rect> tiles;
+
+        CompiledCall(const CallDesc &callDesc, int workers)
+            : desc(callDesc), compiled(workers), tiles(workers) {}
+    };
+
+    // Most recently used call goes first. Calls alternating between a few input shapes
+    // (e.g. several cameras) reuse their compiled graphs instead of rebuilding them
+    static constexpr std::size_t _maxCachedCalls = 8;
+    std::list<CompiledCall> _calls;
 
     openvino::itt::handle_t _perf_graph_building = openvino::itt::handle("Preproc Graph Building");
     openvino::itt::handle_t _perf_exec_tile = openvino::itt::handle("Preproc Calc Tile");
@@ -35,19 +57,26 @@ class PreprocEngine {
     openvino::itt::handle_t _perf_graph_compiling = openvino::itt::handle("Preproc Graph compiling");
 
     enum class Update { REBUILD, RESHAPE, NOTHING };
-    Update needUpdate(const CallDesc &newCall) const;
+    static Update needUpdate(const CallDesc &lastCall, const CallDesc &newCall);
+    Update findCall(const CallDesc &newCall);
 
-    void executeGraph(Opt<cv::GComputation>& lastComputation,
+    void executeGraph(CompiledCall& call,
                       const std::vector<std::vector<cv::gapi::own::Mat>>& src,
                       std::vector<std::vector<cv::gapi::own::Mat>>& dst,
                       int batch_size,
                       bool omp_serial,
                       Update update);
 
+    // inBlob is either a single blob holding the whole batch, or a vector of same-sized blobs,
+    // one per image of the batch
     template<typename BlobTypePtr>
     bool preprocessBlob(const BlobTypePtr &inBlob, MemoryBlob::Ptr &outBlob,
         ResizeAlgorithm algorithm, ColorFormat in_fmt, ColorFormat out_fmt, bool omp_serial,
-        int batch_size);
+        int batch_size, const Normalization& normalization, bool letterbox, float pad_value);
+
+    bool preprocessBatched(const BatchedBlob::Ptr &inBlob, MemoryBlob::Ptr &outBlob,
+        const ResizeAlgorithm &algorithm, ColorFormat in_fmt, ColorFormat out_fmt, bool omp_serial,
+        int batch_size, const Normalization& normalization, bool letterbox, float pad_value);
 
 public:
     PreprocEngine();
@@ -55,7 +84,8 @@ public:
     static void checkApplicabilityGAPI(const Blob::Ptr &src, const Blob::Ptr &dst);
     static int getCorrectBatchSize(int batch_size, const Blob::Ptr& roiBlob);
     bool preprocessWithGAPI(const Blob::Ptr &inBlob, Blob::Ptr &outBlob, const ResizeAlgorithm &algorithm,
-        ColorFormat in_fmt, bool omp_serial, int batch_size = -1);
+        ColorFormat in_fmt, bool omp_serial, int batch_size = -1, const Normalization& normalization = {},
+        bool letterbox = false, float pad_value = 0.f);
 };
 
 }  // namespace InferenceEngine
@@ -812,10 +812,21 @@ G_TYPED_KERNEL(ScalePlaneArea32f, <cv::GMat(cv::GMat, Size, int)>, "com.intel.ie
     }
 };
 
+G_TYPED_KERNEL(ScalePlaneNearest, <cv::GMat(cv::GMat, Size, int)>, "com.intel.ie.scale_plane_nearest") {
+    static cv::GMatDesc outMeta(const cv::GMatDesc &in, const Size &sz, int) {
+        GAPI_DbgAssert((in.depth == CV_8U || in.depth == CV_32F) && in.chan == 1);
+        return in.withSize(sz);
+    }
+};
+
 GAPI_COMPOUND_KERNEL(FScalePlane, ScalePlane) {
     static cv::GMat expand(cv::GMat in, int type, const Size& szIn, const Size& szOut, int interp) {
         GAPI_DbgAssert(CV_8UC1 == type || CV_32FC1 == type);
-        GAPI_DbgAssert(cv::INTER_AREA == interp || cv::INTER_LINEAR == interp);
+        GAPI_DbgAssert(cv::INTER_AREA == interp || cv::INTER_LINEAR == interp || cv::INTER_NEAREST == interp);
+
+        if (cv::INTER_NEAREST == interp) {
+            return ScalePlaneNearest::on(in, szOut, interp);
+        }
 
         if (cv::INTER_AREA == interp) {
             bool upscale = szIn.width < szOut.width || szIn.height < szOut.height;
@@ -2155,6 +2166,160 @@ GAPI_FLUID_KERNEL(FScalePlaneArea8u, ScalePlaneArea8u, true) {
     }
 };
 
+//----------------------------------------------------------------------
+
+namespace nearest {
+// Maps the center of the output pixel, so the source pixel is always inside of the fluid resize window
+static inline int map(double ratio, int outCoord, int max) {
+    int s = static_cast<int>((outCoord + 0.5) * ratio);
+    return std::min(s, max - 1);
+}
+
+struct ScratchDesc {
+    int* mapsx;
+    int* mapsy;
+
+    ScratchDesc(int outW, int /*outH*/, void* data) {
+        mapsx = reinterpret_cast<int*>(data);
+        mapsy = mapsx + outW;
+    }
+
+    static int bufSize(int outW, int outH) {
+        return static_cast<int>((outW + outH) * sizeof(int));
+    }
+};
+}  // namespace nearest
+
+static void initScratchNearest(const cv::GMatDesc& in, const Size& outSz, cv::gapi::fluid::Buffer& scratch) {
+    Size scratch_size{nearest::ScratchDesc::bufSize(outSz.width, outSz.height), 1};
+
+    cv::GMatDesc desc;
+    desc.chan = 1;
+    desc.depth = CV_8UC1;
+    desc.size = scratch_size;
+
+    cv::gapi::fluid::Buffer buffer(desc);
+    scratch = std::move(buffer);
+
+    nearest::ScratchDesc scr(outSz.width, outSz.height, scratch.OutLineB());
+
+    double hRatio = ratio(in.size.width, outSz.width);
+    double vRatio = ratio(in.size.height, outSz.height);
+
+    for (int x = 0; x < outSz.width; x++) {
+        scr.mapsx[x] = nearest::map(hRatio, x, in.size.width);
+    }
+    for (int y = 0; y < outSz.height; y++) {
+        scr.mapsy[y] = nearest::map(vRatio, y, in.size.height);
+    }
+}
+
+static void calcRowNearestRow(uint8_t* dst, const uint8_t* src, const int* mapsx, int length) {
+    #ifdef HAVE_AVX512
+    if (with_cpu_x86_avx512_core()) {
+        avx512::calcRowNearest_8U(dst, src, mapsx, length);
+        return;
+    }
+    #endif  // HAVE_AVX512
+
+    #ifdef HAVE_AVX2
+    if (with_cpu_x86_avx2()) {
+        avx::calcRowNearest_8U(dst, src, mapsx, length);
+        return;
+    }
+    #endif  // HAVE_AVX2
+    #ifdef HAVE_SSE
+    if (with_cpu_x86_sse42()) {
+        calcRowNearest_8U(dst, src, mapsx, length);
+        return;
+    }
+    #endif  // HAVE_SSE
+
+    #ifdef HAVE_NEON
+    neon::calcRowNearest_8U(dst, src, mapsx, length);
+    return;
+    #endif  // HAVE_NEON
+
+    for (int x = 0; x < length; x++) {
+        dst[x] = src[mapsx[x]];
+    }
+}
+
+static void calcRowNearestRow(float* dst, const float* src, const int* mapsx, int length) {
+    #ifdef HAVE_AVX512
+    if (with_cpu_x86_avx512_core()) {
+        avx512::calcRowNearest_32F(dst, src, mapsx, length);
+        return;
+    }
+    #endif  // HAVE_AVX512
+
+    #ifdef HAVE_AVX2
+    if (with_cpu_x86_avx2()) {
+        avx::calcRowNearest_32F(dst, src, mapsx, length);
+        return;
+    }
+    #endif  // HAVE_AVX2
+    #ifdef HAVE_SSE
+    if (with_cpu_x86_sse42()) {
+        calcRowNearest_32F(dst, src, mapsx, length);
+        return;
+    }
+    #endif  // HAVE_SSE
+
+    #ifdef HAVE_NEON
+    neon::calcRowNearest_32F(dst, src, mapsx, length);
+    return;
+    #endif  // HAVE_NEON
+
+    for (int x = 0; x < length; x++) {
+        dst[x] = src[mapsx[x]];
+    }
+}
+
+template<typename T>
+static void calcRowNearest(const cv::gapi::fluid::View  & in,
+                                 cv::gapi::fluid::Buffer& out,
+                                 cv::gapi::fluid::Buffer& scratch) {
+    const auto outSz = out.meta().size;
+    const int inY = in.y();
+    const int outY = out.y();
+    const int lpi = out.lpi();
+    GAPI_DbgAssert(outY + lpi <= outSz.height);
+
+    nearest::ScratchDesc scr(outSz.width, outSz.height, scratch.OutLineB());
+
+    for (int l = 0; l < lpi; l++) {
+        const T* src = in.InLine<const T>(scr.mapsy[outY + l] - inY);
+        calcRowNearestRow(out.OutLine<T>(l), src, scr.mapsx, out.length());
+    }
+}
+
+GAPI_FLUID_KERNEL(FScalePlaneNearest, ScalePlaneNearest, true) {
+    static const int Window = 1;
+    static const int LPI = 4;
+    static const auto Kind = cv::GFluidKernel::Kind::Resize;
+
+    static void initScratch(const cv::GMatDesc& in,
+                            Size outSz, int /*interp*/,
+                            cv::gapi::fluid::Buffer &scratch) {
+        initScratchNearest(in, outSz, scratch);
+    }
+
+    static void resetScratch(cv::gapi::fluid::Buffer& /*scratch*/) {
+    }
+
+    static void run(const cv::gapi::fluid::View& in, Size /*sz*/, int /*interp*/,
+                    cv::gapi::fluid::Buffer& out, cv::gapi::fluid::Buffer &scratch) {
+        if (in.meta().depth == CV_8U) {
+            calcRowNearest<uint8_t>(in, out, scratch);
+        } else {
+            calcRowNearest<float>(in, out, scratch);
+        }
+    }
+};
+
+//----------------------------------------------------------------------
+
 static const int ITUR_BT_601_CY = 1220542;
 static const int ITUR_BT_601_CUB = 2116026;
 static const int ITUR_BT_601_CUG = -409993;
@@ -2380,6 +2545,76 @@ GAPI_FLUID_KERNEL(FConvertDepth, ConvertDepth, false) {
     }
 };
 
+template<typename T>
+static void normalizeRow(const T* in, float* out, float mean, float scale, int length);
+
+template<>
+void normalizeRow<uint8_t>(const uint8_t* in, float* out, float mean, float scale, int length) {
+    #ifdef HAVE_AVX2
+    if (with_cpu_x86_avx2()) {
+        avx::normalizeRow_8U32F(in, out, mean, scale, length);
+        return;
+    }
+    #endif  // HAVE_AVX2
+    #ifdef HAVE_SSE
+    if (with_cpu_x86_sse42()) {
+        normalizeRow_8U32F(in, out, mean, scale, length);
+        return;
+    }
+    #endif  // HAVE_SSE
+
+    #ifdef HAVE_NEON
+    neon::normalizeRow_8U32F(in, out, mean, scale, length);
+    return;
+    #endif  // HAVE_NEON
+
+    for (int x = 0; x < length; x++) {
+        out[x] = (static_cast<float>(in[x]) - mean) * scale;
+    }
+}
+
+template<>
+void normalizeRow<float>(const float* in, float* out, float mean, float scale, int length) {
+    #ifdef HAVE_AVX2
+    if (with_cpu_x86_avx2()) {
+        avx::normalizeRow_32F(in, out, mean, scale, length);
+        return;
+    }
+    #endif  // HAVE_AVX2
+    #ifdef HAVE_SSE
+    if (with_cpu_x86_sse42()) {
+        normalizeRow_32F(in, out, mean, scale, length);
+        return;
+    }
+    #endif  // HAVE_SSE
+
+    #ifdef HAVE_NEON
+    neon::normalizeRow_32F(in, out, mean, scale, length);
+    return;
+    #endif  // HAVE_NEON
+
+    for (int x = 0; x < length; x++) {
+        out[x] = (in[x] - mean) * scale;
+    }
+}
+
+GAPI_FLUID_KERNEL(FNormalizePlane, NormalizePlane, false) {
+    static const int Window = 1;
+
+    static void run(const cv::gapi::fluid::View& in, float mean, float scale, cv::gapi::fluid::Buffer& out) {
+        GAPI_DbgAssert(in.meta().depth == CV_8U || in.meta().depth == CV_32F);
+        GAPI_DbgAssert(out.meta().depth == CV_32F);
+        GAPI_DbgAssert(in.length() == out.length());
+
+        auto outRow = out.OutLine<float>();
+        if (in.meta().depth == CV_8U) {
+            normalizeRow(in.InLine<const uint8_t>(0), outRow, mean, scale, out.length());
+        } else {
+            normalizeRow(in.InLine<const float>(0), outRow, mean, scale, out.length());
+        }
+    }
+};
+
 }  // namespace kernels
 
 //----------------------------------------------------------------------
@@ -2398,6 +2633,7 @@ cv::gapi::GKernelPackage preprocKernels() {
         , FUpscalePlaneArea32f
         , FScalePlaneArea8u
         , FScalePlaneArea32f
+        , FScalePlaneNearest
         , FMerge2
         , FMerge3
         , FMerge4
@@ -2407,6 +2643,7 @@ cv::gapi::GKernelPackage preprocKernels() {
         , FNV12toRGB
         , FI420toRGB
         , FConvertDepth
+        , FNormalizePlane
         >();
 }
 
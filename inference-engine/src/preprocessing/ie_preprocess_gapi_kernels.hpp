@@ -152,6 +152,16 @@ namespace gapi {
         }
     };
 
+    // out = (in - mean) * scale, the plane is converted to FP32 in the same pass
+    G_TYPED_KERNEL(NormalizePlane, <cv::GMat(cv::GMat, float mean, float scale)>, "com.intel.ie.normalize_plane") {
+        static cv::GMatDesc outMeta(const cv::GMatDesc& in, float, float) {
+            GAPI_Assert(in.depth == CV_8U || in.depth == CV_32F);
+            GAPI_Assert(in.chan == 1);
+
+            return in.withDepth(CV_32F);
+        }
+    };
+
 
 
     cv::gapi::GKernelPackage preprocKernels();
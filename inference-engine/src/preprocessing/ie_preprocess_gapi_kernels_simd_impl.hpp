@@ -783,6 +783,88 @@ inline void copyRow_32F_impl(const float in[], float out[], int length) {
     }
 }
 
+#if MANUAL_SIMD
+static inline v_float32 normalizeRow_load(const uint8_t* in) {
+    return v_cvt_f32(v_reinterpret_as_s32(vx_load_expand_q(in)));
+}
+
+static inline v_float32 normalizeRow_load(const float* in) {
+    return vx_load(in);
+}
+#endif
+
+// Normalize (out = (in - mean) * scale), 8U or 32F -> 32F
+template<typename T>
+inline void normalizeRow_impl(const T in[], float out[], float mean, float scale, int length) {
+    int l = 0;
+
+#if MANUAL_SIMD
+    const int nlanes = v_float32::nlanes;
+    const v_float32 vmean  = vx_setall_f32(mean);
+    const v_float32 vscale = vx_setall_f32(scale);
+
+    for (; l <= length - nlanes; l += nlanes) {
+        vx_store(&out[l], (normalizeRow_load(&in[l]) - vmean) * vscale);
+    }
+
+    if (l < length && length >= nlanes) {
+        l = length - nlanes;
+        vx_store(&out[l], (normalizeRow_load(&in[l]) - vmean) * vscale);
+        l = length;
+    }
+#endif
+
+    for (; l < length; l++) {
+        out[l] = (static_cast<float>(in[l]) - mean) * scale;
+    }
+}
+
+// Resize (nearest, 8UC1)
+inline void calcRowNearest_8U_impl(uint8_t dst[], const uint8_t src[], const int mapsx[], int length) {
+    int l = 0;
+
+#if MANUAL_SIMD
+    const int nlanes = v_uint8::nlanes;
+
+    for (; l <= length - nlanes; l += nlanes) {
+        vx_store(&dst[l], vx_lut(src, &mapsx[l]));
+    }
+
+    if (l < length && length >= nlanes) {
+        l = length - nlanes;
+        vx_store(&dst[l], vx_lut(src, &mapsx[l]));
+        l = length;
+    }
+#endif
+
+    for (; l < length; l++) {
+        dst[l] = src[mapsx[l]];
+    }
+}
+
+// Resize (nearest, 32FC1)
+inline void calcRowNearest_32F_impl(float dst[], const float src[], const int mapsx[], int length) {
+    int l = 0;
+
+#if MANUAL_SIMD
+    const int nlanes = v_float32::nlanes;
+
+    for (; l <= length - nlanes; l += nlanes) {
+        vx_store(&dst[l], vx_lut(src, &mapsx[l]));
+    }
+
+    if (l < length && length >= nlanes) {
+        l = length - nlanes;
+        vx_store(&dst[l], vx_lut(src, &mapsx[l]));
+        l = length;
+    }
+#endif
+
+    for (; l < length; l++) {
+        dst[l] = src[mapsx[l]];
+    }
+}
+
 // Resize (bi-linear, 32FC1)
 static inline void calcRowLinear_32FC1(float *dst[],
                                        const float *src0[],
@@ -1489,6 +1489,20 @@ std::shared_ptr<ngraph::Node> V10Parser::LayerCreator<ngraph::op::Constant>::cre
     if (size < std::ceil(ngraph::shape_size(shape) * el_type.bitwidth() / 8.f))
         THROW_IE_EXCEPTION << "Cannot create Constant op " << layerParsePrms.name << " size attribute and shape size are inconsistent!";
 
+    // Weights are mapped into memory, so the constant refers to them without a copy.
+    // Only constants at offsets which are not aligned to their element size are copied.
+    auto blobStream = details::getBlobStream(binStream);
+    if (blobStream && blobStream->isShared()) {
+        auto weights = blobStream->getBlob();
+        char* data = weights->cbuffer().as<char*>() + offset;
+        const size_t alignment = std::max<size_t>(el_type.size(), 1);
+        if (reinterpret_cast<uintptr_t>(data) % alignment == 0) {
+            using SharedBuffer = ngraph::runtime::SharedBuffer<Blob::CPtr>;
+            auto buffer = std::make_shared<SharedBuffer>(data, size, weights);
+            return std::make_shared<ngraph::op::Constant>(port.precision, shape, buffer);
+        }
+    }
+
     auto constant = std::make_shared<ngraph::op::Constant>(port.precision, shape);
     char* data = const_cast<char*>(reinterpret_cast<const char*>(constant->get_data_ptr()));
     binStream.seekg(offset, std::ios::beg);
@@ -6,6 +6,8 @@
 
 #include <ie_blob.h>
 #include <istream>
+#include <string>
+#include <typeinfo>
 
 namespace InferenceEngine {
 namespace details {
@@ -22,14 +24,44 @@ private:
 
     BlobBuffer buffer;
     Blob::CPtr blob;
+    bool shared;
 
 public:
-    BlobStream(const Blob::CPtr& blob);
+    /**
+     * @brief Creates a stream which reads data from a blob
+     * @param blob A blob to read data from
+     * @param shared If true, the blob memory is immutable for the lifetime of the blob, so readers
+     *        can keep references to it instead of copying the data
+     */
+    BlobStream(const Blob::CPtr& blob, bool shared = false);
     ~BlobStream() override;
 
     Blob::CPtr getBlob();
+
+    /**
+     * @brief Checks whether readers are allowed to refer to the blob memory instead of copying it
+     * @return true if the blob memory can be shared
+     */
+    bool isShared() const;
 };
 
+/**
+ * @brief Gets a BlobStream from a stream passed to a reader
+ * @param stream A stream with weights
+ * @return A pointer to the BlobStream or nullptr if the stream is not a BlobStream
+ */
+inline BlobStream* getBlobStream(std::istream& stream) {
+    BlobStream* blobStream = dynamic_cast<BlobStream*>(&stream);
+    if (blobStream == nullptr) {
+        // dynamic_cast may fail if type info is not merged between shared libraries
+        BlobStream helper({});
+        std::string typeStream = typeid(stream).name();
+        std::string typeBlobStream = typeid(helper).name();
+        if (typeStream == typeBlobStream)
+            blobStream = static_cast<BlobStream*>(&stream);
+    }
+    return blobStream;
+}
 
 }  // namespace details
 }  // namespace InferenceEngine
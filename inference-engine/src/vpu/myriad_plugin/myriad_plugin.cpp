@@ -346,6 +346,8 @@ InferenceEngine::Parameter Engine::GetMetric(const std::string& name,
         } else {
             return Parameter();
         }
+    } else if (name == METRIC_KEY(IMPORT_EXPORT_SUPPORT)) {
+        IE_SET_METRIC_RETURN(IMPORT_EXPORT_SUPPORT, true);
     }
     THROW_IE_EXCEPTION << NOT_IMPLEMENTED_str;
 }
@@ -0,0 +1,87 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <threading/ie_cpu_streams_executor.hpp>
+#include <ie_system_conf.h>
+
+using namespace InferenceEngine;
+
+using Clock = std::chrono::steady_clock;
+
+/**
+ * Microbenchmark of CPUStreamsExecutor: several producers submit small tasks,
+ * submit-to-start latency of every task and overall throughput are reported for the given number of streams.
+ * It checks nothing, so it is disabled and is run manually with --gtest_also_run_disabled_tests
+ */
+class CPUStreamsExecutorBenchmark : public ::testing::TestWithParam<int> {
+protected:
+    static constexpr int numberOfProducers = 4;
+    static constexpr int tasksPerProducer = 20000;
+};
+
+TEST_P(CPUStreamsExecutorBenchmark, DISABLED_submitToStartLatencyAndThroughput) {
+    const int streams = GetParam();
+    CPUStreamsExecutor executor{IStreamsExecutor::Config{"CPUStreamsExecutorBenchmark", streams, 1,
+                                                         IStreamsExecutor::ThreadBindingType::NONE}};
+
+    const int numberOfTasks = numberOfProducers * tasksPerProducer;
+    std::vector<Clock::duration> latencies(numberOfTasks);
+    std::atomic<int> finishedTasks = {0};
+    std::promise<void> allFinished;
+
+    const auto start = Clock::now();
+    std::vector<std::thread> producers;
+    for (int producer = 0; producer < numberOfProducers; ++producer) {
+        producers.emplace_back([&, producer] {
+            for (int i = 0; i < tasksPerProducer; ++i) {
+                const auto taskId = producer * tasksPerProducer + i;
+                const auto submitted = Clock::now();
+                executor.run([&, taskId, submitted] {
+                    latencies[taskId] = Clock::now() - submitted;
+                    if (numberOfTasks == ++finishedTasks) {
+                        allFinished.set_value();
+                    }
+                });
+            }
+        });
+    }
+    for (auto&& producer : producers) {
+        producer.join();
+    }
+    allFinished.get_future().wait();
+    const auto elapsed = std::chrono::duration<double>(Clock::now() - start).count();
+    ASSERT_EQ(numberOfTasks, finishedTasks);
+
+    std::sort(latencies.begin(), latencies.end());
+    auto percentile = [&] (double p) {
+        auto latency = latencies[static_cast<std::size_t>(p * (numberOfTasks - 1))];
+        return std::chrono::duration_cast<std::chrono::microseconds>(latency).count();
+    };
+    std::cout << "streams: " << streams
+              << ", throughput: " << static_cast<int>(numberOfTasks / elapsed) << " tasks/s"
+              << ", submit-to-start latency p50: " << percentile(0.5) << " us"
+              << ", p99: " << percentile(0.99) << " us"
+              << ", max: " << percentile(1.0) << " us" << std::endl;
+}
+
+static std::vector<int> streamNumbers() {
+    std::vector<int> streams = {1, 2, 4, getNumberOfCPUCores()};
+    std::sort(streams.begin(), streams.end());
+    streams.erase(std::unique(streams.begin(), streams.end()), streams.end());
+    return streams;
+}
+
+INSTANTIATE_TEST_CASE_P(CPUStreamsExecutorBenchmark, CPUStreamsExecutorBenchmark,
+                        ::testing::ValuesIn(streamNumbers()));
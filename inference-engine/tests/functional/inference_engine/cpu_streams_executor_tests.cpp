@@ -0,0 +1,109 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <chrono>
+#include <future>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <threading/ie_cpu_streams_executor.hpp>
+#include <ie_system_conf.h>
+
+using namespace InferenceEngine;
+
+class CPUStreamsExecutorTests : public ::testing::Test {
+protected:
+    void SetUp() override {
+        // every NUMA node gets two stream workers, so each of them has a worker to steal tasks from
+        streams = 2 * static_cast<int>(getAvailableNUMANodes().size());
+        executor.reset(new CPUStreamsExecutor{IStreamsExecutor::Config{"CPUStreamsExecutorTests", streams, 1,
+                                                                       IStreamsExecutor::ThreadBindingType::NONE}});
+    }
+
+    struct TaskInfo {
+        std::thread::id threadId;
+        int streamId;
+        int numaNodeId;
+    };
+
+    std::future<TaskInfo> run(std::function<void()> body = {}) {
+        auto task = std::make_shared<std::packaged_task<TaskInfo()>>([this, body] {
+            if (body) {
+                body();
+            }
+            return TaskInfo{std::this_thread::get_id(), executor->GetStreamId(), executor->GetNumaNodeId()};
+        });
+        auto future = task->get_future();
+        executor->run([task] { (*task)(); });
+        return future;
+    }
+
+    int streams = 0;
+    std::unique_ptr<CPUStreamsExecutor> executor;
+};
+
+TEST_F(CPUStreamsExecutorTests, idleWorkersStealTasksOfBusyWorker) {
+    std::promise<void> release;
+    auto released = release.get_future().share();
+    std::promise<void> blocked;
+    auto blockedTask = run([&] {
+        blocked.set_value();
+        released.wait();
+    });
+    blocked.get_future().wait();
+
+    // tasks are distributed between queues of all workers, so some of them are queued to the busy one
+    const int numberOfTasks = 8 * streams;
+    std::vector<std::future<TaskInfo>> tasks;
+    for (int i = 0; i < numberOfTasks; ++i) {
+        tasks.push_back(run());
+    }
+    std::vector<std::future_status> statuses;
+    for (auto&& task : tasks) {
+        statuses.push_back(task.wait_for(std::chrono::seconds(10)));
+    }
+    release.set_value();
+
+    const auto blockedInfo = blockedTask.get();
+    for (int i = 0; i < numberOfTasks; ++i) {
+        ASSERT_EQ(std::future_status::ready, statuses[i]);
+        auto info = tasks[i].get();
+        ASSERT_NE(blockedInfo.streamId, info.streamId);
+    }
+}
+
+TEST_F(CPUStreamsExecutorTests, workersUseStreamsOfTheirQueues) {
+    const int numberOfTasks = 16 * streams;
+    std::vector<std::future<TaskInfo>> tasks;
+    for (int i = 0; i < numberOfTasks; ++i) {
+        tasks.push_back(run());
+    }
+
+    std::map<std::thread::id, int> threadStreams;
+    std::map<int, int> streamNumaNodes;
+    for (auto&& task : tasks) {
+        auto info = task.get();
+        ASSERT_LE(0, info.streamId);
+        ASSERT_GT(streams, info.streamId);
+        // a worker always runs tasks in the same stream, which is pinned to one NUMA node
+        ASSERT_EQ(info.streamId, threadStreams.emplace(info.threadId, info.streamId).first->second);
+        ASSERT_EQ(info.numaNodeId, streamNumaNodes.emplace(info.streamId, info.numaNodeId).first->second);
+    }
+    // workers of one NUMA node steal tasks from each other, so their streams are pinned to the same node
+    for (int streamId = 0; streamId + 1 < streams; streamId += 2) {
+        auto first = streamNumaNodes.find(streamId);
+        auto second = streamNumaNodes.find(streamId + 1);
+        if (first != streamNumaNodes.end() && second != streamNumaNodes.end()) {
+            ASSERT_EQ(first->second, second->second);
+        }
+    }
+}
+
+TEST_F(CPUStreamsExecutorTests, otherThreadsDoNotTakeStreamIdsOfWorkers) {
+    ASSERT_LE(streams, executor->GetStreamId());
+}
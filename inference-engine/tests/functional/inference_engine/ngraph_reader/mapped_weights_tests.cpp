@@ -0,0 +1,176 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <string>
+#include <vector>
+
+#include <ngraph/op/constant.hpp>
+#include "ngraph_reader_tests.hpp"
+
+namespace {
+
+std::map<std::string, const char*> getConstantsData(const CNNNetwork& network) {
+    std::map<std::string, const char*> data;
+    for (auto&& node : network.getFunction()->get_ops()) {
+        if (auto constant = std::dynamic_pointer_cast<ngraph::op::Constant>(node)) {
+            data[constant->get_friendly_name()] = constant->get_data_ptr<char>();
+        }
+    }
+    return data;
+}
+
+}  // namespace
+
+// Model Optimizer packs constants tightly, so most of them are not aligned to more than their element size
+TEST_F(NGraphReaderTests, ReadNetworkSharesMappedWeightsAtUnalignedOffsets) {
+    std::string model = R"V0G0N(
+<net name="Network" version="10">
+    <layers>
+        <layer id="0" name="data" type="Parameter" version="opset1">
+            <data element_type="f32" shape="1,4"/>
+            <output>
+                <port id="0" precision="FP32">
+                    <dim>1</dim>
+                    <dim>4</dim>
+                </port>
+            </output>
+        </layer>
+        <layer id="1" name="const_a" type="Const" version="opset1">
+            <data offset="4" size="16"/>
+            <output>
+                <port id="0" precision="FP32">
+                    <dim>1</dim>
+                    <dim>4</dim>
+                </port>
+            </output>
+        </layer>
+        <layer id="2" name="const_b" type="Const" version="opset1">
+            <data offset="20" size="16"/>
+            <output>
+                <port id="0" precision="FP32">
+                    <dim>1</dim>
+                    <dim>4</dim>
+                </port>
+            </output>
+        </layer>
+        <layer id="3" name="const_c" type="Const" version="opset1">
+            <data offset="38" size="16"/>
+            <output>
+                <port id="0" precision="FP32">
+                    <dim>1</dim>
+                    <dim>4</dim>
+                </port>
+            </output>
+        </layer>
+        <layer id="4" name="add" type="Add" version="opset1">
+            <input>
+                <port id="0" precision="FP32">
+                    <dim>1</dim>
+                    <dim>4</dim>
+                </port>
+                <port id="1" precision="FP32">
+                    <dim>1</dim>
+                    <dim>4</dim>
+                </port>
+            </input>
+            <output>
+                <port id="2" precision="FP32">
+                    <dim>1</dim>
+                    <dim>4</dim>
+                </port>
+            </output>
+        </layer>
+        <layer id="5" name="mul" type="Multiply" version="opset1">
+            <input>
+                <port id="0" precision="FP32">
+                    <dim>1</dim>
+                    <dim>4</dim>
+                </port>
+                <port id="1" precision="FP32">
+                    <dim>1</dim>
+                    <dim>4</dim>
+                </port>
+            </input>
+            <output>
+                <port id="2" precision="FP32">
+                    <dim>1</dim>
+                    <dim>4</dim>
+                </port>
+            </output>
+        </layer>
+        <layer id="6" name="sub" type="Subtract" version="opset1">
+            <input>
+                <port id="0" precision="FP32">
+                    <dim>1</dim>
+                    <dim>4</dim>
+                </port>
+                <port id="1" precision="FP32">
+                    <dim>1</dim>
+                    <dim>4</dim>
+                </port>
+            </input>
+            <output>
+                <port id="2" precision="FP32">
+                    <dim>1</dim>
+                    <dim>4</dim>
+                </port>
+            </output>
+        </layer>
+        <layer id="7" name="output" type="Result" version="opset1">
+            <input>
+                <port id="0" precision="FP32">
+                    <dim>1</dim>
+                    <dim>4</dim>
+                </port>
+            </input>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="0" from-port="0" to-layer="4" to-port="0"/>
+        <edge from-layer="1" from-port="0" to-layer="4" to-port="1"/>
+        <edge from-layer="4" from-port="2" to-layer="5" to-port="0"/>
+        <edge from-layer="2" from-port="0" to-layer="5" to-port="1"/>
+        <edge from-layer="5" from-port="2" to-layer="6" to-port="0"/>
+        <edge from-layer="3" from-port="0" to-layer="6" to-port="1"/>
+        <edge from-layer="6" from-port="2" to-layer="7" to-port="0"/>
+    </edges>
+</net>
+)V0G0N";
+
+    const std::string modelPath = "ReadNetworkSharesMappedWeights.xml";
+    const std::string weightsPath = "ReadNetworkSharesMappedWeights.bin";
+    CommonTestUtils::createFile(modelPath, model);
+    {
+        std::vector<char> weights(54);
+        const float a[] = {1.f, 2.f, 3.f, 4.f}, b[] = {5.f, 6.f, 7.f, 8.f}, c[] = {9.f, 10.f, 11.f, 12.f};
+        std::memcpy(weights.data() + 4, a, sizeof(a));
+        std::memcpy(weights.data() + 20, b, sizeof(b));
+        std::memcpy(weights.data() + 38, c, sizeof(c));
+        std::ofstream file(weightsPath, std::ios::binary);
+        file.write(weights.data(), weights.size());
+    }
+
+    {
+        Core ie;
+        auto network = ie.ReadNetwork(modelPath, weightsPath);
+        auto data = getConstantsData(network);
+        ASSERT_EQ(3, data.size());
+
+        // constants which refer to the one mapping of the weights file are as far apart as their offsets,
+        // which is impossible for copies since ngraph buffers are aligned to 64 bytes
+        ASSERT_EQ(16, data.at("const_b") - data.at("const_a"));
+        ASSERT_EQ(5.f, *reinterpret_cast<const float*>(data.at("const_b")));
+
+        // the constant which is not aligned to its element size is copied
+        ASSERT_EQ(0, reinterpret_cast<uintptr_t>(data.at("const_c")) % sizeof(float));
+        ASSERT_NE(34, data.at("const_c") - data.at("const_a"));
+        ASSERT_EQ(9.f, *reinterpret_cast<const float*>(data.at("const_c")));
+    }
+
+    CommonTestUtils::removeIRFiles(modelPath, weightsPath);
+}
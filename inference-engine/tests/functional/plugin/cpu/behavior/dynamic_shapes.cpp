@@ -0,0 +1,76 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <ie_plugin_config.hpp>
+
+#include "common_test_utils/test_constants.hpp"
+#include "functional_test_utils/blob_utils.hpp"
+#include "ngraph_functions/subgraph_builders.hpp"
+#include "test_utils/network_tests_base.hpp"
+
+using namespace InferenceEngine;
+
+class DynamicShapesTests : public CPUTestUtils::NetworkTestsBase {
+protected:
+    void SetUp() override {
+        initNetwork(ngraph::builder::subgraph::makeSplitConvConcat({1, 4, 20, 20}));
+    }
+};
+
+TEST_F(DynamicShapesTests, inferWithChangedInputShapes) {
+    auto executableNetwork = ie.LoadNetwork(network, CommonTestUtils::DEVICE_CPU,
+                                            {{CONFIG_KEY(CPU_DYNAMIC_SHAPES_CACHE_SIZE), "2"}});
+    auto request = executableNetwork.CreateInferRequest();
+
+    const std::vector<SizeVector> shapes = {{1, 4, 24, 24}, {1, 4, 20, 20}, {1, 4, 16, 32}, {1, 4, 24, 24}};
+    for (auto&& shape : shapes) {
+        auto input = FuncTestUtils::createAndFillBlob({Precision::FP32, shape, Layout::NCHW});
+        ASSERT_NO_THROW(request.SetBlob(inputName, input));
+        ASSERT_NO_THROW(request.Infer());
+
+        compareWithReference(request, input);
+    }
+}
+
+TEST_F(DynamicShapesTests, inputOfAnotherRankIsRejected) {
+    auto executableNetwork = ie.LoadNetwork(network, CommonTestUtils::DEVICE_CPU,
+                                            {{CONFIG_KEY(CPU_DYNAMIC_SHAPES_CACHE_SIZE), "1"}});
+    auto request = executableNetwork.CreateInferRequest();
+    auto input = FuncTestUtils::createAndFillBlob({Precision::FP32, {4, 24, 24}, Layout::CHW});
+    ASSERT_THROW(request.SetBlob(inputName, input), details::InferenceEngineException);
+}
+
+TEST_F(DynamicShapesTests, inputShapesAreFixedByDefault) {
+    auto request = ie.LoadNetwork(network, CommonTestUtils::DEVICE_CPU).CreateInferRequest();
+    auto input = FuncTestUtils::createAndFillBlob({Precision::FP32, {1, 4, 24, 24}, Layout::NCHW});
+    ASSERT_THROW(request.SetBlob(inputName, input), details::InferenceEngineException);
+}
+
+TEST_F(DynamicShapesTests, streamsInferWithChangedInputShapes) {
+    auto executableNetwork = ie.LoadNetwork(network, CommonTestUtils::DEVICE_CPU,
+                                            {{CONFIG_KEY(CPU_DYNAMIC_SHAPES_CACHE_SIZE), "2"},
+                                             {CONFIG_KEY(CPU_THROUGHPUT_STREAMS), "2"}});
+
+    // requests of different streams use the same shapes, so they share the converted networks
+    const std::vector<SizeVector> shapes = {{1, 4, 24, 24}, {1, 4, 16, 32}, {1, 4, 24, 24}, {1, 4, 16, 32}};
+    std::vector<InferRequest> requests;
+    std::vector<Blob::Ptr> inputs;
+    for (auto&& shape : shapes) {
+        inputs.push_back(FuncTestUtils::createAndFillBlob({Precision::FP32, shape, Layout::NCHW}));
+        requests.push_back(executableNetwork.CreateInferRequest());
+        ASSERT_NO_THROW(requests.back().SetBlob(inputName, inputs.back()));
+    }
+    for (auto&& request : requests) {
+        ASSERT_NO_THROW(request.StartAsync());
+    }
+    for (size_t i = 0; i < requests.size(); ++i) {
+        ASSERT_EQ(StatusCode::OK, requests[i].Wait(IInferRequest::WaitMode::RESULT_READY));
+        compareWithReference(requests[i], inputs[i]);
+    }
+}
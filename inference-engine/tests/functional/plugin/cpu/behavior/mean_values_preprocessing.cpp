@@ -0,0 +1,69 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <ngraph/graph_util.hpp>
+
+#include "common_test_utils/test_constants.hpp"
+#include "functional_test_utils/blob_utils.hpp"
+#include "ngraph_functions/subgraph_builders.hpp"
+#include "test_utils/network_tests_base.hpp"
+
+using namespace InferenceEngine;
+
+class MeanValuesPreprocessingTests : public CPUTestUtils::NetworkTestsBase {
+protected:
+    void SetUp() override {
+        initNetwork(ngraph::builder::subgraph::makeSplitConvConcat());
+    }
+
+    // U8 input resized by the pre-processing with the mean values subtracted
+    CNNNetwork makeNetwork(Layout layout, bool meanImage) const {
+        CNNNetwork result(ngraph::clone_function(*network.getFunction()));
+        auto inputInfo = result.getInputsInfo().begin()->second;
+        inputInfo->setPrecision(Precision::U8);
+        inputInfo->setLayout(layout);
+        auto& preProcess = inputInfo->getPreProcess();
+        preProcess.setResizeAlgorithm(RESIZE_BILINEAR);
+        preProcess.init(meanValues.size());
+        const auto& dims = inputInfo->getTensorDesc().getDims();
+        for (size_t c = 0; c < meanValues.size(); c++) {
+            if (meanImage) {
+                auto image = make_shared_blob<float>({Precision::FP32, {dims[2], dims[3]}, Layout::HW});
+                image->allocate();
+                std::fill_n(image->buffer().as<float*>(), image->size(), meanValues[c]);
+                preProcess.setMeanImageForChannel(image, c);
+            } else {
+                preProcess[c]->meanValue = meanValues[c];
+            }
+        }
+        preProcess.setVariant(meanImage ? MEAN_IMAGE : MEAN_VALUE);
+        return result;
+    }
+
+    Blob::Ptr infer(const CNNNetwork& preprocessedNetwork, const Blob::Ptr& input) {
+        auto request = ie.LoadNetwork(preprocessedNetwork, CommonTestUtils::DEVICE_CPU).CreateInferRequest();
+        request.SetBlob(inputName, input);
+        request.Infer();
+        return request.GetBlob(outputName);
+    }
+
+    std::vector<float> meanValues = {10.5f, 64.0f, 127.25f, 200.0f};
+};
+
+// Mean values are applied by the pre-processing in the same pass as the resize,
+// while a mean image with the same values is subtracted by the graph after the resize
+TEST_F(MeanValuesPreprocessingTests, fusedMeanValuesMatchMeanImageSubtraction) {
+    for (auto layout : {Layout::NCHW, Layout::NHWC}) {
+        auto input = FuncTestUtils::createAndFillBlob({Precision::U8, {1, 4, 40, 30}, layout});
+        auto fused = infer(makeNetwork(layout, false), input);
+        auto reference = infer(makeNetwork(layout, true), input);
+        FuncTestUtils::compareBlobs(fused, reference);
+    }
+}
@@ -0,0 +1,31 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <ie_plugin_config.hpp>
+
+#include "common_test_utils/test_constants.hpp"
+#include "ngraph_functions/subgraph_builders.hpp"
+#include "test_utils/network_tests_base.hpp"
+
+using namespace InferenceEngine;
+
+class MemoryArenaTests : public CPUTestUtils::NetworkTestsBase {
+protected:
+    void SetUp() override {
+        initNetwork(ngraph::builder::subgraph::makeNestedSplitConvConcat());
+    }
+};
+
+TEST_F(MemoryArenaTests, arenaIsNotLessThanLowerBound) {
+    auto executableNetwork = ie.LoadNetwork(network, CommonTestUtils::DEVICE_CPU);
+    ASSERT_TRUE(hasMetric(executableNetwork, METRIC_KEY(MEMORY_ARENA_SIZE)));
+    ASSERT_TRUE(hasMetric(executableNetwork, METRIC_KEY(MEMORY_ARENA_LOWER_BOUND)));
+
+    auto arenaSize = executableNetwork.GetMetric(METRIC_KEY(MEMORY_ARENA_SIZE)).as<uint64_t>();
+    auto lowerBound = executableNetwork.GetMetric(METRIC_KEY(MEMORY_ARENA_LOWER_BOUND)).as<uint64_t>();
+    ASSERT_GT(lowerBound, 0u);
+    ASSERT_GE(arenaSize, lowerBound);
+}
@@ -0,0 +1,111 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <map>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <ie_plugin_config.hpp>
+#include <multi-device/multi_device_config.hpp>
+
+#include "common_test_utils/test_constants.hpp"
+#include "ngraph_functions/subgraph_builders.hpp"
+#include "test_utils/network_tests_base.hpp"
+
+using namespace InferenceEngine;
+
+class MultiSchedulingTests : public CPUTestUtils::NetworkTestsBase,
+                             public ::testing::WithParamInterface<std::string> {
+protected:
+    void SetUp() override {
+        initNetwork(ngraph::builder::subgraph::makeSplitConvConcat());
+    }
+};
+
+TEST_P(MultiSchedulingTests, latencyMetricsAreCollected) {
+    auto executableNetwork = ie.LoadNetwork(network, CommonTestUtils::DEVICE_MULTI,
+                                            {{MULTI_CONFIG_KEY(DEVICE_PRIORITIES), std::string(CommonTestUtils::DEVICE_CPU) + "(2)"},
+                                             {MULTI_CONFIG_KEY(SCHEDULING_POLICY), GetParam()}});
+    ASSERT_EQ(GetParam(), executableNetwork.GetConfig(MULTI_CONFIG_KEY(SCHEDULING_POLICY)).as<std::string>());
+
+    for (auto&& metric : {METRIC_KEY(MULTI_DEVICE_AVERAGE_LATENCY),
+                          METRIC_KEY(MULTI_DEVICE_LATENCY_PERCENTILES),
+                          METRIC_KEY(MULTI_DEVICE_INFERENCES)}) {
+        ASSERT_TRUE(hasMetric(executableNetwork, metric));
+    }
+
+    const unsigned int numRequests = 4, numIterations = 5;
+    std::vector<InferRequest> requests;
+    for (unsigned int i = 0; i < numRequests; ++i) {
+        requests.push_back(executableNetwork.CreateInferRequest());
+    }
+    for (unsigned int i = 0; i < numIterations; ++i) {
+        for (auto&& request : requests) {
+            request.StartAsync();
+        }
+        for (auto&& request : requests) {
+            ASSERT_EQ(StatusCode::OK, request.Wait(IInferRequest::WaitMode::RESULT_READY));
+        }
+    }
+
+    auto inferences = executableNetwork.GetMetric(METRIC_KEY(MULTI_DEVICE_INFERENCES)).as<std::map<std::string, unsigned int>>();
+    ASSERT_EQ(numRequests * numIterations, inferences.at(CommonTestUtils::DEVICE_CPU));
+
+    auto average = executableNetwork.GetMetric(METRIC_KEY(MULTI_DEVICE_AVERAGE_LATENCY)).as<std::map<std::string, float>>();
+    ASSERT_GT(average.at(CommonTestUtils::DEVICE_CPU), 0.0f);
+
+    auto percentiles = executableNetwork.GetMetric(
+        METRIC_KEY(MULTI_DEVICE_LATENCY_PERCENTILES)).as<std::map<std::string, std::vector<float>>>();
+    auto& cpuPercentiles = percentiles.at(CommonTestUtils::DEVICE_CPU);
+    ASSERT_EQ(4u, cpuPercentiles.size());
+    ASSERT_GT(cpuPercentiles.front(), 0.0f);
+    ASSERT_TRUE(std::is_sorted(cpuPercentiles.begin(), cpuPercentiles.end()));
+}
+
+TEST_F(MultiSchedulingTests, fasterDeviceGetsMoreRequests) {
+    // two instances of the CPU plugin of different performance, the slower one has a single worker request
+    const std::string slowDevice = "CPU_SLOW", fastDevice = "CPU_FAST";
+    ie.RegisterPlugin("MKLDNNPlugin", slowDevice);
+    ie.RegisterPlugin("MKLDNNPlugin", fastDevice);
+    ie.SetConfig({{CONFIG_KEY(CPU_THREADS_NUM), "1"}}, slowDevice);
+    ie.SetConfig({{CONFIG_KEY(CPU_THROUGHPUT_STREAMS), CONFIG_VALUE(CPU_THROUGHPUT_AUTO)}}, fastDevice);
+
+    // the slower device goes first, so the priority order does not favor the faster one
+    auto executableNetwork = ie.LoadNetwork(network, CommonTestUtils::DEVICE_MULTI,
+        {{MULTI_CONFIG_KEY(DEVICE_PRIORITIES), slowDevice + "(1)," + fastDevice + "(4)"},
+         {MULTI_CONFIG_KEY(SCHEDULING_POLICY), MultiDeviceConfigParams::MULTI_MIN_COMPLETION_TIME}});
+
+    const unsigned int numRequests = 5, numIterations = 20;
+    std::vector<InferRequest> requests;
+    for (unsigned int i = 0; i < numRequests; ++i) {
+        requests.push_back(executableNetwork.CreateInferRequest());
+    }
+    for (unsigned int i = 0; i < numIterations; ++i) {
+        for (auto&& request : requests) {
+            request.StartAsync();
+        }
+        for (auto&& request : requests) {
+            ASSERT_EQ(StatusCode::OK, request.Wait(IInferRequest::WaitMode::RESULT_READY));
+        }
+    }
+
+    auto inferences = executableNetwork.GetMetric(METRIC_KEY(MULTI_DEVICE_INFERENCES)).as<std::map<std::string, unsigned int>>();
+    ASSERT_EQ(numRequests * numIterations, inferences.at(slowDevice) + inferences.at(fastDevice));
+    // both devices are probed and the faster one takes requests the slower one is busy with
+    ASSERT_GT(inferences.at(slowDevice), 0u);
+    ASSERT_GT(inferences.at(fastDevice), inferences.at(slowDevice));
+}
+
+TEST_F(MultiSchedulingTests, unsupportedPolicyIsRejected) {
+    ASSERT_ANY_THROW(ie.LoadNetwork(network, CommonTestUtils::DEVICE_MULTI,
+                                    {{MULTI_CONFIG_KEY(DEVICE_PRIORITIES), CommonTestUtils::DEVICE_CPU},
+                                     {MULTI_CONFIG_KEY(SCHEDULING_POLICY), "ROUND_ROBIN"}}));
+}
+
+INSTANTIATE_TEST_CASE_P(smoke_MultiScheduling, MultiSchedulingTests,
+                        ::testing::Values(MultiDeviceConfigParams::MULTI_PRIORITY,
+                                          MultiDeviceConfigParams::MULTI_MIN_COMPLETION_TIME));
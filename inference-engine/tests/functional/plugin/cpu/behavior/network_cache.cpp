@@ -0,0 +1,138 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <string>
+#include <vector>
+
+#ifdef _WIN32
+# ifndef NOMINMAX
+#  define NOMINMAX
+# endif
+# include <windows.h>
+#else
+# include <dirent.h>
+# include <unistd.h>
+#endif
+
+#include <gtest/gtest.h>
+
+#include <ie_core.hpp>
+#include <ie_plugin_config.hpp>
+
+#include "common_test_utils/file_utils.hpp"
+#include "common_test_utils/test_constants.hpp"
+#include "ngraph_functions/subgraph_builders.hpp"
+#include "test_utils/network_tests_base.hpp"
+
+using namespace InferenceEngine;
+
+namespace {
+
+std::vector<std::string> listCachedBlobs(const std::string& path) {
+    std::vector<std::string> blobs;
+    auto isBlob = [](const std::string& name) {
+        const std::string ext = ".blob";
+        return name.size() > ext.size() && name.compare(name.size() - ext.size(), ext.size(), ext) == 0;
+    };
+#ifdef _WIN32
+    WIN32_FIND_DATAA findData;
+    HANDLE handle = FindFirstFileA(CommonTestUtils::makePath(path, "*").c_str(), &findData);
+    if (handle != INVALID_HANDLE_VALUE) {
+        do {
+            if (isBlob(findData.cFileName)) {
+                blobs.emplace_back(findData.cFileName);
+            }
+        } while (FindNextFileA(handle, &findData));
+        FindClose(handle);
+    }
+#else
+    if (auto dir = opendir(path.c_str())) {
+        while (auto entry = readdir(dir)) {
+            if (isBlob(entry->d_name)) {
+                blobs.emplace_back(entry->d_name);
+            }
+        }
+        closedir(dir);
+    }
+#endif
+    return blobs;
+}
+
+}  // namespace
+
+class NetworkCacheTests : public CPUTestUtils::NetworkTestsBase {
+protected:
+    void SetUp() override {
+        const auto testInfo = ::testing::UnitTest::GetInstance()->current_test_info();
+        cacheDir = std::string("network_cache_") + testInfo->name();
+        initNetwork(ngraph::builder::subgraph::makeSplitConvConcat());
+    }
+
+    void TearDown() override {
+        for (auto&& blob : listCachedBlobs(cacheDir)) {
+            CommonTestUtils::removeFile(CommonTestUtils::makePath(cacheDir, blob));
+        }
+#ifdef _WIN32
+        RemoveDirectoryA(cacheDir.c_str());
+#else
+        rmdir(cacheDir.c_str());
+#endif
+    }
+
+    static unsigned int getHits(const Core& core) {
+        return core.GetMetric(CommonTestUtils::DEVICE_CPU, METRIC_KEY(NETWORK_CACHE_HITS)).as<unsigned int>();
+    }
+
+    static unsigned int getMisses(const Core& core) {
+        return core.GetMetric(CommonTestUtils::DEVICE_CPU, METRIC_KEY(NETWORK_CACHE_MISSES)).as<unsigned int>();
+    }
+
+    std::string cacheDir;
+};
+
+TEST_F(NetworkCacheTests, secondLoadIsServedFromCache) {
+    {
+        Core core;
+        core.SetConfig({{CONFIG_KEY(CACHE_DIR), cacheDir}});
+        ASSERT_EQ(cacheDir, core.GetConfig(CommonTestUtils::DEVICE_CPU, CONFIG_KEY(CACHE_DIR)).as<std::string>());
+
+        ASSERT_NO_THROW(core.LoadNetwork(network, CommonTestUtils::DEVICE_CPU));
+        ASSERT_EQ(0u, getHits(core));
+        ASSERT_EQ(1u, getMisses(core));
+        ASSERT_EQ(1u, listCachedBlobs(cacheDir).size());
+    }
+
+    // a new Core emulates another process which loads the same network
+    ie.SetConfig({{CONFIG_KEY(CACHE_DIR), cacheDir}});
+    ExecutableNetwork executableNetwork;
+    ASSERT_NO_THROW(executableNetwork = ie.LoadNetwork(network, CommonTestUtils::DEVICE_CPU));
+    ASSERT_EQ(1u, getHits(ie));
+    ASSERT_EQ(0u, getMisses(ie));
+    ASSERT_EQ(network.getInputsInfo().size(), executableNetwork.GetInputsInfo().size());
+    ASSERT_EQ(network.getOutputsInfo().size(), executableNetwork.GetOutputsInfo().size());
+
+    auto request = executableNetwork.CreateInferRequest();
+    ASSERT_NO_THROW(request.Infer());
+}
+
+TEST_F(NetworkCacheTests, differentConfigsAreCachedSeparately) {
+    ASSERT_NO_THROW(ie.LoadNetwork(network, CommonTestUtils::DEVICE_CPU, {{CONFIG_KEY(CACHE_DIR), cacheDir}}));
+    ASSERT_NO_THROW(ie.LoadNetwork(network, CommonTestUtils::DEVICE_CPU,
+                                   {{CONFIG_KEY(CACHE_DIR), cacheDir}, {CONFIG_KEY(CPU_THROUGHPUT_STREAMS), "2"}}));
+    ASSERT_EQ(0u, getHits(ie));
+    ASSERT_EQ(2u, getMisses(ie));
+    ASSERT_EQ(2u, listCachedBlobs(cacheDir).size());
+
+    ASSERT_NO_THROW(ie.LoadNetwork(network, CommonTestUtils::DEVICE_CPU,
+                                   {{CONFIG_KEY(CACHE_DIR), cacheDir}, {CONFIG_KEY(CPU_THROUGHPUT_STREAMS), "2"}}));
+    ASSERT_EQ(1u, getHits(ie));
+    ASSERT_EQ(2u, getMisses(ie));
+}
+
+TEST_F(NetworkCacheTests, cacheIsNotUsedWithoutCacheDir) {
+    ASSERT_NO_THROW(ie.LoadNetwork(network, CommonTestUtils::DEVICE_CPU));
+    ASSERT_EQ(0u, getHits(ie));
+    ASSERT_EQ(0u, getMisses(ie));
+    ASSERT_TRUE(listCachedBlobs(cacheDir).empty());
+}
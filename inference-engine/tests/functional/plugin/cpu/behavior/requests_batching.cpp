@@ -0,0 +1,120 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <ie_plugin_config.hpp>
+
+#include "common_test_utils/test_constants.hpp"
+#include "functional_test_utils/blob_utils.hpp"
+#include "ngraph_functions/subgraph_builders.hpp"
+#include "test_utils/network_tests_base.hpp"
+
+using namespace InferenceEngine;
+
+class RequestsBatchingTests : public CPUTestUtils::NetworkTestsBase {
+protected:
+    void SetUp() override {
+        initNetwork(ngraph::builder::subgraph::makeSplitConvConcat());
+    }
+};
+
+TEST_F(RequestsBatchingTests, batchedResultsMatchReference) {
+    auto executableNetwork = ie.LoadNetwork(network, CommonTestUtils::DEVICE_CPU,
+                                            {{CONFIG_KEY(CPU_REQUESTS_BATCH_SIZE), "4"},
+                                             {CONFIG_KEY(CPU_REQUESTS_BATCH_TIMEOUT), "100000"}});
+
+    const size_t numRequests = 8;
+    std::vector<InferRequest> requests;
+    std::vector<Blob::Ptr> inputs;
+    for (size_t i = 0; i < numRequests; ++i) {
+        auto input = createInput();
+        requests.push_back(executableNetwork.CreateInferRequest());
+        ASSERT_NO_THROW(requests.back().SetBlob(inputName, input));
+        inputs.push_back(input);
+    }
+
+    for (auto&& request : requests) {
+        ASSERT_NO_THROW(request.StartAsync());
+    }
+
+    for (size_t i = 0; i < numRequests; ++i) {
+        ASSERT_EQ(StatusCode::OK, requests[i].Wait(IInferRequest::WaitMode::RESULT_READY));
+        compareWithReference(requests[i], inputs[i]);
+    }
+
+    auto histogram = executableNetwork.GetMetric(METRIC_KEY(REQUESTS_BATCH_SIZE_HISTOGRAM)).as<std::vector<unsigned int>>();
+    ASSERT_EQ(5u, histogram.size());
+    size_t inferred = 0;
+    for (size_t batchSize = 0; batchSize < histogram.size(); ++batchSize) {
+        inferred += batchSize * histogram[batchSize];
+    }
+    ASSERT_EQ(numRequests, inferred);
+    ASSERT_GE(executableNetwork.GetMetric(METRIC_KEY(REQUESTS_QUEUEING_DELAY)).as<float>(), 0.f);
+}
+
+TEST_F(RequestsBatchingTests, inputsOfOtherLayoutAndRoiInputsAreBatched) {
+    auto executableNetwork = ie.LoadNetwork(network, CommonTestUtils::DEVICE_CPU,
+                                            {{CONFIG_KEY(CPU_REQUESTS_BATCH_SIZE), "2"},
+                                             {CONFIG_KEY(CPU_REQUESTS_BATCH_TIMEOUT), "100000"}});
+
+    auto input = createInput();
+    auto nhwcInput = FuncTestUtils::convertBlobLayout(input, Layout::NHWC);
+
+    // ROI of a larger input, which data is not dense
+    const auto& desc = input->getTensorDesc();
+    const auto dims = desc.getDims();
+    auto largeDims = dims;
+    largeDims[2] += 2;
+    largeDims[3] += 2;
+    auto largeInput = FuncTestUtils::createAndFillBlob(TensorDesc{desc.getPrecision(), largeDims, Layout::NCHW});
+    auto roiInput = make_shared_blob(largeInput, ROI{0, 1, 1, dims[3], dims[2]});
+    auto roiReferenceInput = make_blob_with_precision(desc);
+    roiReferenceInput->allocate();
+    auto largeData = largeInput->cbuffer().as<const float*>();
+    auto roiReferenceData = roiReferenceInput->buffer().as<float*>();
+    for (size_t c = 0; c < dims[1]; ++c) {
+        for (size_t h = 0; h < dims[2]; ++h) {
+            for (size_t w = 0; w < dims[3]; ++w) {
+                roiReferenceData[(c * dims[2] + h) * dims[3] + w] =
+                    largeData[largeInput->getTensorDesc().offset(SizeVector{0, c, h + 1, w + 1})];
+            }
+        }
+    }
+
+    auto nhwcRequest = executableNetwork.CreateInferRequest();
+    ASSERT_NO_THROW(nhwcRequest.SetBlob(inputName, nhwcInput));
+    auto roiRequest = executableNetwork.CreateInferRequest();
+    ASSERT_NO_THROW(roiRequest.SetBlob(inputName, roiInput));
+    ASSERT_NO_THROW(nhwcRequest.StartAsync());
+    ASSERT_NO_THROW(roiRequest.StartAsync());
+    ASSERT_EQ(StatusCode::OK, nhwcRequest.Wait(IInferRequest::WaitMode::RESULT_READY));
+    ASSERT_EQ(StatusCode::OK, roiRequest.Wait(IInferRequest::WaitMode::RESULT_READY));
+
+    auto histogram = executableNetwork.GetMetric(METRIC_KEY(REQUESTS_BATCH_SIZE_HISTOGRAM)).as<std::vector<unsigned int>>();
+    ASSERT_EQ(1u, histogram[2]);
+    compareWithReference(nhwcRequest, input);
+    compareWithReference(roiRequest, roiReferenceInput);
+}
+
+TEST_F(RequestsBatchingTests, syncInferIsBatched) {
+    auto executableNetwork = ie.LoadNetwork(network, CommonTestUtils::DEVICE_CPU,
+                                            {{CONFIG_KEY(CPU_REQUESTS_BATCH_SIZE), "2"},
+                                             {CONFIG_KEY(CPU_REQUESTS_BATCH_TIMEOUT), "0"}});
+    auto request = executableNetwork.CreateInferRequest();
+    ASSERT_NO_THROW(request.Infer());
+
+    auto histogram = executableNetwork.GetMetric(METRIC_KEY(REQUESTS_BATCH_SIZE_HISTOGRAM)).as<std::vector<unsigned int>>();
+    ASSERT_EQ(1u, histogram[1]);
+}
+
+TEST_F(RequestsBatchingTests, networkWithBatchIsRejected) {
+    network.setBatchSize(2);
+    ASSERT_THROW(ie.LoadNetwork(network, CommonTestUtils::DEVICE_CPU, {{CONFIG_KEY(CPU_REQUESTS_BATCH_SIZE), "2"}}),
+                 details::InferenceEngineException);
+}
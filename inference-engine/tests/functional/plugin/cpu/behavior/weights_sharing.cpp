@@ -0,0 +1,86 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <cstdint>
+#include <map>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include <ie_plugin_config.hpp>
+
+#include "common_test_utils/test_constants.hpp"
+#include "ngraph_functions/subgraph_builders.hpp"
+#include "test_utils/network_tests_base.hpp"
+
+using namespace InferenceEngine;
+
+class WeightsSharingTests : public CPUTestUtils::NetworkTestsBase {
+protected:
+    void SetUp() override {
+        initNetwork(ngraph::builder::subgraph::makeSplitConvConcat());
+    }
+
+    uint64_t getStoredBytes() const {
+        return ie.GetMetric(CommonTestUtils::DEVICE_CPU, METRIC_KEY(SHARED_WEIGHTS_STORED_BYTES)).as<uint64_t>();
+    }
+
+    uint64_t getSavedBytes() const {
+        return ie.GetMetric(CommonTestUtils::DEVICE_CPU, METRIC_KEY(SHARED_WEIGHTS_SAVED_BYTES)).as<uint64_t>();
+    }
+
+    const std::map<std::string, std::string> config = {{CONFIG_KEY(CPU_WEIGHTS_SHARING), CONFIG_VALUE(YES)}};
+};
+
+TEST_F(WeightsSharingTests, weightsAreSharedBetweenNetworks) {
+    auto first = ie.LoadNetwork(network, CommonTestUtils::DEVICE_CPU, config);
+    const auto storedBytes = getStoredBytes();
+    ASSERT_LT(0u, storedBytes);
+    ASSERT_EQ(0u, getSavedBytes());
+
+    {
+        auto second = ie.LoadNetwork(network, CommonTestUtils::DEVICE_CPU, config);
+        ASSERT_EQ(storedBytes, getStoredBytes());
+        ASSERT_EQ(storedBytes, getSavedBytes());
+        ASSERT_NO_THROW(second.CreateInferRequest().Infer());
+    }
+
+    ASSERT_EQ(storedBytes, getStoredBytes());
+    ASSERT_EQ(0u, getSavedBytes());
+    ASSERT_NO_THROW(first.CreateInferRequest().Infer());
+}
+
+TEST_F(WeightsSharingTests, weightsAreReleasedWithLastNetwork) {
+    {
+        auto executableNetwork = ie.LoadNetwork(network, CommonTestUtils::DEVICE_CPU, config);
+        ASSERT_LT(0u, getStoredBytes());
+    }
+    ASSERT_EQ(0u, getStoredBytes());
+}
+
+TEST_F(WeightsSharingTests, weightsAreNotSharedByDefault) {
+    auto first = ie.LoadNetwork(network, CommonTestUtils::DEVICE_CPU);
+    auto second = ie.LoadNetwork(network, CommonTestUtils::DEVICE_CPU);
+    ASSERT_EQ(0u, getStoredBytes());
+    ASSERT_EQ(0u, getSavedBytes());
+}
+
+TEST_F(WeightsSharingTests, streamsOfOneNetworkDoNotSaveBytes) {
+    auto streamsConfig = config;
+    streamsConfig[CONFIG_KEY(CPU_THROUGHPUT_STREAMS)] = "2";
+    auto executableNetwork = ie.LoadNetwork(network, CommonTestUtils::DEVICE_CPU, streamsConfig);
+    // graphs of both streams refer to the same layers, so only one copy of the weights is stored and nothing is saved
+    ASSERT_LT(0u, getStoredBytes());
+    ASSERT_EQ(0u, getSavedBytes());
+}
+
+TEST_F(WeightsSharingTests, weightsOfStreamsAreNotSharedWithOtherNetworks) {
+    const std::map<std::string, std::string> streamsConfig = {{CONFIG_KEY(CPU_THROUGHPUT_STREAMS), "2"}};
+    auto first = ie.LoadNetwork(network, CommonTestUtils::DEVICE_CPU, streamsConfig);
+    auto second = ie.LoadNetwork(network, CommonTestUtils::DEVICE_CPU, streamsConfig);
+    ASSERT_EQ(0u, getStoredBytes());
+    ASSERT_EQ(0u, getSavedBytes());
+    ASSERT_NO_THROW(first.CreateInferRequest().Infer());
+    ASSERT_NO_THROW(second.CreateInferRequest().Infer());
+}
@@ -0,0 +1,124 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <numeric>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <ie_plugin_config.hpp>
+
+#include "common_test_utils/test_constants.hpp"
+#include "functional_test_utils/blob_utils.hpp"
+#include "ngraph_functions/subgraph_builders.hpp"
+#include "test_utils/network_tests_base.hpp"
+
+using namespace InferenceEngine;
+
+class ZeroCopyBlobsTests : public CPUTestUtils::NetworkTestsBase {
+protected:
+    void SetUp() override {
+        initNetwork(ngraph::builder::subgraph::makeSingleConv());
+        inputDesc = network.getInputsInfo().begin()->second->getTensorDesc();
+        outputDesc = network.getOutputsInfo().begin()->second->getTensorDesc();
+        executableNetwork = ie.LoadNetwork(network, CommonTestUtils::DEVICE_CPU);
+    }
+
+    uint64_t getCopiedBytes() const {
+        return executableNetwork.GetMetric(METRIC_KEY(INFER_REQUESTS_COPIED_BYTES)).as<uint64_t>();
+    }
+
+    // bytes copied by a single inference are the growth of the network metric
+    uint64_t inferAndGetCopiedBytes(InferRequest& request) const {
+        const auto copiedBytes = getCopiedBytes();
+        request.Infer();
+        return getCopiedBytes() - copiedBytes;
+    }
+
+    // creates a blob which data is not aligned to the element size, so the plugin cannot use it directly
+    static Blob::Ptr makeMisalignedBlob(const TensorDesc& desc, std::vector<uint8_t>& buffer) {
+        const auto& dims = desc.getDims();
+        const size_t size = std::accumulate(dims.begin(), dims.end(), size_t(1), std::multiplies<size_t>());
+        buffer.resize(size * sizeof(float) + 1);
+        return make_shared_blob<float>(desc, reinterpret_cast<float*>(buffer.data() + 1), size);
+    }
+
+    ExecutableNetwork executableNetwork;
+    TensorDesc inputDesc;
+    TensorDesc outputDesc;
+};
+
+TEST_F(ZeroCopyBlobsTests, compatibleBlobsAreNotCopied) {
+    auto request = executableNetwork.CreateInferRequest();
+    request.SetBlob(inputName, createInput());
+    ASSERT_NO_THROW(request.Infer());
+    ASSERT_EQ(0u, getCopiedBytes());
+}
+
+TEST_F(ZeroCopyBlobsTests, misalignedBlobsAreCopied) {
+    auto input = createInput();
+
+    std::vector<uint8_t> inputBuffer, outputBuffer;
+    auto misalignedInput = makeMisalignedBlob(inputDesc, inputBuffer);
+    std::memcpy(misalignedInput->buffer(), input->cbuffer(), input->byteSize());
+    auto misalignedOutput = makeMisalignedBlob(outputDesc, outputBuffer);
+
+    auto request = executableNetwork.CreateInferRequest();
+    request.SetBlob(inputName, misalignedInput);
+    request.SetBlob(outputName, misalignedOutput);
+    ASSERT_NO_THROW(request.Infer());
+    ASSERT_EQ(misalignedInput->byteSize() + misalignedOutput->byteSize(), getCopiedBytes());
+    FuncTestUtils::compareBlobs(misalignedOutput, inferReference(input));
+}
+
+TEST_F(ZeroCopyBlobsTests, copiedBytesAreCountedPerInference) {
+    std::vector<uint8_t> inputBuffer;
+    auto misalignedInput = makeMisalignedBlob(inputDesc, inputBuffer);
+    auto input = createInput();
+    std::memcpy(misalignedInput->buffer(), input->cbuffer(), input->byteSize());
+
+    auto copyingRequest = executableNetwork.CreateInferRequest();
+    copyingRequest.SetBlob(inputName, misalignedInput);
+    auto request = executableNetwork.CreateInferRequest();
+    request.SetBlob(inputName, createInput());
+
+    ASSERT_EQ(misalignedInput->byteSize(), inferAndGetCopiedBytes(copyingRequest));
+    ASSERT_EQ(0u, inferAndGetCopiedBytes(request));
+    ASSERT_EQ(misalignedInput->byteSize(), inferAndGetCopiedBytes(copyingRequest));
+
+    // the request stops copying once it gets a blob the graph can use directly
+    copyingRequest.SetBlob(inputName, input);
+    ASSERT_EQ(0u, inferAndGetCopiedBytes(copyingRequest));
+    ASSERT_EQ(2 * misalignedInput->byteSize(), getCopiedBytes());
+}
+
+TEST_F(ZeroCopyBlobsTests, previouslyBoundBlobsAreNotOverwritten) {
+    auto input = createInput();
+    auto inputCopy = make_shared_blob<float>(inputDesc);
+    inputCopy->allocate();
+    std::memcpy(inputCopy->buffer(), input->cbuffer(), input->byteSize());
+
+    auto request = executableNetwork.CreateInferRequest();
+    request.SetBlob(inputName, input);
+    ASSERT_NO_THROW(request.Infer());
+    auto output = request.GetBlob(outputName);
+    auto outputCopy = make_shared_blob<float>(outputDesc);
+    outputCopy->allocate();
+    std::memcpy(outputCopy->buffer(), output->cbuffer(), output->byteSize());
+
+    // the graph memory is restored for blobs which cannot be used directly, so the previous ones stay intact
+    std::vector<uint8_t> inputBuffer, outputBuffer;
+    auto misalignedInput = makeMisalignedBlob(inputDesc, inputBuffer);
+    std::memset(misalignedInput->buffer(), 0, misalignedInput->byteSize());
+    request.SetBlob(inputName, misalignedInput);
+    request.SetBlob(outputName, makeMisalignedBlob(outputDesc, outputBuffer));
+    ASSERT_NO_THROW(request.Infer());
+
+    FuncTestUtils::compareBlobs(input, inputCopy);
+    FuncTestUtils::compareBlobs(output, outputCopy);
+}
@@ -0,0 +1,66 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <cstdio>
+#include <fstream>
+#include <map>
+#include <sstream>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include <ie_plugin_config.hpp>
+#include <hetero/hetero_plugin_config.hpp>
+
+#include "common_test_utils/test_constants.hpp"
+#include "ngraph_functions/subgraph_builders.hpp"
+#include "test_utils/network_tests_base.hpp"
+
+using namespace InferenceEngine;
+
+class HeteroPartitioningTests : public CPUTestUtils::NetworkTestsBase {
+protected:
+    void SetUp() override {
+        initNetwork(ngraph::builder::subgraph::makeSplitConvConcat());
+    }
+};
+
+TEST_F(HeteroPartitioningTests, costModelPartitionIsDumped) {
+    std::map<std::string, std::string> config = {{"TARGET_FALLBACK", CommonTestUtils::DEVICE_CPU},
+                                                 {HETERO_CONFIG_KEY(PARTITIONING_POLICY), HeteroConfigParams::HETERO_MIN_LATENCY},
+                                                 {HETERO_CONFIG_KEY(DUMP_GRAPH_DOT), CONFIG_VALUE(YES)}};
+
+    auto queryResult = ie.QueryNetwork(network, CommonTestUtils::DEVICE_HETERO, config);
+    ASSERT_FALSE(queryResult.supportedLayersMap.empty());
+    for (auto&& layer : queryResult.supportedLayersMap) {
+        ASSERT_EQ(CommonTestUtils::DEVICE_CPU, layer.second);
+    }
+
+    auto executableNetwork = ie.LoadNetwork(network, CommonTestUtils::DEVICE_HETERO, config);
+    ASSERT_EQ(HeteroConfigParams::HETERO_MIN_LATENCY,
+              executableNetwork.GetConfig(HETERO_CONFIG_KEY(PARTITIONING_POLICY)).as<std::string>());
+    auto input = createInput();
+    auto request = executableNetwork.CreateInferRequest();
+    request.SetBlob(inputName, input);
+    ASSERT_NO_THROW(request.Infer());
+    compareWithReference(request, input);
+
+    auto dumpName = "hetero_partition_" + network.getName() + ".txt";
+    std::ifstream dump(dumpName);
+    ASSERT_TRUE(dump.is_open());
+    std::stringstream dumpContent;
+    dumpContent << dump.rdbuf();
+    dump.close();
+    std::remove(dumpName.c_str());
+    ASSERT_NE(std::string::npos, dumpContent.str().find("Optimized latency"));
+    ASSERT_NE(std::string::npos, dumpContent.str().find("0 cut edges"));
+}
+
+TEST(HeteroPartitioningTests, unsupportedPolicyIsRejected) {
+    Core ie;
+    CNNNetwork network(ngraph::builder::subgraph::makeSplitConvConcat());
+    ASSERT_ANY_THROW(ie.LoadNetwork(network, CommonTestUtils::DEVICE_HETERO,
+                                    {{"TARGET_FALLBACK", CommonTestUtils::DEVICE_CPU},
+                                     {HETERO_CONFIG_KEY(PARTITIONING_POLICY), "HETERO_RANDOM"}}));
+}
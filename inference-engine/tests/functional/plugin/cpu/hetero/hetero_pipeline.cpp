@@ -0,0 +1,79 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <ie_plugin_config.hpp>
+#include <hetero/hetero_plugin_config.hpp>
+
+#include <ngraph/op/concat.hpp>
+#include <ngraph/variant.hpp>
+
+#include "common_test_utils/test_constants.hpp"
+#include "functional_test_utils/blob_utils.hpp"
+#include "ngraph_functions/subgraph_builders.hpp"
+#include "test_utils/network_tests_base.hpp"
+
+using namespace InferenceEngine;
+
+class HeteroPipelineTests : public CPUTestUtils::NetworkTestsBase {
+protected:
+    void SetUp() override {
+        initNetwork(ngraph::builder::subgraph::makeSplitConvConcat());
+        // HETERO:CPU,CPU collapses into one subnetwork, so the network is split between two instances of the CPU plugin
+        ie.RegisterPlugin("MKLDNNPlugin", "CPU0");
+        ie.RegisterPlugin("MKLDNNPlugin", "CPU1");
+        for (auto&& node : network.getFunction()->get_ordered_ops()) {
+            if (!ngraph::op::is_constant(node) && !ngraph::op::is_parameter(node) && !ngraph::op::is_output(node)) {
+                node->get_rt_info()["affinity"] = std::make_shared<ngraph::VariantWrapper<std::string>>(
+                    ngraph::is_type<ngraph::op::v0::Concat>(node) ? "CPU1" : "CPU0");
+            }
+        }
+    }
+};
+
+TEST_F(HeteroPipelineTests, pipelinedResultsMatchReference) {
+    auto executableNetwork = ie.LoadNetwork(network, "HETERO:CPU0,CPU1", {{HETERO_CONFIG_KEY(PIPELINE_DEPTH), "2"}});
+    ASSERT_EQ(2u, executableNetwork.GetConfig(HETERO_CONFIG_KEY(PIPELINE_DEPTH)).as<unsigned int>());
+
+    // there are more infer requests than intermediate blobs, so some of them wait for the blobs to be released
+    const size_t numRequests = 5;
+    std::vector<InferRequest> requests;
+    std::vector<Blob::Ptr> inputs;
+    for (size_t i = 0; i < numRequests; ++i) {
+        requests.push_back(executableNetwork.CreateInferRequest());
+        inputs.push_back(createInput());
+        requests.back().SetBlob(inputName, inputs.back());
+    }
+    for (auto&& request : requests) {
+        request.StartAsync();
+    }
+    for (size_t i = 0; i < numRequests; ++i) {
+        ASSERT_EQ(StatusCode::OK, requests[i].Wait(IInferRequest::WaitMode::RESULT_READY));
+        compareWithReference(requests[i], inputs[i]);
+    }
+
+    // sync infer requests are executed through the subnetwork pools as well
+    ASSERT_NO_THROW(requests.front().Infer());
+
+    ASSERT_TRUE(hasMetric(executableNetwork, METRIC_KEY(HETERO_STAGE_OCCUPANCY)));
+    ASSERT_TRUE(hasMetric(executableNetwork, METRIC_KEY(HETERO_STAGE_AVERAGE_LATENCY)));
+
+    auto occupancy = executableNetwork.GetMetric(METRIC_KEY(HETERO_STAGE_OCCUPANCY)).as<std::vector<float>>();
+    auto latency = executableNetwork.GetMetric(METRIC_KEY(HETERO_STAGE_AVERAGE_LATENCY)).as<std::vector<float>>();
+    ASSERT_EQ(2u, occupancy.size());
+    ASSERT_EQ(occupancy.size(), latency.size());
+    for (size_t i = 0; i < occupancy.size(); ++i) {
+        ASSERT_GT(occupancy[i], 0.0f);
+        ASSERT_LE(occupancy[i], 2.0f);
+        ASSERT_GT(latency[i], 0.0f);
+    }
+}
+
+TEST_F(HeteroPipelineTests, negativePipelineDepthIsRejected) {
+    ASSERT_ANY_THROW(ie.LoadNetwork(network, "HETERO:CPU0,CPU1", {{HETERO_CONFIG_KEY(PIPELINE_DEPTH), "-1"}}));
+}
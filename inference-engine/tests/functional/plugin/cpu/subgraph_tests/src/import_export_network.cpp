@@ -0,0 +1,111 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <vector>
+#include <memory>
+#include <tuple>
+#include <string>
+#include <sstream>
+
+#include <ie_core.hpp>
+
+#include "common_test_utils/common_utils.hpp"
+#include "functional_test_utils/plugin_cache.hpp"
+#include "functional_test_utils/layer_test_utils.hpp"
+#include "functional_test_utils/blob_utils.hpp"
+#include "ngraph_functions/subgraph_builders.hpp"
+
+typedef std::tuple<
+    InferenceEngine::Precision,         // Network Precision
+    std::string,                        // Target Device
+    std::map<std::string, std::string>  // Export Configuration
+> exportImportNetworkParams;
+
+namespace LayerTestsDefinitions {
+
+class ImportNetworkTest : public testing::WithParamInterface<exportImportNetworkParams>,
+                          public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<exportImportNetworkParams> obj) {
+        InferenceEngine::Precision netPrecision;
+        std::string targetDevice;
+        std::map<std::string, std::string> exportConfiguration;
+        std::tie(netPrecision, targetDevice, exportConfiguration) = obj.param;
+
+        std::ostringstream result;
+        result << "netPRC=" << netPrecision.name() << "_";
+        result << "targetDevice=" << targetDevice;
+        for (auto const& configItem : exportConfiguration) {
+            result << "_exportConfigItem=" << configItem.first << "_" << configItem.second;
+        }
+        return result.str();
+    }
+
+    void Run() override {
+        SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+        LoadNetwork();
+        Infer();
+        const auto& actualOutputs = GetOutputs();
+
+        std::stringstream networkModel;
+        executableNetwork.Export(networkModel);
+
+        auto importedNetwork = core->ImportNetwork(networkModel, targetDevice, {});
+        ASSERT_EQ(executableNetwork.GetInputsInfo().size(), importedNetwork.GetInputsInfo().size());
+        ASSERT_EQ(executableNetwork.GetOutputsInfo().size(), importedNetwork.GetOutputsInfo().size());
+        for (auto&& output : executableNetwork.GetOutputsInfo()) {
+            ASSERT_NE(importedNetwork.GetOutputsInfo().end(), importedNetwork.GetOutputsInfo().find(output.first));
+        }
+
+        auto importedRequest = importedNetwork.CreateInferRequest();
+        const auto& inputsInfo = executableNetwork.GetInputsInfo();
+        auto itInput = inputsInfo.begin();
+        for (std::size_t i = 0; i < inputs.size(); ++i, ++itInput) {
+            importedRequest.SetBlob(itInput->first, inputs[i]);
+        }
+        importedRequest.Infer();
+
+        std::vector<std::vector<std::uint8_t>> importedOutputs;
+        for (auto&& output : executableNetwork.GetOutputsInfo()) {
+            auto importedMemory = InferenceEngine::as<InferenceEngine::MemoryBlob>(importedRequest.GetBlob(output.first));
+            IE_ASSERT(importedMemory);
+            const auto lockedMemory = importedMemory->rmap();
+            const auto buffer = lockedMemory.as<const std::uint8_t*>();
+            importedOutputs.emplace_back(buffer, buffer + importedMemory->byteSize());
+        }
+        Compare(importedOutputs, actualOutputs);
+    }
+
+protected:
+    void SetUp() override {
+        InferenceEngine::Precision netPrecision;
+        std::tie(netPrecision, targetDevice, configuration) = this->GetParam();
+        auto ngPrc = FuncTestUtils::PrecisionUtils::convertIE2nGraphPrc(netPrecision);
+        function = ngraph::builder::subgraph::makeSplitConvConcat({1, 4, 20, 20}, ngPrc);
+    }
+};
+
+TEST_P(ImportNetworkTest, CompareWithExported) {
+    Run();
+};
+
+const std::vector<InferenceEngine::Precision> netPrecisions = {
+    InferenceEngine::Precision::FP32,
+    InferenceEngine::Precision::FP16
+};
+
+const std::vector<std::map<std::string, std::string>> exportConfigs = {
+    {},
+    {{InferenceEngine::PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS, "2"}},
+};
+
+INSTANTIATE_TEST_CASE_P(smoke_ImportNetworkCase, ImportNetworkTest,
+    ::testing::Combine(
+        ::testing::ValuesIn(netPrecisions),
+        ::testing::Values(CommonTestUtils::DEVICE_CPU),
+        ::testing::ValuesIn(exportConfigs)),
+    ImportNetworkTest::getTestCaseName);
+
+}  // namespace LayerTestsDefinitions
@@ -0,0 +1,222 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <tuple>
+#include <vector>
+
+#include <ie_plugin_config.hpp>
+#include <ngraph/opsets/opset3.hpp>
+#include <ngraph/variant.hpp>
+
+#include "common_test_utils/common_utils.hpp"
+#include "common_test_utils/data_utils.hpp"
+#include "functional_test_utils/layer_test_utils.hpp"
+#include "ngraph_functions/builders.hpp"
+#include "ngraph_functions/subgraph_builders.hpp"
+
+typedef std::tuple<
+    std::string,                        // Function name
+    std::map<std::string, std::string>  // Configuration
+> interOpParallelismParams;
+
+namespace LayerTestsDefinitions {
+
+namespace {
+
+const std::map<std::string, std::function<std::shared_ptr<ngraph::Function>()>> functions = {
+    {"SplitConvConcat", [] { return ngraph::builder::subgraph::makeSplitConvConcat(); }},
+    {"NestedSplitConvConcat", [] { return ngraph::builder::subgraph::makeNestedSplitConvConcat(); }},
+    {"SplitConvConcatNestedInBranch", [] { return ngraph::builder::subgraph::makeSplitConvConcatNestedInBranch(); }},
+};
+
+struct ExecutionInterval {
+    std::string layerType;
+    int64_t start;
+    int64_t finish;
+};
+
+// Bounds of the latest execution of nodes which were executed, taken from the execution graph
+std::vector<ExecutionInterval> getExecutionIntervals(InferenceEngine::ExecutableNetwork& executableNetwork) {
+    auto execGraph = executableNetwork.GetExecGraphInfo().getFunction();
+    IE_ASSERT(execGraph != nullptr);
+
+    std::vector<ExecutionInterval> intervals;
+    for (const auto& op : execGraph->get_ops()) {
+        const auto& rtInfo = op->get_rt_info();
+        auto getValue = [&rtInfo](const std::string& name) -> std::string {
+            auto it = rtInfo.find(name);
+            auto value = it != rtInfo.end() ? std::dynamic_pointer_cast<ngraph::VariantImpl<std::string>>(it->second)
+                                            : nullptr;
+            return value ? value->get() : std::string{};
+        };
+
+        auto start = getValue("execStartNs"), finish = getValue("execFinishNs");
+        if (!start.empty() && !finish.empty())
+            intervals.push_back({getValue("layerType"), std::stoll(start), std::stoll(finish)});
+    }
+    return intervals;
+}
+
+bool hasOverlappingIntervals(const std::vector<ExecutionInterval>& intervals) {
+    for (size_t i = 0; i < intervals.size(); i++) {
+        for (size_t j = i + 1; j < intervals.size(); j++) {
+            if (intervals[i].start < intervals[j].finish && intervals[j].start < intervals[i].finish)
+                return true;
+        }
+    }
+    return false;
+}
+
+/*
+ * The state is read and written by different branches, which are not connected by edges:
+ *
+ *   [ReadValue]     [input]
+ *        |           |
+ *        |        [Split]
+ *        |        |     |
+ *        +-----[Add]  [Relu]-----[Assign]
+ *                 |     |
+ *                [Concat]
+ *
+ * Split and Concat are in-place, so Add and Relu read and write views of their memory.
+ */
+std::shared_ptr<ngraph::Function> makeMemoryAcrossBranches(const ngraph::Shape& inputShape = {1, 4, 10, 10}) {
+    auto halfShape = inputShape;
+    halfShape[1] /= 2;
+
+    auto input = std::make_shared<ngraph::opset3::Parameter>(ngraph::element::f32, inputShape);
+    input->set_friendly_name("input");
+    auto split = ngraph::builder::makeSplit(input, ngraph::element::f32, 2, 1);
+
+    auto initState = ngraph::opset3::Constant::create(ngraph::element::f32, halfShape, {0});
+    auto readState = std::make_shared<ngraph::opset3::ReadValue>(initState, "state");
+    auto add = std::make_shared<ngraph::opset3::Add>(readState, split->output(0));
+
+    auto relu = std::make_shared<ngraph::opset3::Relu>(split->output(1));
+    auto assignState = std::make_shared<ngraph::opset3::Assign>(relu, "state");
+
+    auto concat = std::make_shared<ngraph::opset3::Concat>(ngraph::OutputVector{add, relu}, 1);
+    concat->set_friendly_name("output");
+
+    // ngraph keeps Assign only if it is a control dependency of a node which is kept itself
+    assignState->add_control_dependency(readState);
+    concat->add_control_dependency(assignState);
+
+    return std::make_shared<ngraph::Function>(ngraph::NodeVector{concat}, ngraph::ParameterVector{input});
+}
+
+}  // namespace
+
+class InterOpParallelismTest : public testing::WithParamInterface<interOpParallelismParams>,
+                               public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<interOpParallelismParams> obj) {
+        std::string functionName;
+        std::map<std::string, std::string> config;
+        std::tie(functionName, config) = obj.param;
+
+        std::ostringstream result;
+        result << "function=" << functionName;
+        for (auto const& configItem : config) {
+            result << "_configItem=" << configItem.first << "_" << configItem.second;
+        }
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        std::string functionName;
+        std::tie(functionName, configuration) = this->GetParam();
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        function = functions.at(functionName)();
+    }
+};
+
+TEST_P(InterOpParallelismTest, CompareWithRefs) {
+    Run();
+};
+
+TEST_P(InterOpParallelismTest, IndependentBranchesOverlap) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+    if (std::thread::hardware_concurrency() < 2)
+        GTEST_SKIP() << "Branches cannot overlap on a single core";
+
+    LoadNetwork();
+    Infer();
+
+    // Nodes of a stage overlap only if idle threads manage to take their tasks in time, so give them some attempts
+    bool overlapped = hasOverlappingIntervals(getExecutionIntervals(executableNetwork));
+    for (int attempt = 0; attempt < 100 && !overlapped; attempt++) {
+        inferRequest.Infer();
+        overlapped = hasOverlappingIntervals(getExecutionIntervals(executableNetwork));
+    }
+    ASSERT_TRUE(overlapped);
+}
+
+TEST(smoke_InterOpParallelismMemory, StateIsReadBeforeItIsWritten) {
+    auto ie = PluginCache::get().ie();
+    const std::map<std::string, std::string> config = {
+        {InferenceEngine::PluginConfigParams::KEY_CPU_INTER_OP_PARALLELISM, InferenceEngine::PluginConfigParams::YES}};
+    auto executableNetwork = ie->LoadNetwork(InferenceEngine::CNNNetwork(makeMemoryAcrossBranches()),
+                                             CommonTestUtils::DEVICE_CPU, config);
+    auto inferRequest = executableNetwork.CreateInferRequest();
+    auto input = inferRequest.GetBlob("input");
+    auto output = InferenceEngine::as<InferenceEngine::MemoryBlob>(inferRequest.GetBlob("output"));
+    ASSERT_NE(nullptr, output);
+
+    // Add outputs the input of the previous inference plus the current one, Relu outputs the current input
+    float previousValue = 0.f;
+    for (float value : {1.f, 2.f, 3.f}) {
+        CommonTestUtils::fill_data_const(input, value);
+        inferRequest.Infer();
+
+        auto lockedOutput = output->rmap();
+        auto outputData = lockedOutput.as<const float*>();
+        const size_t halfSize = output->size() / 2;
+        for (size_t i = 0; i < halfSize; i++) {
+            ASSERT_EQ(previousValue + value, outputData[i]) << "at index " << i;
+            ASSERT_EQ(value, outputData[halfSize + i]) << "at index " << halfSize + i;
+        }
+        previousValue = value;
+    }
+
+    const auto intervals = getExecutionIntervals(executableNetwork);
+    auto findInterval = [&intervals](const std::string& layerType) {
+        return std::find_if(intervals.begin(), intervals.end(), [&](const ExecutionInterval& interval) {
+            return interval.layerType == layerType;
+        });
+    };
+    auto readState = findInterval("MemoryInput"), writeState = findInterval("MemoryOutput");
+    ASSERT_NE(intervals.end(), readState);
+    ASSERT_NE(intervals.end(), writeState);
+    ASSERT_LE(readState->finish, writeState->start);
+}
+
+const std::vector<std::string> functionNames = {
+    "SplitConvConcat",
+    "NestedSplitConvConcat",
+    "SplitConvConcatNestedInBranch",
+};
+
+const std::vector<std::map<std::string, std::string>> configs = {
+    {{InferenceEngine::PluginConfigParams::KEY_CPU_INTER_OP_PARALLELISM, InferenceEngine::PluginConfigParams::YES}},
+    {{InferenceEngine::PluginConfigParams::KEY_CPU_INTER_OP_PARALLELISM, InferenceEngine::PluginConfigParams::YES},
+     {InferenceEngine::PluginConfigParams::KEY_PERF_COUNT, InferenceEngine::PluginConfigParams::YES}},
+};
+
+INSTANTIATE_TEST_CASE_P(smoke_InterOpParallelism, InterOpParallelismTest,
+    ::testing::Combine(
+        ::testing::ValuesIn(functionNames),
+        ::testing::ValuesIn(configs)),
+    InterOpParallelismTest::getTestCaseName);
+
+}  // namespace LayerTestsDefinitions
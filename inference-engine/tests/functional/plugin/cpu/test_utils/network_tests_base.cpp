@@ -0,0 +1,55 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "network_tests_base.hpp"
+
+#include <algorithm>
+
+#include <ie_plugin_config.hpp>
+#include <ngraph/graph_util.hpp>
+
+#include "common_test_utils/test_constants.hpp"
+#include "functional_test_utils/blob_utils.hpp"
+
+using namespace InferenceEngine;
+
+namespace CPUTestUtils {
+
+void NetworkTestsBase::initNetwork(const std::shared_ptr<ngraph::Function>& function) {
+    network = CNNNetwork(function);
+    inputName = network.getInputsInfo().begin()->first;
+    outputName = network.getOutputsInfo().begin()->first;
+    referenceNetworks.clear();
+}
+
+Blob::Ptr NetworkTestsBase::createInput() const {
+    return FuncTestUtils::createAndFillBlob(network.getInputsInfo().begin()->second->getTensorDesc());
+}
+
+Blob::Ptr NetworkTestsBase::inferReference(const Blob::Ptr& input) {
+    const auto& dims = input->getTensorDesc().getDims();
+    auto it = referenceNetworks.find(dims);
+    if (it == referenceNetworks.end()) {
+        CNNNetwork reference(ngraph::clone_function(*network.getFunction()));
+        if (reference.getInputsInfo().begin()->second->getTensorDesc().getDims() != dims) {
+            reference.reshape({{inputName, dims}});
+        }
+        it = referenceNetworks.emplace(dims, ie.LoadNetwork(reference, CommonTestUtils::DEVICE_CPU)).first;
+    }
+    auto request = it->second.CreateInferRequest();
+    request.SetBlob(inputName, input);
+    request.Infer();
+    return request.GetBlob(outputName);
+}
+
+void NetworkTestsBase::compareWithReference(InferRequest& request, const Blob::Ptr& input) {
+    FuncTestUtils::compareBlobs(request.GetBlob(outputName), inferReference(input));
+}
+
+bool NetworkTestsBase::hasMetric(const ExecutableNetwork& executableNetwork, const std::string& metric) {
+    auto metrics = executableNetwork.GetMetric(METRIC_KEY(SUPPORTED_METRICS)).as<std::vector<std::string>>();
+    return std::find(metrics.begin(), metrics.end(), metric) != metrics.end();
+}
+
+}  // namespace CPUTestUtils
@@ -0,0 +1,48 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <ie_core.hpp>
+#include <ngraph/function.hpp>
+
+namespace CPUTestUtils {
+
+/**
+ * Fixture for the tests which load a single input / single output network and check
+ * infer request results against the same network loaded to the CPU plugin with the default configuration
+ */
+class NetworkTestsBase : public ::testing::Test {
+protected:
+    void initNetwork(const std::shared_ptr<ngraph::Function>& function);
+
+    InferenceEngine::Blob::Ptr createInput() const;
+
+    /**
+     * Infers the input with the reference network. The network is reshaped to the input dimensions
+     * if they differ from the original ones.
+     */
+    InferenceEngine::Blob::Ptr inferReference(const InferenceEngine::Blob::Ptr& input);
+
+    void compareWithReference(InferenceEngine::InferRequest& request, const InferenceEngine::Blob::Ptr& input);
+
+    static bool hasMetric(const InferenceEngine::ExecutableNetwork& executableNetwork, const std::string& metric);
+
+    InferenceEngine::Core ie;
+    InferenceEngine::CNNNetwork network;
+    std::string inputName;
+    std::string outputName;
+
+private:
+    std::map<InferenceEngine::SizeVector, InferenceEngine::ExecutableNetwork> referenceNetworks;
+};
+
+}  // namespace CPUTestUtils
@@ -0,0 +1,115 @@
+// Copyright (C) 2020 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <cpp/ie_cnn_network.h>
+#include <ngraph/ngraph.hpp>
+#include <ngraph/opsets/opset1.hpp>
+
+#include "hetero_partitioner.hpp"
+
+using namespace HeteroPlugin;
+
+class CostModelPartitionerTests : public ::testing::Test {
+protected:
+    // conv -> relu -> softmax, the convolution is much faster on GPU and the softmax is supported by CPU only
+    void SetUp() override {
+        graph._layers = {{"conv",    {"CPU", "GPU"}, {{"CPU", 100.0}, {"GPU", 10.0}}},
+                         {"relu",    {"CPU", "GPU"}, {{"CPU", 5.0},   {"GPU", 5.0}}},
+                         {"softmax", {"CPU"},        {{"CPU", 1.0}}}};
+        graph._edges = {{0, 1, 1000}, {1, 2, 1000}};
+        graph._attachedLayers = {{"input", 0}, {"weights", 0}, {"output", 2}};
+    }
+
+    PartitionGraph graph;
+    std::vector<std::string> priorityAffinities = {"CPU", "CPU", "CPU"};
+};
+
+TEST_F(CostModelPartitionerTests, layerIsMovedToFasterDeviceWithItsConstants) {
+    CostModelPartitioner partitioner{graph, 1e-4, 20.0};
+    auto initial = partitioner.Evaluate(priorityAffinities);
+    auto optimized = partitioner.Optimize(priorityAffinities);
+
+    ASSERT_EQ((std::vector<std::string>{"GPU", "CPU", "CPU"}), optimized._affinities);
+    ASSERT_LT(optimized.GetCost(), initial.GetCost());
+    ASSERT_EQ(1u, optimized._cutEdges);
+    ASSERT_EQ(1000u, optimized._cutBytes);
+    ASSERT_DOUBLE_EQ(10.0 + 5.0 + 1.0, optimized._computeCost);
+    ASSERT_DOUBLE_EQ(20.0 + 1e-4 * 1000, optimized._transferCost);
+
+    auto affinities = graph.GetAffinities(optimized._affinities);
+    ASSERT_EQ(6u, affinities.size());
+    ASSERT_EQ("GPU", affinities.at("conv"));
+    ASSERT_EQ("CPU", affinities.at("relu"));
+    ASSERT_EQ("CPU", affinities.at("softmax"));
+    ASSERT_EQ("GPU", affinities.at("input"));
+    ASSERT_EQ("GPU", affinities.at("weights"));
+    ASSERT_EQ("CPU", affinities.at("output"));
+}
+
+TEST_F(CostModelPartitionerTests, layersStayOnOneDeviceIfTransfersAreExpensive) {
+    CostModelPartitioner partitioner{graph, 1e-4, 1000.0};
+    auto optimized = partitioner.Optimize(priorityAffinities);
+
+    ASSERT_EQ(priorityAffinities, optimized._affinities);
+    ASSERT_EQ(0u, optimized._cutEdges);
+    for (auto&& affinity : graph.GetAffinities(optimized._affinities)) {
+        ASSERT_EQ("CPU", affinity.second) << affinity.first;
+    }
+}
+
+TEST_F(CostModelPartitionerTests, layerIsMovedToCutSmallerTensor) {
+    graph._layers[1]._costs["GPU"] = 4.0;
+    graph._edges[1]._bytes = 100000;
+    CostModelPartitioner partitioner{graph, 1e-4, 20.0};
+    // the relu is a bit faster on GPU, but its output is larger than its input
+    auto optimized = partitioner.Optimize({"GPU", "GPU", "CPU"});
+
+    ASSERT_EQ((std::vector<std::string>{"GPU", "CPU", "CPU"}), optimized._affinities);
+    auto affinities = graph.GetAffinities(optimized._affinities);
+    ASSERT_EQ("GPU", affinities.at("weights"));
+    ASSERT_EQ("CPU", affinities.at("output"));
+}
+
+TEST(PartitionGraphTests, constantsParametersAndResultsAreAttachedToConnectedLayers) {
+    auto param = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{1, 8});
+    param->set_friendly_name("input");
+    auto weights = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{1, 8}, {1.0f});
+    weights->set_friendly_name("weights");
+    auto add = std::make_shared<ngraph::opset1::Add>(param, weights);
+    add->set_friendly_name("add");
+    auto relu = std::make_shared<ngraph::opset1::Relu>(add);
+    relu->set_friendly_name("relu");
+    auto result = std::make_shared<ngraph::opset1::Result>(relu);
+    result->set_friendly_name("output");
+    InferenceEngine::CNNNetwork network{std::make_shared<ngraph::Function>(ngraph::ResultVector{result},
+                                                                           ngraph::ParameterVector{param})};
+
+    std::map<std::string, std::map<std::string, std::string>> supportedLayers = {
+        {"CPU", {{"input", "CPU"}, {"weights", "CPU"}, {"add", "CPU"}, {"relu", "CPU"}, {"output", "CPU"}}},
+        {"GPU", {{"add", "GPU"}}}};
+    auto graph = buildPartitionGraph(network, supportedLayers, {"CPU", "GPU"});
+
+    ASSERT_EQ(2u, graph._layers.size());
+    ASSERT_EQ(1u, graph._edges.size());
+    ASSERT_EQ(8 * sizeof(float), graph._edges.front()._bytes);
+    ASSERT_EQ(3u, graph._attachedLayers.size());
+
+    std::vector<std::string> affinities;
+    for (auto&& layer : graph._layers) {
+        affinities.push_back(layer._name == "add" ? "GPU" : "CPU");
+    }
+    auto allAffinities = graph.GetAffinities(affinities);
+    ASSERT_EQ("GPU", allAffinities.at("input"));
+    ASSERT_EQ("GPU", allAffinities.at("weights"));
+    ASSERT_EQ("GPU", allAffinities.at("add"));
+    ASSERT_EQ("CPU", allAffinities.at("relu"));
+    ASSERT_EQ("CPU", allAffinities.at("output"));
+}
@@ -47,6 +47,7 @@ public:
 
 class NV12BlobTests : public CompoundBlobTests {};
 class I420BlobTests : public CompoundBlobTests {};
+class BatchedBlobTests : public CompoundBlobTests {};
 
 TEST(BlobConversionTests, canWorkWithMemoryBlob) {
     Blob::Ptr blob = make_shared_blob<uint8_t>(TensorDesc(Precision::U8, {1, 3, 4, 4}, NCHW));
@@ -424,4 +425,77 @@ TEST_F(I420BlobTests, cannotCreateI420BlobFromPlanesWithWrongHeightRatio) {
     EXPECT_THROW(make_shared_blob<I420Blob>(y_blob, v_blob, u_blob), InferenceEngine::details::InferenceEngineException);
 }
 
+TEST_F(BatchedBlobTests, canCreateBatchedBlobFromMemoryBlobs) {
+    Blob::Ptr blob1 = make_shared_blob<uint8_t>(TensorDesc(Precision::U8, {1, 3, 4, 4}, NHWC));
+    Blob::Ptr blob2 = make_shared_blob<uint8_t>(TensorDesc(Precision::U8, {1, 3, 8, 6}, NHWC));
+    BlobPtrs blobs = {blob1, blob2};
 
+    _test_blob = make_shared_blob<BatchedBlob>(blobs);
+    verifyCompoundBlob(_test_blob, blobs);
+    EXPECT_EQ(Precision::U8, _test_blob->getTensorDesc().getPrecision());
+    EXPECT_EQ(NHWC, _test_blob->getTensorDesc().getLayout());
+}
+
+TEST_F(BatchedBlobTests, canCreateBatchedBlobFromNV12Blobs) {
+    Blob::Ptr y_blob = make_shared_blob<uint8_t>(TensorDesc(Precision::U8, {1, 1, 6, 8}, NHWC));
+    Blob::Ptr uv_blob = make_shared_blob<uint8_t>(TensorDesc(Precision::U8, {1, 2, 3, 4}, NHWC));
+    Blob::Ptr nv12_blob = make_shared_blob<NV12Blob>(y_blob, uv_blob);
+    BlobPtrs blobs = {nv12_blob, nv12_blob};
+
+    _test_blob = make_shared_blob<BatchedBlob>(blobs);
+    verifyCompoundBlob(_test_blob, blobs);
+}
+
+TEST_F(BatchedBlobTests, cannotCreateEmptyBatchedBlob) {
+    EXPECT_THROW(make_shared_blob<BatchedBlob>(std::vector<Blob::Ptr>()),
+        InferenceEngine::details::InferenceEngineException);
+}
+
+TEST_F(BatchedBlobTests, cannotCreateBatchedBlobFromNullptr) {
+    Blob::Ptr valid = make_shared_blob<uint8_t>(TensorDesc(Precision::U8, {1, 3, 4, 4}, NCHW));
+    EXPECT_THROW(make_shared_blob<BatchedBlob>(std::vector<Blob::Ptr>({valid, nullptr})),
+        InferenceEngine::details::InferenceEngineException);
+}
+
+TEST_F(BatchedBlobTests, cannotCreateBatchedBlobFromBatchedBlob) {
+    Blob::Ptr blob = make_shared_blob<uint8_t>(TensorDesc(Precision::U8, {1, 3, 4, 4}, NCHW));
+    Blob::Ptr batched_blob = make_shared_blob<BatchedBlob>(std::vector<Blob::Ptr>({blob}));
+    EXPECT_THROW(make_shared_blob<BatchedBlob>(std::vector<Blob::Ptr>({batched_blob})),
+        InferenceEngine::details::InferenceEngineException);
+}
+
+TEST_F(BatchedBlobTests, cannotCreateBatchedBlobFromInconsistentBlobs) {
+    Blob::Ptr blob = make_shared_blob<uint8_t>(TensorDesc(Precision::U8, {1, 3, 4, 4}, NCHW));
+    Blob::Ptr fp32_blob = make_shared_blob<float>(TensorDesc(Precision::FP32, {1, 3, 4, 4}, NCHW));
+    Blob::Ptr nhwc_blob = make_shared_blob<uint8_t>(TensorDesc(Precision::U8, {1, 3, 4, 4}, NHWC));
+    Blob::Ptr one_channel_blob = make_shared_blob<uint8_t>(TensorDesc(Precision::U8, {1, 1, 4, 4}, NCHW));
+    Blob::Ptr batch_blob = make_shared_blob<uint8_t>(TensorDesc(Precision::U8, {2, 3, 4, 4}, NCHW));
+
+    EXPECT_THROW(make_shared_blob<BatchedBlob>(std::vector<Blob::Ptr>({blob, fp32_blob})),
+        InferenceEngine::details::InferenceEngineException);
+    EXPECT_THROW(make_shared_blob<BatchedBlob>(std::vector<Blob::Ptr>({blob, nhwc_blob})),
+        InferenceEngine::details::InferenceEngineException);
+    EXPECT_THROW(make_shared_blob<BatchedBlob>(std::vector<Blob::Ptr>({blob, one_channel_blob})),
+        InferenceEngine::details::InferenceEngineException);
+    EXPECT_THROW(make_shared_blob<BatchedBlob>(std::vector<Blob::Ptr>({batch_blob})),
+        InferenceEngine::details::InferenceEngineException);
+}
+
+TEST_F(BatchedBlobTests, canCreateBatchOfROIsWithoutCopy) {
+    auto frame = make_shared_blob<uint8_t>(TensorDesc(Precision::U8, {1, 3, 16, 16}, NHWC));
+    frame->allocate();
+
+    _test_blob = make_shared_blob(frame, {ROI(0, 0, 0, 4, 4), ROI(0, 8, 2, 6, 10)});
+    verifyCompoundBlob(_test_blob);
+    ASSERT_TRUE(_test_blob->is<BatchedBlob>());
+
+    auto batched_blob = as<BatchedBlob>(_test_blob);
+    ASSERT_EQ(2, batched_blob->size());
+
+    auto roi = as<MemoryBlob>(batched_blob->getBlob(1));
+    ASSERT_NE(nullptr, roi);
+    EXPECT_EQ(SizeVector({1, 3, 10, 6}), roi->getTensorDesc().getDims());
+    // the ROI blob shares the memory of the frame
+    EXPECT_EQ(frame->buffer().as<uint8_t*>(), roi->buffer().as<uint8_t*>());
+    EXPECT_EQ((2 * 16 + 8) * 3, roi->getTensorDesc().getBlockingDesc().getOffsetPadding());
+}
@@ -17,11 +17,14 @@
 
 #include <cstdarg>
 #include <cstdio>
+#include <cstring>
 #include <ctime>
 
 #include <chrono>
 
 #include <map>
+#include <thread>
+#include <vector>
 
 #include <stdexcept>
 
@@ -132,6 +135,43 @@ cv::String layoutToString(InferenceEngine::Layout l) {
 #endif  // PERF_TEST
 
 test::Mat to_test(cv::Mat& mat) { return {mat.rows, mat.cols, mat.type(), mat.data, mat.step}; }
+
+// reference nearest neighbour resize: takes the source pixel under the center of the destination one
+// (unlike cv::INTER_NEAREST which takes the one under the top-left corner)
+void resizeNearest(const cv::Mat& in, cv::Mat& out, cv::Size sz_out)
+{
+    out.create(sz_out, in.type());
+    const double fx = static_cast<double>(in.cols) / sz_out.width;
+    const double fy = static_cast<double>(in.rows) / sz_out.height;
+    const size_t elem_size = in.elemSize();
+    for (int y = 0; y < sz_out.height; y++) {
+        const int sy = std::min(static_cast<int>((y + 0.5) * fy), in.rows - 1);
+        for (int x = 0; x < sz_out.width; x++) {
+            const int sx = std::min(static_cast<int>((x + 0.5) * fx), in.cols - 1);
+            std::memcpy(out.ptr(y) + x * elem_size, in.ptr(sy) + sx * elem_size, elem_size);
+        }
+    }
+}
+
+void resizeRef(const cv::Mat& in, cv::Mat& out, cv::Size sz_out, int interp)
+{
+    if (cv::INTER_NEAREST == interp) {
+        resizeNearest(in, out, sz_out);
+    } else {
+        cv::resize(in, out, sz_out, 0, 0, interp);
+    }
+}
+
+InferenceEngine::ResizeAlgorithm toResizeAlgorithm(int interp)
+{
+    switch (interp) {
+    case cv::INTER_AREA:    return InferenceEngine::RESIZE_AREA;
+    case cv::INTER_LINEAR:  return InferenceEngine::RESIZE_BILINEAR;
+    case cv::INTER_NEAREST: return InferenceEngine::RESIZE_NEAREST;
+    }
+    CV_Assert(!"ERROR: unsupported interpolation!");
+    return InferenceEngine::NO_RESIZE;
+}
 std::vector<test::Mat> to_test(std::vector<cv::Mat>& mats)
 {
     std::vector<test::Mat> test_mats(mats.size());
@@ -659,6 +699,39 @@ TEST_P(ConvertDepthTestGAPI, AccuracyTest)
         EXPECT_LE(cv::norm(out_mat_ocv, out_mat_gapi, cv::NORM_INF), tolerance);
     }
 }
+
+TEST_P(NormalizePlaneTestGAPI, AccuracyTest)
+{
+    const auto params = GetParam();
+    int in_depth      = std::get<0>(params);
+    cv::Size sz       = std::get<1>(params);
+    double tolerance  = std::get<2>(params);
+
+    const int out_type = CV_32FC1;
+    const float mean  = 103.94f;
+    const float scale = 0.017f;
+
+    initMatrixRandU(CV_MAKETYPE(in_depth,1), sz, out_type);
+
+    // G-API code //////////////////////////////////////////////////////////////
+    NormalizePlaneComputation cc(to_test(in_mat1), to_test(out_mat_gapi), mean, scale);
+    cc.warmUp();
+
+#if PERF_TEST
+    // iterate testing, and print performance
+    test_ms([&](){ cc.apply(); },
+        400, "Normalize GAPI %s %dx%d", depthToString(in_mat1.depth()).c_str(), sz.width, sz.height);
+#endif
+
+    // OpenCV code /////////////////////////////////////////////////////////////
+    {
+        in_mat1.convertTo(out_mat_ocv, out_type, scale, -mean * scale);
+    }
+    // Comparison //////////////////////////////////////////////////////////////
+    {
+        EXPECT_LE(cv::norm(out_mat_ocv, out_mat_gapi, cv::NORM_INF), tolerance);
+    }
+}
 //----------------------------------------------------------------------
 
 TEST_P(ResizeTestIE, AccuracyTest)
@@ -687,7 +760,7 @@ TEST_P(ResizeTestIE, AccuracyTest)
     int depth = CV_MAT_DEPTH(type);
     CV_Assert(CV_8U == depth || CV_32F == depth);
 
-    CV_Assert(cv::INTER_AREA == interp || cv::INTER_LINEAR == interp);
+    CV_Assert(cv::INTER_AREA == interp || cv::INTER_LINEAR == interp || cv::INTER_NEAREST == interp);
 
     ASSERT_TRUE(in_mat1.isContinuous() && out_mat.isContinuous());
 
@@ -710,9 +783,8 @@ TEST_P(ResizeTestIE, AccuracyTest)
     PreProcessDataPtr preprocess = CreatePreprocDataHelper();
     preprocess->setRoiBlob(in_blob);
 
-    ResizeAlgorithm algorithm = cv::INTER_AREA == interp ? RESIZE_AREA : RESIZE_BILINEAR;
     PreProcessInfo info;
-    info.setResizeAlgorithm(algorithm);
+    info.setResizeAlgorithm(toResizeAlgorithm(interp));
 
     // test once to warm-up cache
     preprocess->execute(out_blob, info, false);
@@ -727,7 +799,7 @@ TEST_P(ResizeTestIE, AccuracyTest)
 
     // OpenCV code /////////////////////////////////////////////////////////////
     {
-        cv::resize(in_mat1, out_mat_ocv, sz_out, 0, 0, interp);
+        resizeRef(in_mat1, out_mat_ocv, sz_out, interp);
     }
     // Comparison //////////////////////////////////////////////////////////////
     {
@@ -735,6 +807,201 @@ TEST_P(ResizeTestIE, AccuracyTest)
     }
 }
 
+TEST_P(LetterboxTestIE, AccuracyTest)
+{
+    int type = 0, interp = 0;
+    cv::Size sz_in, sz_out;
+    double tolerance = 0.0;
+    std::pair<cv::Size, cv::Size> sizes;
+    std::tie(type, interp, sizes, tolerance) = GetParam();
+    std::tie(sz_in, sz_out) = sizes;
+
+    const float pad_value = 114.f;
+
+    cv::Mat in_mat1(sz_in, type);
+    cv::randn(in_mat1, cv::Scalar::all(127), cv::Scalar::all(40.f));
+
+    // the border must be overwritten by pre-processing
+    cv::Mat out_mat(sz_out, type, cv::Scalar::all(0));
+    cv::Mat out_mat_ocv(sz_out, type, cv::Scalar::all(pad_value));
+
+    // Inference Engine code ///////////////////////////////////////////////////
+
+    size_t channels = out_mat.channels();
+    int depth = CV_MAT_DEPTH(type);
+    CV_Assert(CV_8U == depth || CV_32F == depth);
+
+    using namespace InferenceEngine;
+
+    SizeVector  in_sv = { 1, channels, static_cast<size_t>(sz_in.height),  static_cast<size_t>(sz_in.width) };
+    SizeVector out_sv = { 1, channels, static_cast<size_t>(sz_out.height), static_cast<size_t>(sz_out.width) };
+
+    Precision precision = CV_8U == depth ? Precision::U8 : Precision::FP32;
+    Blob::Ptr in_blob  = make_blob_with_precision(TensorDesc(precision,  in_sv, Layout::NHWC), in_mat1.data);
+    Blob::Ptr out_blob = make_blob_with_precision(TensorDesc(precision, out_sv, Layout::NHWC), out_mat.data);
+
+    PreProcessDataPtr preprocess = CreatePreprocDataHelper();
+    preprocess->setRoiBlob(in_blob);
+
+    PreProcessInfo info;
+    info.setResizeAlgorithm(toResizeAlgorithm(interp));
+    info.setLetterbox(true, pad_value);
+
+    // test once to warm-up cache
+    preprocess->execute(out_blob, info, false);
+
+#if PERF_TEST
+    // iterate testing, and print performance
+    test_ms([&](){ preprocess->execute(out_blob, info, false); },
+            100, "Letterbox IE %s %s %dx%d -> %dx%d",
+            interpToString(interp).c_str(), typeToString(type).c_str(),
+            sz_in.width, sz_in.height, sz_out.width, sz_out.height);
+#endif
+
+    // OpenCV code /////////////////////////////////////////////////////////////
+    {
+        const double scale = std::min(static_cast<double>(sz_out.width) / sz_in.width,
+                                      static_cast<double>(sz_out.height) / sz_in.height);
+        const cv::Size sz_inner(std::max(1, std::min(sz_out.width,  static_cast<int>(std::lround(sz_in.width * scale)))),
+                                std::max(1, std::min(sz_out.height, static_cast<int>(std::lround(sz_in.height * scale)))));
+        const cv::Rect inner((sz_out.width - sz_inner.width) / 2, (sz_out.height - sz_inner.height) / 2,
+                             sz_inner.width, sz_inner.height);
+
+        cv::Mat resized;
+        resizeRef(in_mat1, resized, sz_inner, interp);
+        resized.copyTo(out_mat_ocv(inner));
+    }
+    // Comparison //////////////////////////////////////////////////////////////
+    {
+        EXPECT_LE(cv::norm(out_mat_ocv, out_mat, cv::NORM_INF), tolerance);
+    }
+}
+
+TEST_P(BatchedROITestIE, AccuracyTest)
+{
+    using namespace InferenceEngine;
+    int type = 0, interp = 0;
+    Layout out_layout = Layout::ANY;
+    cv::Size sz_out;
+    double tolerance = 0.0;
+    std::tie(type, interp, out_layout, sz_out, tolerance) = GetParam();
+
+    // detections of different sizes and aspect ratios in the same frame
+    const cv::Size sz_frame(640, 480);
+    const std::vector<cv::Rect> rects = { {0, 0, 64, 128}, {100, 50, 320, 240}, {600, 400, 40, 80},
+                                          {311, 17, 113, 71}, {0, 0, 640, 480} };
+
+    cv::Mat frame(sz_frame, type);
+    cv::randn(frame, cv::Scalar::all(127), cv::Scalar::all(40.f));
+
+    const int depth = CV_MAT_DEPTH(type);
+    const size_t channels = frame.channels();
+    const size_t batch = rects.size();
+    Precision precision = CV_8U == depth ? Precision::U8 : Precision::FP32;
+
+    // Inference Engine code ///////////////////////////////////////////////////
+
+    TensorDesc frame_desc(precision, { 1, channels, static_cast<size_t>(sz_frame.height),
+                                       static_cast<size_t>(sz_frame.width) }, Layout::NHWC);
+    Blob::Ptr frame_blob = make_blob_with_precision(frame_desc, frame.data);
+
+    std::vector<ROI> rois;
+    for (const auto& r : rects) {
+        rois.emplace_back(0, r.x, r.y, r.width, r.height);
+    }
+    Blob::Ptr batched_blob = make_shared_blob(frame_blob, rois);
+
+    TensorDesc out_desc(precision, { batch, channels, static_cast<size_t>(sz_out.height),
+                                     static_cast<size_t>(sz_out.width) }, out_layout);
+    Blob::Ptr out_blob = make_blob_with_precision(out_desc);
+    out_blob->allocate();
+
+    PreProcessDataPtr preprocess = CreatePreprocDataHelper();
+    preprocess->isApplicable(batched_blob, out_blob);
+    preprocess->setRoiBlob(batched_blob);
+
+    PreProcessInfo info;
+    info.setResizeAlgorithm(toResizeAlgorithm(interp));
+
+    // test once to warm-up cache
+    preprocess->execute(out_blob, info, false);
+
+#if PERF_TEST
+    // iterate testing, and print performance
+    test_ms([&](){ preprocess->execute(out_blob, info, false); },
+            100, "Batched ROI IE %s %s %d ROIs -> %s %dx%d",
+            interpToString(interp).c_str(), typeToString(type).c_str(), static_cast<int>(batch),
+            layoutToString(out_layout).c_str(), sz_out.width, sz_out.height);
+#endif
+
+    // Comparison with OpenCV resize of every crop /////////////////////////////
+    auto out_nhwc = make_blob_with_precision(TensorDesc(precision, out_desc.getDims(), Layout::NHWC));
+    out_nhwc->allocate();
+    blob_copy(out_blob, out_nhwc);
+
+    const size_t item_size = sz_out.area() * channels * CV_ELEM_SIZE1(type);
+    for (size_t i = 0; i < batch; i++) {
+        cv::Mat out_mat(sz_out, type, out_nhwc->buffer().as<uint8_t*>() + i * item_size);
+        cv::Mat out_mat_ocv;
+        resizeRef(frame(rects[i]), out_mat_ocv, sz_out, interp);
+        EXPECT_LE(cv::norm(out_mat_ocv, out_mat, cv::NORM_INF), tolerance) << "ROI #" << i;
+    }
+}
+
+TEST_P(MultiShapeBatchTestIE, AccuracyTest)
+{
+    using namespace InferenceEngine;
+    int type = 0, interp = 0;
+    bool batch_exceeds_threads = false;
+    double tolerance = 0.0;
+    std::tie(type, interp, batch_exceeds_threads, tolerance) = GetParam();
+
+    // batch is split over threads by whole images if it can occupy all of them, and by row tiles otherwise
+    const size_t threads = std::max(1u, std::thread::hardware_concurrency());
+    const size_t batch = batch_exceeds_threads ? threads + 1 : std::max<size_t>(1, threads / 2);
+
+    // more input shapes than compiled graphs kept by the pre-processing
+    const std::vector<cv::Size> in_sizes = { {640, 480}, {320, 240}, {300, 300}, {113, 71}, {1280, 720},
+                                             {224, 224}, {500, 300}, {64, 128}, {800, 600}, {97, 193} };
+    const cv::Size sz_out(224, 224);
+
+    const int depth = CV_MAT_DEPTH(type);
+    const size_t channels = CV_MAT_CN(type);
+    Precision precision = CV_8U == depth ? Precision::U8 : Precision::FP32;
+
+    // images of the batch are stacked vertically, which is a NHWC batch
+    cv::Mat out_mat(sz_out.height * static_cast<int>(batch), sz_out.width, type);
+    TensorDesc out_desc(precision, { batch, channels, static_cast<size_t>(sz_out.height),
+                                     static_cast<size_t>(sz_out.width) }, Layout::NHWC);
+    Blob::Ptr out_blob = make_blob_with_precision(out_desc, out_mat.data);
+
+    PreProcessDataPtr preprocess = CreatePreprocDataHelper();
+    PreProcessInfo info;
+    info.setResizeAlgorithm(toResizeAlgorithm(interp));
+
+    // alternate over the shapes twice, so compiled graphs are evicted and built again
+    for (int round = 0; round < 2; round++) {
+        for (const auto& sz_in : in_sizes) {
+            cv::Mat in_mat(sz_in.height * static_cast<int>(batch), sz_in.width, type);
+            cv::randn(in_mat, cv::Scalar::all(127), cv::Scalar::all(40.f));
+
+            TensorDesc in_desc(precision, { batch, channels, static_cast<size_t>(sz_in.height),
+                                            static_cast<size_t>(sz_in.width) }, Layout::NHWC);
+            preprocess->setRoiBlob(make_blob_with_precision(in_desc, in_mat.data));
+            preprocess->execute(out_blob, info, false);
+
+            // Comparison with OpenCV resize of every image /////////////////////////
+            for (int i = 0; i < static_cast<int>(batch); i++) {
+                cv::Mat out_mat_ocv;
+                resizeRef(in_mat.rowRange(i * sz_in.height, (i + 1) * sz_in.height), out_mat_ocv, sz_out, interp);
+                EXPECT_LE(cv::norm(out_mat_ocv, out_mat.rowRange(i * sz_out.height, (i + 1) * sz_out.height),
+                                   cv::NORM_INF), tolerance)
+                    << "round " << round << ", " << sz_in.width << "x" << sz_in.height << ", image #" << i;
+            }
+        }
+    }
+}
+
 TEST_P(ColorConvertTestIE, AccuracyTest)
 {
     using namespace InferenceEngine;
@@ -930,6 +1197,94 @@ TEST_P(ColorConvertYUV420TestIE, AccuracyTest)
     }
 }
 
+TEST_P(BatchedYUV420TestIE, AccuracyTest)
+{
+    using namespace InferenceEngine;
+    auto in_fmt = ColorFormat::NV12;
+    auto out_layout = Layout::ANY;
+    std::pair<cv::Size, cv::Size> sizes;
+    int batch = 0;
+    double tolerance = 0.0;
+    std::tie(in_fmt, out_layout, sizes, batch, tolerance) = GetParam();
+    cv::Size sz_in, sz_out;
+    std::tie(sz_in, sz_out) = sizes;
+
+    const float means[] = { 104.f, 117.f, 123.f };
+    const float scale = 1.f / 58.f;
+
+    // every frame of the batch is a separate decoded surface
+    std::vector<cv::Mat> in_mats_y(batch), in_mats_uv(batch);
+    std::vector<Blob::Ptr> frames;
+    for (int i = 0; i < batch; i++) {
+        in_mats_y[i].create(sz_in, CV_8UC1);
+        in_mats_uv[i].create(cv::Size(sz_in.width / 2, sz_in.height / 2), CV_8UC2);
+        cv::randn(in_mats_y[i], cv::Scalar::all(127), cv::Scalar::all(40.f));
+        cv::randn(in_mats_uv[i], cv::Scalar::all(127) / 2, cv::Scalar::all(40.f) / 2);
+
+        auto y_blob = img2Blob<Precision::U8>(in_mats_y[i], Layout::NHWC);
+        if (in_fmt == ColorFormat::NV12) {
+            auto uv_blob = img2Blob<Precision::U8>(in_mats_uv[i], Layout::NHWC);
+            frames.push_back(make_shared_blob<NV12Blob>(y_blob, uv_blob));
+        } else {
+            std::array<cv::Mat, 2> in_uv;
+            cv::split(in_mats_uv[i], in_uv);
+            auto u_blob = img2Blob<Precision::U8>(in_uv[0], Layout::NHWC);
+            auto v_blob = img2Blob<Precision::U8>(in_uv[1], Layout::NHWC);
+            frames.push_back(make_shared_blob<I420Blob>(y_blob, u_blob, v_blob));
+        }
+    }
+
+    // Inference Engine code ///////////////////////////////////////////////////
+
+    Blob::Ptr in_blob = make_shared_blob<BatchedBlob>(frames);
+
+    TensorDesc out_desc(Precision::FP32, { static_cast<size_t>(batch), 3, static_cast<size_t>(sz_out.height),
+                                           static_cast<size_t>(sz_out.width) }, out_layout);
+    Blob::Ptr out_blob = make_shared_blob<float>(out_desc);
+    out_blob->allocate();
+
+    PreProcessDataPtr preprocess = CreatePreprocDataHelper();
+    preprocess->setRoiBlob(in_blob);
+
+    PreProcessInfo info;
+    info.setColorFormat(in_fmt);
+    info.setResizeAlgorithm(RESIZE_BILINEAR);
+    info.init(3);
+    for (size_t c = 0; c < 3; c++) {
+        info[c]->meanValue = means[c];
+        info[c]->stdScale = scale;
+    }
+    info.setVariant(MEAN_VALUE);
+
+    // test once to warm-up cache
+    preprocess->execute(out_blob, info, false, -1, true);
+
+#if PERF_TEST
+    // iterate testing, and print performance
+    test_ms([&](){ preprocess->execute(out_blob, info, false, -1, true); },
+            100, "Batched YUV420 IE %s x%d %dx%d -> %s %dx%d",
+            colorFormatToString(in_fmt).c_str(), batch, sz_in.width, sz_in.height,
+            layoutToString(out_layout).c_str(), sz_out.width, sz_out.height);
+#endif
+
+    // Comparison with OpenCV for every frame //////////////////////////////////
+    auto out_nhwc = make_shared_blob<float>(TensorDesc(Precision::FP32, out_desc.getDims(), Layout::NHWC));
+    out_nhwc->allocate();
+    blob_copy(out_blob, out_nhwc);
+
+    for (int i = 0; i < batch; i++) {
+        cv::Mat bgr, resized, out_mat_ocv;
+        // for both I420 and NV12 use NV12 as I420 is not supported by OCV
+        cv::cvtColorTwoPlane(in_mats_y[i], in_mats_uv[i], bgr, cv::COLOR_YUV2BGR_NV12);
+        cv::resize(bgr, resized, sz_out, 0, 0, cv::INTER_LINEAR);
+        resized.convertTo(out_mat_ocv, CV_32FC3);
+        out_mat_ocv = (out_mat_ocv - cv::Scalar(means[0], means[1], means[2])) * scale;
+
+        cv::Mat out_mat(sz_out, CV_32FC3, out_nhwc->buffer().as<float*>() + i * sz_out.area() * 3);
+        EXPECT_LE(cv::norm(out_mat_ocv, out_mat, cv::NORM_INF), tolerance) << "frame #" << i;
+    }
+}
+
 TEST_P(SplitTestIE, AccuracyTest)
 {
     const auto params = GetParam();
@@ -25,9 +25,26 @@ struct ConvertDepthTestGAPI: public TestParams<std::tuple<
                             cv::Size,
                             double>>   // tolerance
 {};
+struct NormalizePlaneTestGAPI: public TestParams<std::tuple<
+                            int,  // input matrix depth
+                            cv::Size,
+                            double>>   // tolerance
+{};
 //------------------------------------------------------------------------------
 
 struct ResizeTestIE: public testing::TestWithParam<std::tuple<int, int, std::pair<cv::Size, cv::Size>, double>> {};
+struct LetterboxTestIE: public testing::TestWithParam<std::tuple<int, int, std::pair<cv::Size, cv::Size>, double>> {};
+struct BatchedROITestIE: public testing::TestWithParam<std::tuple<int,  // matrix type
+                                                                 int,  // interpolation
+                                                                 InferenceEngine::Layout,  // output layout
+                                                                 cv::Size,  // output size
+                                                                 double>>  // tolerance
+{};
+struct MultiShapeBatchTestIE: public testing::TestWithParam<std::tuple<int,  // matrix type
+                                                                      int,  // interpolation
+                                                                      bool,  // batch is larger than number of threads
+                                                                      double>>  // tolerance
+{};
 
 struct SplitTestIE: public TestParams<std::tuple<int, cv::Size, double>> {};
 struct MergeTestIE: public TestParams<std::tuple<int, cv::Size, double>> {};
@@ -48,6 +65,14 @@ struct ColorConvertYUV420TestIE:
                                              double>>                       // tolerance
 {};
 
+struct BatchedYUV420TestIE:
+    public testing::TestWithParam<std::tuple<InferenceEngine::ColorFormat,  // input color format NV12 or I420
+                                             InferenceEngine::Layout,       // output layout
+                                             std::pair<cv::Size, cv::Size>, // frame size and network's size
+                                             int,                           // number of frames in batch
+                                             double>>                       // tolerance
+{};
+
 struct PrecisionConvertTestIE: public TestParams<std::tuple<cv::Size,
                                                             int,     // input  matrix depth
                                                             int,     // output matrix depth
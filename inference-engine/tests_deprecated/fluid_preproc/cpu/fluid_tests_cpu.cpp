@@ -170,6 +170,15 @@ INSTANTIATE_TEST_CASE_P(I420toRGBTestFluid, I420toRGBTestGAPI,
                                        cv::Size( 320,  200)),
                                 Values(0)));
 
+INSTANTIATE_TEST_CASE_P(NormalizePlaneFluid, NormalizePlaneTestGAPI,
+                        Combine(Values(CV_8U, CV_32F),
+                                Values(cv::Size(1920, 1080),
+                                       cv::Size( 640,  480),
+                                       cv::Size( 300,  300),
+                                       cv::Size( 227,  227),
+                                       cv::Size(  17,   15)),
+                                Values(1e-4)));
+
 INSTANTIATE_TEST_CASE_P(ConvertDepthFluid, ConvertDepthTestGAPI,
                         Combine(Values(CV_16U, CV_32F, CV_8U),
                                 Values(CV_32F, CV_16U, CV_8U),
@@ -208,23 +217,61 @@ INSTANTIATE_TEST_CASE_P(ResizeRGB8URoiTestFluid, ResizeRGB8URoiTestGAPI,
 #if defined(__arm__) || defined(__aarch64__)
 INSTANTIATE_TEST_CASE_P(ResizeTestFluid_U8, ResizeTestIE,
                         Combine(Values(CV_8UC1, CV_8UC3),
-                                Values(cv::INTER_LINEAR, cv::INTER_AREA),
+                                Values(cv::INTER_LINEAR, cv::INTER_AREA, cv::INTER_NEAREST),
                                 Values(TEST_RESIZE_PAIRS),
                                 Values(4))); // error not more than 4 unit
 #else
 INSTANTIATE_TEST_CASE_P(ResizeTestFluid_U8, ResizeTestIE,
                         Combine(Values(CV_8UC1, CV_8UC3),
-                                Values(cv::INTER_LINEAR, cv::INTER_AREA),
+                                Values(cv::INTER_LINEAR, cv::INTER_AREA, cv::INTER_NEAREST),
                                 Values(TEST_RESIZE_PAIRS),
                                 Values(1))); // error not more than 1 unit
 #endif
 
 INSTANTIATE_TEST_CASE_P(ResizeTestFluid_F32, ResizeTestIE,
                         Combine(Values(CV_32FC1, CV_32FC3),
-                                Values(cv::INTER_LINEAR, cv::INTER_AREA),
+                                Values(cv::INTER_LINEAR, cv::INTER_AREA, cv::INTER_NEAREST),
                                 Values(TEST_RESIZE_PAIRS),
                                 Values(0.05))); // error within 0.05 units
 
+INSTANTIATE_TEST_CASE_P(LetterboxTestFluid_U8, LetterboxTestIE,
+                        Combine(Values(CV_8UC1, CV_8UC3),
+                                Values(cv::INTER_LINEAR, cv::INTER_NEAREST),
+                                Values(std::make_pair(cv::Size(1920, 1080), cv::Size(640, 640)),
+                                       std::make_pair(cv::Size( 640,  480), cv::Size(416, 416)),
+                                       std::make_pair(cv::Size( 300,  500), cv::Size(320, 320)),
+                                       std::make_pair(cv::Size( 113,   71), cv::Size(300, 300))),
+                                Values(1))); // error not more than 1 unit
+
+INSTANTIATE_TEST_CASE_P(LetterboxTestFluid_F32, LetterboxTestIE,
+                        Combine(Values(CV_32FC1, CV_32FC3),
+                                Values(cv::INTER_LINEAR, cv::INTER_NEAREST),
+                                Values(std::make_pair(cv::Size(1920, 1080), cv::Size(640, 640)),
+                                       std::make_pair(cv::Size( 300,  500), cv::Size(320, 320))),
+                                Values(0.05))); // error within 0.05 units
+
+INSTANTIATE_TEST_CASE_P(BatchedYUV420TestFluid, BatchedYUV420TestIE,
+                        Combine(Values(InferenceEngine::NV12, InferenceEngine::I420),
+                                Values(InferenceEngine::NHWC, InferenceEngine::NCHW),
+                                Values(std::make_pair(cv::Size(1920, 1080), cv::Size(300, 300)),
+                                       std::make_pair(cv::Size(1280,  720), cv::Size(416, 416)),
+                                       std::make_pair(cv::Size( 640,  480), cv::Size(224, 224))),
+                                Values(1, 4, 7),
+                                Values(1.f / 58.f + 1e-5))); // error not more than 1 unit before scaling
+
+INSTANTIATE_TEST_CASE_P(BatchedROITestFluid, BatchedROITestIE,
+                        Combine(Values(CV_8UC3, CV_32FC3),
+                                Values(cv::INTER_LINEAR, cv::INTER_AREA, cv::INTER_NEAREST),
+                                Values(InferenceEngine::Layout::NCHW, InferenceEngine::Layout::NHWC),
+                                Values(cv::Size(224, 224), cv::Size(64, 128)),
+                                Values(1))); // error not more than 1 unit
+
+INSTANTIATE_TEST_CASE_P(MultiShapeBatchTestFluid, MultiShapeBatchTestIE,
+                        Combine(Values(CV_8UC3, CV_32FC3),
+                                Values(cv::INTER_LINEAR, cv::INTER_AREA),
+                                Values(true, false),
+                                Values(1))); // error not more than 1 unit
+
 INSTANTIATE_TEST_CASE_P(SplitTestFluid, SplitTestIE,
                         Combine(Values(CV_8UC2, CV_8UC3, CV_8UC4,
                                        CV_32FC2, CV_32FC3, CV_32FC4),
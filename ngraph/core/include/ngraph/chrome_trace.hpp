@@ -117,6 +117,9 @@ public:
     /// This funtion has an implicit stop() if stop() has not been previously called
     void write();
 
+    /// \brief replace the event args, e.g. with data that is only known when the event ends
+    void set_args(const std::string& args) { m_args = args; }
+
     Duration(const Duration&) = delete;
     Duration& operator=(Duration const&) = delete;
 
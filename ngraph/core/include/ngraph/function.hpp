@@ -20,6 +20,7 @@
 #include <initializer_list>
 #include <list>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <vector>
 
@@ -89,6 +90,10 @@ namespace ngraph
         const std::string& get_friendly_name() const;
 
         std::vector<std::shared_ptr<Node>> get_ops() const;
+        /// \brief Returns all nodes of the function in topological order.
+        ///
+        /// The order is cached: it is computed again only if the graph has been changed since
+        /// the last call, e.g. nodes have been replaced or inputs have been rewired.
         std::vector<std::shared_ptr<Node>> get_ordered_ops() const;
         void map_unordered_ops(std::function<void(Node*)> f) const;
 
@@ -151,6 +156,10 @@ namespace ngraph
 
         ResultVector m_results;
         ParameterVector m_parameters;
+        std::shared_ptr<SharedRTInfo> m_shared_rt_info;
+        mutable std::mutex m_topological_sort_mutex;
+        // weak pointers don't keep nodes removed from the graph alive
+        mutable std::vector<std::weak_ptr<Node>> m_cached_ordered_ops;
     };
 
     template <>
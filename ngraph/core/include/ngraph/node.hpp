@@ -59,6 +59,8 @@ namespace ngraph
 
     class Function;
 
+    class SharedRTInfo;
+
     namespace runtime
     {
         class HostTensor;
@@ -140,6 +142,9 @@ namespace ngraph
         template <typename NodeType>
         friend class Output;
 
+        // For access to m_shared_rt_info.
+        friend class Function;
+
     public:
         /// \brief Verifies that attributes and inputs are consistent and computes output shapes
         /// and element types. Must be implemented by concrete child classes so that it
@@ -470,6 +475,11 @@ namespace ngraph
         descriptor::Input& get_input_descriptor(size_t position);
         descriptor::Output& get_output_descriptor(size_t position);
 
+        /// Registers the state shared by a function the node belongs to
+        void insert_shared_rt_info(const std::shared_ptr<SharedRTInfo>& info);
+        /// Invalidates cached topological orders of the functions this node belongs to
+        void invalidate_topological_cache();
+
         std::vector<Node*> m_control_dependents;
         std::vector<std::shared_ptr<Node>> m_control_dependencies;
         std::string m_node_type;
@@ -483,6 +493,8 @@ namespace ngraph
         std::deque<descriptor::Output> m_outputs;
         std::shared_ptr<ngraph::op::util::OpAnnotations> m_op_annotations;
         std::map<std::string, std::shared_ptr<Variant>> m_rt_info;
+        // weak pointers: a node doesn't keep alive the state of a destroyed function
+        std::vector<std::weak_ptr<SharedRTInfo>> m_shared_rt_info;
     };
 
     using NodeTypeInfo = Node::type_info_t;
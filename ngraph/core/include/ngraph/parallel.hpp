@@ -0,0 +1,89 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+
+#include "ngraph/ngraph_visibility.hpp"
+
+namespace ngraph
+{
+    /// \brief Default number of work items, e.g. tensor elements, below which splitting the
+    ///        work between threads does not pay off.
+    constexpr size_t parallel_grain_size = 64 * 1024;
+
+    /// \brief Returns the number of threads used by parallel_for and parallel_for_each.
+    ///        Defaults to NGRAPH_PARALLEL_THREADS environment variable if set, otherwise to
+    ///        the number of hardware threads.
+    NGRAPH_API
+    size_t get_parallel_threads();
+
+    /// \brief Sets the number of threads used by parallel_for and parallel_for_each.
+    /// \param threads Number of threads; 1 disables parallelism, 0 restores the default.
+    NGRAPH_API
+    void set_parallel_threads(size_t threads);
+
+    /// \brief Enables parallel_for and parallel_for_each on the current thread while the object
+    ///        is alive. Outside of such a scope they run serially on the calling thread, so only
+    ///        the code that opts in, e.g. pass::ConstantFolding, runs in parallel. Unless a
+    ///        parallel executor is set, the outermost scope of a thread starts worker threads on
+    ///        the first parallel call and joins them when it is destroyed.
+    class NGRAPH_API ParallelScope
+    {
+    public:
+        ParallelScope();
+        ~ParallelScope();
+
+        ParallelScope(const ParallelScope&) = delete;
+        ParallelScope& operator=(const ParallelScope&) = delete;
+
+        class WorkerPool;
+
+    private:
+        bool m_was_enabled;
+        std::unique_ptr<WorkerPool> m_worker_pool;
+    };
+
+    /// \brief Runs body(worker) for every worker in [0, workers), possibly concurrently, and
+    ///        returns when all of them are done. body does not throw.
+    using parallel_executor = void (*)(size_t workers,
+                                       const std::function<void(size_t worker)>& body);
+
+    /// \brief Makes parallel_for and parallel_for_each run their work through executor instead of
+    ///        the worker threads of ParallelScope, so that an application shares its own threads
+    ///        with ngraph rather than oversubscribing the machine. nullptr restores the default.
+    NGRAPH_API
+    void set_parallel_executor(parallel_executor executor);
+
+    /// \brief Splits [0, count) into contiguous ranges of at least grain items and calls
+    ///        body(begin, end) for every range, concurrently if a ParallelScope is open on the
+    ///        calling thread. Calls nested into a running parallel_for or parallel_for_each are
+    ///        executed serially on the calling thread. An exception thrown by body is rethrown
+    ///        after all ranges are done.
+    NGRAPH_API
+    void parallel_for(size_t count,
+                      const std::function<void(size_t begin, size_t end)>& body,
+                      size_t grain = parallel_grain_size);
+
+    /// \brief Calls body(index) for every index in [0, count), concurrently if a ParallelScope is
+    ///        open on the calling thread. Indices are handed out to threads one by one, which
+    ///        suits items of uneven cost.
+    NGRAPH_API
+    void parallel_for_each(size_t count, const std::function<void(size_t index)>& body);
+}
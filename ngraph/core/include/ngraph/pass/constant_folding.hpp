@@ -49,6 +49,14 @@ public:
         construct_constant_default();
     }
 
+    /// \brief Folds nodes with constant inputs, first concurrently, wave by wave, then runs
+    /// matchers of the graph rewrite on the remaining nodes.
+    bool run_on_function(std::shared_ptr<ngraph::Function> f) override;
+
+    /// \brief Limits the memory taken by input copies and results of the nodes that are
+    /// folded concurrently. A node exceeding the budget is folded alone.
+    void set_memory_budget(size_t bytes) { m_memory_budget = bytes; }
+
 private:
     void construct_constant_quantize();
     void construct_constant_dequantize();
@@ -63,5 +71,9 @@ private:
 
     bool cf_is_disabled(const std::shared_ptr<Node>&);
 
+    bool is_foldable(const std::shared_ptr<Node>& node);
+    bool fold_independent_nodes(const std::shared_ptr<Function>& f);
+
     ngraph::BuildNodeExecutorMap m_cfmap;
+    size_t m_memory_budget = 256 * 1024 * 1024;
 };
@@ -23,6 +23,7 @@
 
 #include "ngraph/pass/pass.hpp"
 #include "ngraph/pass/pass_config.hpp"
+#include "ngraph/pass/profiler.hpp"
 #include "ngraph/pass/validate.hpp"
 
 namespace ngraph
@@ -57,6 +58,12 @@ public:
     /// each registered pass
     /// \param new_state Value "true" enables Validate pass run; "false", otherwise
     void set_per_pass_validation(bool new_state) { m_per_pass_validation = new_state; }
+    /// \brief Set profiler to collect per-pass statistics of run_passes.
+    /// Passes that run their own pass::Manager without a profiler report into this one too.
+    /// \param profiler Profiler to use; nullptr disables profiling unless an enclosing
+    /// pass::Manager is profiled
+    void set_profiler(const std::shared_ptr<Profiler>& profiler) { m_profiler = profiler; }
+    std::shared_ptr<Profiler> get_profiler() const { return m_profiler; }
     /// \brief Callback is a lambda function that can be used by registered transformations.
     /// The main purpose of this callback is to provide a way for plugins to disable/enable
     /// transformations. In some cases plugins may want not to execute some transformations.
@@ -99,4 +106,5 @@ protected:
     std::vector<std::shared_ptr<PassBase>> m_pass_list;
     bool m_visualize = false;
     bool m_per_pass_validation = true;
+    std::shared_ptr<Profiler> m_profiler;
 };
@@ -0,0 +1,141 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "ngraph/ngraph_visibility.hpp"
+
+namespace ngraph
+{
+    class Function;
+
+    namespace event
+    {
+        class Duration;
+    }
+
+    namespace pass
+    {
+        class Profiler;
+    }
+}
+
+/// \brief Profiler collects load-time statistics of the passes run by pass::Manager.
+///
+/// For every executed pass the profiler records its wall time and the number of nodes in the
+/// function before and after the pass. For passes that run MatcherPasses through GraphRewrite it
+/// additionally records, per matcher, the number of nodes the matcher was applied to, the number
+/// of successful applications and the time spent in the matcher including its callback.
+///
+/// The profiler attached to a pass::Manager becomes current for the thread while the passes run,
+/// so passes that run nested pass::Managers (e.g. common optimizations) report into the same
+/// profiler. Records of nested passes follow their parent and have a greater depth.
+///
+/// Collected records can be written as a JSON report with \sa write_json. When event tracing is
+/// enabled (NGRAPH_ENABLE_TRACING) every profiled pass is also written to the Chrome trace
+/// produced by ngraph::event::Manager, with node counts and matcher statistics as event args.
+class NGRAPH_API ngraph::pass::Profiler
+{
+public:
+    struct MatcherRecord
+    {
+        std::string name;
+        /// \brief Number of nodes the matcher pass was applied to
+        size_t attempts = 0;
+        /// \brief Number of applications that transformed the graph
+        size_t matches = 0;
+        /// \brief Time spent in matching and in the callback
+        int64_t time_us = 0;
+    };
+
+    struct PassRecord
+    {
+        std::string name;
+        /// \brief Nesting level, 0 for passes registered in the outermost pass::Manager
+        size_t depth = 0;
+        /// \brief Start time relative to the first recorded pass
+        int64_t start_us = 0;
+        int64_t time_us = 0;
+        size_t nodes_before = 0;
+        size_t nodes_after = 0;
+        std::vector<MatcherRecord> matchers;
+    };
+
+    Profiler();
+    ~Profiler();
+
+    Profiler(const Profiler&) = delete;
+    Profiler& operator=(const Profiler&) = delete;
+
+    const std::vector<PassRecord>& get_records() const { return m_records; }
+    void clear();
+
+    /// \brief Writes collected records as a JSON object with a "passes" array
+    void write_json(std::ostream& out) const;
+
+    /// \brief Returns the profiler of the passes running on the current thread or nullptr
+    static Profiler* get_current();
+    /// \brief Makes profiler current for the thread and returns the previous one
+    static Profiler* set_current(Profiler* profiler);
+
+    /// \brief Opens a record for the pass started on function f
+    void begin_pass(const std::string& name, const std::shared_ptr<Function>& f);
+    /// \brief Closes the innermost open record
+    /// \param count_nodes If false, nodes of f are not counted, e.g. when the pass has thrown
+    void end_pass(const std::shared_ptr<Function>& f, bool count_nodes = true);
+
+    /// \brief Returns index of the matcher in the innermost open record, adding it if needed
+    size_t register_matcher(const std::string& name);
+    /// \brief Accounts one application of the matcher returned by \sa register_matcher
+    void add_matcher_run(size_t matcher, int64_t time_us, bool matched);
+
+    /// \brief RAII helper that profiles a single pass if profiler is not nullptr
+    class NGRAPH_API ScopedPass
+    {
+    public:
+        ScopedPass(Profiler* profiler,
+                   const std::string& name,
+                   const std::shared_ptr<Function>& f);
+        ~ScopedPass();
+
+        ScopedPass(const ScopedPass&) = delete;
+        ScopedPass& operator=(const ScopedPass&) = delete;
+
+    private:
+        Profiler* m_profiler;
+        const std::shared_ptr<Function>& m_function;
+    };
+
+private:
+    struct OpenPass
+    {
+        size_t record;
+        int64_t start_us;
+        std::unique_ptr<event::Duration> trace_event;
+    };
+
+    int64_t now_us() const;
+
+    std::vector<PassRecord> m_records;
+    std::vector<OpenPass> m_open_passes;
+    int64_t m_origin_us = -1;
+};
@@ -0,0 +1,37 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include "ngraph/ngraph_visibility.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        /// \brief Returns true if reference kernels may take their fast paths, e.g. strided
+        ///        loops instead of CoordinateTransform iteration. Defaults to the value of
+        ///        NGRAPH_REFERENCE_FAST_PATHS environment variable, true if not set.
+        NGRAPH_API
+        bool reference_fast_paths_enabled();
+
+        /// \brief Enables or disables fast paths of the reference kernels. Kernels compute the
+        ///        same results either way, disabling them allows to verify the fast paths
+        ///        against the generic implementations.
+        NGRAPH_API
+        void set_reference_fast_paths(bool enabled);
+    }
+}
@@ -19,8 +19,11 @@
 #include <cstddef>
 
 #include <utility>
+#include "ngraph/check.hpp"
 #include "ngraph/coordinate_transform.hpp"
 #include "ngraph/op/util/attr_types.hpp"
+#include "ngraph/parallel.hpp"
+#include "ngraph/runtime/reference_fast_paths.hpp"
 #include "ngraph/shape_util.hpp"
 
 namespace ngraph
@@ -95,6 +98,209 @@ namespace ngraph
                         --axis;
                     return axis;
                 }
+
+                /// \brief Output shape of numpy broadcasting of the argument shapes
+                inline Shape numpy_broadcast_shape(const std::vector<Shape>& arg_shapes)
+                {
+                    size_t rank = 0;
+                    for (const auto& shape : arg_shapes)
+                    {
+                        rank = std::max(rank, shape.size());
+                    }
+                    Shape out_shape(rank, 1);
+                    for (const auto& shape : arg_shapes)
+                    {
+                        const size_t padding = rank - shape.size();
+                        for (size_t i = 0; i < shape.size(); ++i)
+                        {
+                            if (shape[i] != 1)
+                            {
+                                out_shape[padding + i] = shape[i];
+                            }
+                        }
+                    }
+                    return out_shape;
+                }
+
+                /// \brief Checks that numpy broadcasting of arg_shape to out_shape is valid
+                inline bool broadcasts_to(const Shape& arg_shape, const Shape& out_shape)
+                {
+                    if (arg_shape.size() > out_shape.size())
+                    {
+                        return false;
+                    }
+                    const size_t padding = out_shape.size() - arg_shape.size();
+                    for (size_t i = 0; i < arg_shape.size(); ++i)
+                    {
+                        if (arg_shape[i] != 1 && arg_shape[i] != out_shape[padding + i])
+                        {
+                            return false;
+                        }
+                    }
+                    return true;
+                }
+
+                /// \brief Output shape and element strides of arguments broadcast to it, with
+                ///        adjacent axes merged where possible. Strides are 0 along broadcast
+                ///        axes, so the innermost stride of every argument is either 0 or 1.
+                struct BroadcastStrides
+                {
+                    BroadcastStrides(const Shape& out_shape, const std::vector<Shape>& arg_shapes)
+                        : strides(arg_shapes.size())
+                    {
+                        const size_t rank = out_shape.size();
+                        std::vector<std::vector<size_t>> arg_strides(arg_shapes.size());
+                        for (size_t arg = 0; arg < arg_shapes.size(); ++arg)
+                        {
+                            const Shape& arg_shape = arg_shapes[arg];
+                            NGRAPH_CHECK(arg_shape.size() <= rank, "Incompatible broadcast");
+                            const size_t padding = rank - arg_shape.size();
+                            arg_strides[arg].resize(rank);
+                            for (size_t i = rank, stride = 1; i-- > 0;)
+                            {
+                                size_t dim = i < padding ? 1 : arg_shape[i - padding];
+                                NGRAPH_CHECK(dim == 1 || dim == out_shape[i],
+                                             "Incompatible broadcast");
+                                arg_strides[arg][i] = dim == 1 ? 0 : stride;
+                                stride *= dim;
+                            }
+                        }
+                        for (size_t i = 0; i < rank; ++i)
+                        {
+                            if (out_shape[i] == 1)
+                            {
+                                continue;
+                            }
+                            bool merge = !shape.empty();
+                            for (size_t arg = 0; merge && arg < strides.size(); ++arg)
+                            {
+                                size_t outer = strides[arg].back();
+                                size_t inner = arg_strides[arg][i];
+                                merge = outer == inner * out_shape[i] &&
+                                        (outer == 0) == (inner == 0);
+                            }
+                            if (merge)
+                            {
+                                shape.back() *= out_shape[i];
+                            }
+                            else
+                            {
+                                shape.push_back(out_shape[i]);
+                            }
+                            for (size_t arg = 0; arg < strides.size(); ++arg)
+                            {
+                                if (merge)
+                                {
+                                    strides[arg].back() = arg_strides[arg][i];
+                                }
+                                else
+                                {
+                                    strides[arg].push_back(arg_strides[arg][i]);
+                                }
+                            }
+                        }
+                        if (shape.empty())
+                        {
+                            shape.push_back(1);
+                            for (auto& arg_strides : strides)
+                            {
+                                arg_strides.push_back(0);
+                            }
+                        }
+                    }
+
+                    size_t inner_size() const { return shape.back(); }
+                    size_t rows() const { return shape_size(shape) / shape.back(); }
+                    /// \brief Element offset of the argument at the start of the row
+                    size_t row_offset(size_t arg, size_t row) const
+                    {
+                        size_t offset = 0;
+                        for (size_t i = shape.size() - 1; i-- > 0;)
+                        {
+                            offset += row % shape[i] * strides[arg][i];
+                            row /= shape[i];
+                        }
+                        return offset;
+                    }
+
+                    Shape shape;
+                    std::vector<std::vector<size_t>> strides;
+                };
+
+                /// \brief Applies elementwise_functor row by row of the output, concurrently
+                template <typename T, typename U, typename Functor>
+                void strided_binop(const T* arg0,
+                                   const T* arg1,
+                                   U* out,
+                                   const Shape& arg0_shape,
+                                   const Shape& arg1_shape,
+                                   const Shape& out_shape,
+                                   Functor elementwise_functor)
+                {
+                    if (shape_size(out_shape) == 0)
+                    {
+                        return;
+                    }
+                    const BroadcastStrides plan(out_shape, {arg0_shape, arg1_shape});
+                    const size_t inner = plan.inner_size();
+                    const size_t step0 = plan.strides[0].back();
+                    const size_t step1 = plan.strides[1].back();
+                    auto run_rows = [&](size_t begin, size_t end) {
+                        for (size_t row = begin; row < end; ++row)
+                        {
+                            const T* in0 = arg0 + plan.row_offset(0, row);
+                            const T* in1 = arg1 + plan.row_offset(1, row);
+                            U* dst = out + row * inner;
+                            for (size_t i = 0; i < inner; ++i)
+                            {
+                                dst[i] = elementwise_functor(in0[i * step0], in1[i * step1]);
+                            }
+                        }
+                    };
+                    parallel_for(plan.rows(),
+                                 run_rows,
+                                 std::max<size_t>(parallel_grain_size / inner, 1));
+                }
+
+                /// \brief Applies elementwise_functor row by row of the output, concurrently
+                template <typename T, typename U, typename Functor>
+                void strided_select(const U* arg0,
+                                    const T* arg1,
+                                    const T* arg2,
+                                    T* out,
+                                    const Shape& arg0_shape,
+                                    const Shape& arg1_shape,
+                                    const Shape& arg2_shape,
+                                    const Shape& out_shape,
+                                    Functor elementwise_functor)
+                {
+                    if (shape_size(out_shape) == 0)
+                    {
+                        return;
+                    }
+                    const BroadcastStrides plan(out_shape, {arg0_shape, arg1_shape, arg2_shape});
+                    const size_t inner = plan.inner_size();
+                    const size_t step0 = plan.strides[0].back();
+                    const size_t step1 = plan.strides[1].back();
+                    const size_t step2 = plan.strides[2].back();
+                    auto run_rows = [&](size_t begin, size_t end) {
+                        for (size_t row = begin; row < end; ++row)
+                        {
+                            const U* in0 = arg0 + plan.row_offset(0, row);
+                            const T* in1 = arg1 + plan.row_offset(1, row);
+                            const T* in2 = arg2 + plan.row_offset(2, row);
+                            T* dst = out + row * inner;
+                            for (size_t i = 0; i < inner; ++i)
+                            {
+                                dst[i] = elementwise_functor(
+                                    in0[i * step0], in1[i * step1], in2[i * step2]);
+                            }
+                        }
+                    };
+                    parallel_for(plan.rows(),
+                                 run_rows,
+                                 std::max<size_t>(parallel_grain_size / inner, 1));
+                }
             }
 
             /// \brief Helper function to implement autobroadcasting elementwise binop references.
@@ -126,12 +332,26 @@ namespace ngraph
                 switch (broadcast_spec.m_type)
                 {
                 case op::AutoBroadcastType::NONE:
-                    for (size_t i = 0; i < shape_size(arg0_shape); i++)
-                    {
-                        out[i] = elementwise_functor(arg0[i], arg1[i]);
-                    }
+                    parallel_for(shape_size(arg0_shape), [&](size_t begin, size_t end) {
+                        for (size_t i = begin; i < end; i++)
+                        {
+                            out[i] = elementwise_functor(arg0[i], arg1[i]);
+                        }
+                    });
                     break;
                 case op::AutoBroadcastType::NUMPY:
+                    if (reference_fast_paths_enabled())
+                    {
+                        internal::strided_binop(
+                            arg0,
+                            arg1,
+                            out,
+                            arg0_shape,
+                            arg1_shape,
+                            internal::numpy_broadcast_shape({arg0_shape, arg1_shape}),
+                            elementwise_functor);
+                        break;
+                    }
                     // We'll be using CoordinateTransform to handle the broadcasting. The general
                     // procedure is as follows:
                     //
@@ -205,8 +425,10 @@ namespace ngraph
 
                         if (axis == 0)
                         {
-                            for (size_t i = 0, end = strides0[0]; i < end; ++i)
-                                out[i] = elementwise_functor(arg0[i], arg1[i]);
+                            parallel_for(strides0[0], [&](size_t begin, size_t end) {
+                                for (size_t i = begin; i < end; ++i)
+                                    out[i] = elementwise_functor(arg0[i], arg1[i]);
+                            });
                         }
                         else if (strides0[axis] == 1 &&
                                  value_with_padding_or(arg0_shape, padding0, axis, 1) == 1)
@@ -312,6 +534,18 @@ namespace ngraph
                             arg1_padded_shape.insert(arg1_padded_shape.end(), 1);
                         }
 
+                        if (reference_fast_paths_enabled())
+                        {
+                            internal::strided_binop(arg0,
+                                                    arg1,
+                                                    out,
+                                                    arg0_shape,
+                                                    arg1_padded_shape,
+                                                    arg0_shape,
+                                                    elementwise_functor);
+                            break;
+                        }
+
                         Shape arg1_squeezed_shape;
                         AxisSet arg1_squeezed_axes;
 
@@ -383,6 +617,24 @@ namespace ngraph
                     break;
                 case op::AutoBroadcastType::NUMPY:
                     // Uses same approach as autobroadcast_binop.
+                    if (reference_fast_paths_enabled())
+                    {
+                        Shape output_shape =
+                            internal::numpy_broadcast_shape({arg1_shape, arg2_shape});
+                        if (internal::broadcasts_to(arg0_shape, output_shape))
+                        {
+                            internal::strided_select(arg0,
+                                                     arg1,
+                                                     arg2,
+                                                     out,
+                                                     arg0_shape,
+                                                     arg1_shape,
+                                                     arg2_shape,
+                                                     output_shape,
+                                                     elementwise_functor);
+                            break;
+                        }
+                    }
                     {
                         Shape arg0_padded_shape = arg0_shape;
                         Shape arg1_padded_shape = arg1_shape;
@@ -504,6 +756,20 @@ namespace ngraph
                         arg2_padded_shape.insert(arg2_padded_shape.end(), 1);
                     }
 
+                    if (reference_fast_paths_enabled())
+                    {
+                        internal::strided_select(arg0,
+                                                 arg1,
+                                                 arg2,
+                                                 out,
+                                                 arg0_padded_shape,
+                                                 arg1_shape,
+                                                 arg2_padded_shape,
+                                                 arg1_shape,
+                                                 elementwise_functor);
+                        break;
+                    }
+
                     Shape arg0_squeezed_shape;
                     AxisSet arg0_squeezed_axes;
                     Shape arg2_squeezed_shape;
@@ -16,13 +16,17 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cmath>
 #include <utility>
+#include <vector>
 
 #include <cfenv>
 #include <functional>
 #include "convolution.hpp"
 #include "ngraph/coordinate_transform.hpp"
+#include "ngraph/parallel.hpp"
+#include "ngraph/runtime/reference_fast_paths.hpp"
 #include "ngraph/shape_util.hpp"
 
 namespace ngraph
@@ -31,6 +35,52 @@ namespace ngraph
     {
         namespace reference
         {
+            namespace internal
+            {
+                /// \brief Multiplies arg0 viewed as a row-major [rows, depth] matrix by arg1
+                ///        viewed as a [depth, cols] matrix. Every output element is accumulated
+                ///        in depth order like in the coordinate based implementation, while the
+                ///        innermost loop runs over a block of contiguous columns.
+                template <typename INPUT0, typename INPUT1, typename OUTPUT, typename ACCUMULATION>
+                void dot_blocked(const INPUT0* arg0,
+                                 const INPUT1* arg1,
+                                 OUTPUT* out,
+                                 size_t rows,
+                                 size_t depth,
+                                 size_t cols)
+                {
+                    constexpr size_t col_block = 256;
+                    auto multiply_rows = [&](size_t begin, size_t end) {
+                        std::vector<ACCUMULATION> sums(std::min(cols, col_block));
+                        for (size_t row = begin; row < end; ++row)
+                        {
+                            const INPUT0* a = arg0 + row * depth;
+                            for (size_t col = 0; col < cols; col += col_block)
+                            {
+                                const size_t width = std::min(col_block, cols - col);
+                                std::fill(sums.begin(), sums.begin() + width, ACCUMULATION(0));
+                                for (size_t k = 0; k < depth; ++k)
+                                {
+                                    const ACCUMULATION a_k = static_cast<ACCUMULATION>(a[k]);
+                                    const INPUT1* b = arg1 + k * cols + col;
+                                    for (size_t j = 0; j < width; ++j)
+                                    {
+                                        sums[j] = sums[j] + a_k * static_cast<ACCUMULATION>(b[j]);
+                                    }
+                                }
+                                for (size_t j = 0; j < width; ++j)
+                                {
+                                    out[row * cols + col + j] = sums[j];
+                                }
+                            }
+                        }
+                    };
+                    const size_t row_cost = std::max<size_t>(depth * cols, 1);
+                    parallel_for(
+                        rows, multiply_rows, std::max<size_t>(parallel_grain_size / row_cost, 1));
+                }
+            }
+
             template <typename INPUT0,
                       typename INPUT1,
                       typename OUTPUT,
@@ -56,6 +106,19 @@ namespace ngraph
                     is_quantized = true;
                 }
 
+                if (!is_quantized && reference_fast_paths_enabled())
+                {
+                    const size_t rows = shape_size(
+                        Shape(arg0_shape.begin(), arg0_shape.end() - reduction_axes_count));
+                    const size_t depth = shape_size(
+                        Shape(arg1_shape.begin(), arg1_shape.begin() + reduction_axes_count));
+                    const size_t cols = shape_size(
+                        Shape(arg1_shape.begin() + reduction_axes_count, arg1_shape.end()));
+                    internal::dot_blocked<INPUT0, INPUT1, OUTPUT, ACCUMULATION>(
+                        arg0, arg1, out, rows, depth, cols);
+                    return;
+                }
+
                 auto old_mode = std::fegetround();
                 std::fesetround(FE_TONEAREST);
                 // Get the sizes of the dot axes. It's easiest to pull them from arg1 because
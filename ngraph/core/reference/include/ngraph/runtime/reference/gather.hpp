@@ -16,10 +16,13 @@
 
 #pragma once
 
+#include <algorithm>
 #include <numeric>
 
 #include "ngraph/coordinate_transform.hpp"
+#include "ngraph/parallel.hpp"
 #include "ngraph/runtime/reference/gather_nd.hpp"
+#include "ngraph/runtime/reference_fast_paths.hpp"
 
 namespace ngraph
 {
@@ -27,6 +30,60 @@ namespace ngraph
     {
         namespace reference
         {
+            namespace internal
+            {
+                /// \brief Gathers blocks of params viewed as [outer, axis, inner] into out viewed
+                ///        as [outer, indices, inner]. Returns false without touching out if an
+                ///        index is out of range.
+                template <typename T, typename U>
+                bool gather_blocks(const T* params,
+                                   const U* indices,
+                                   T* out,
+                                   const Shape& params_shape,
+                                   const Shape& indices_shape,
+                                   const Shape& out_shape,
+                                   size_t axis)
+                {
+                    const size_t outer = shape_size(Shape(params_shape.begin(),
+                                                          params_shape.begin() + axis));
+                    const size_t inner = shape_size(Shape(params_shape.begin() + axis + 1,
+                                                          params_shape.end()));
+                    const int64_t axis_dim = static_cast<int64_t>(params_shape[axis]);
+                    const size_t index_count = shape_size(indices_shape);
+                    if (outer * index_count * inner != shape_size(out_shape))
+                    {
+                        return false;
+                    }
+
+                    std::vector<size_t> positions(index_count);
+                    for (size_t p = 0; p < index_count; ++p)
+                    {
+                        int64_t index = static_cast<int64_t>(indices[p]);
+                        index = index >= 0 ? index : index + axis_dim;
+                        if (index < 0 || index >= axis_dim)
+                        {
+                            return false;
+                        }
+                        positions[p] = static_cast<size_t>(index);
+                    }
+
+                    auto copy_rows = [&](size_t begin, size_t end) {
+                        for (size_t row = begin; row < end; ++row)
+                        {
+                            const size_t o = row / std::max<size_t>(index_count, 1);
+                            const size_t p = row % std::max<size_t>(index_count, 1);
+                            const T* src = params + (o * axis_dim + positions[p]) * inner;
+                            std::copy(src, src + inner, out + row * inner);
+                        }
+                    };
+                    parallel_for(outer * index_count,
+                                 copy_rows,
+                                 std::max<size_t>(parallel_grain_size / std::max<size_t>(inner, 1),
+                                                  1));
+                    return true;
+                }
+            }
+
             // Implement gather by calling gather_nd on sub-problems
             // # prepare constant shapes for tensors used for sub problems
             // indices'.shape  = indices.shape[-1] + [1]
@@ -52,6 +109,12 @@ namespace ngraph
                         size_t axis)
             {
                 using namespace std;
+                if (reference_fast_paths_enabled() && axis < params_shape.size() &&
+                    internal::gather_blocks(
+                        params, indices, out, params_shape, indices_shape, out_shape, axis))
+                {
+                    return;
+                }
                 // prepare shape of params_prime (remove first "axis" dimensions)
                 Shape params_prime_shape(params_shape);
                 params_prime_shape.erase(params_prime_shape.begin(),
@@ -17,7 +17,9 @@
 #pragma once
 
 #include <cmath>
+#include <cstdint>
 #include <map>
+#include <type_traits>
 #include <vector>
 
 #include "ngraph/coordinate_transform.hpp"
@@ -32,61 +34,35 @@ namespace ngraph
     {
         namespace reference
         {
+            /// \brief Accumulates a sum with Kahan compensation and returns its mean
             template <typename T>
-            void mean(const T* arg,
-                      T* out,
-                      const Shape& in_shape,
-                      const AxisSet& reduction_axes,
-                      bool keep_dims)
+            struct MeanAccumulator : public SumAccumulator<T>
             {
-                auto out_shape = reduce(in_shape, reduction_axes, keep_dims);
-                CoordinateTransform output_transform(out_shape);
-                std::vector<T> cs(shape_size(out_shape));
-
-                for (const Coordinate& output_coord : output_transform)
+                void operator()(T x)
                 {
-                    out[output_transform.index(output_coord)] = 0;
-                    cs[output_transform.index(output_coord)] = 0;
+                    SumAccumulator<T>::operator()(x);
+                    count++;
                 }
+                T result() const { return divide(this->sum, count, std::is_integral<T>()); }
+                size_t count = 0;
 
-                CoordinateTransform input_transform(in_shape);
-                std::map<size_t, int> index_to_count_map;
-
-                for (const Coordinate& input_coord : input_transform)
+            private:
+                // Unsigned count would turn a negative integer sum into a huge positive one
+                static T divide(T sum, size_t count, std::true_type)
                 {
-                    Coordinate output_coord = reduce(input_coord, reduction_axes, keep_dims);
-
-                    T x = arg[input_transform.index(input_coord)];
-                    T& z = out[output_transform.index(output_coord)];
-                    auto index = output_transform.index(output_coord);
-                    if (index_to_count_map.find(index) == index_to_count_map.end())
-                    {
-                        index_to_count_map[index] = 1;
-                    }
-                    else
-                    {
-                        index_to_count_map[index]++;
-                    }
-
-                    if (is_finite(x) && is_finite(z))
-                    {
-                        T& c = cs[output_transform.index(output_coord)];
-                        T t = z + (x - c);
-                        c = (t - z) - (x - c);
-                        z = t;
-                    }
-                    else
-                    {
-                        z = z + x;
-                    }
+                    return static_cast<T>(sum / static_cast<int64_t>(count));
                 }
+                static T divide(T sum, size_t count, std::false_type) { return sum / count; }
+            };
 
-                for (const Coordinate& output_coord : output_transform)
-                {
-                    auto count = index_to_count_map[output_transform.index(output_coord)];
-                    out[output_transform.index(output_coord)] =
-                        out[output_transform.index(output_coord)] / count;
-                }
+            template <typename T>
+            void mean(const T* arg,
+                      T* out,
+                      const Shape& in_shape,
+                      const AxisSet& reduction_axes,
+                      bool /* keep_dims */)
+            {
+                reduce_by_output(arg, out, in_shape, reduction_axes, MeanAccumulator<T>());
             }
         }
     }
@@ -20,6 +20,7 @@
 #include <limits>
 
 #include "ngraph/coordinate_transform.hpp"
+#include "ngraph/runtime/reference/reduction.hpp"
 #include "ngraph/shape_util.hpp"
 
 #ifdef _WIN32
@@ -33,32 +34,24 @@ namespace ngraph
         namespace reference
         {
             template <typename T>
-            void min(const T* arg, T* out, const Shape& in_shape, const AxisSet& reduction_axes)
+            struct MinAccumulator
             {
-                T minval = std::numeric_limits<T>::has_infinity ? std::numeric_limits<T>::infinity()
-                                                                : std::numeric_limits<T>::max();
-
-                auto out_shape = reduce(in_shape, reduction_axes, false);
-                CoordinateTransform output_transform(out_shape);
-
-                for (const Coordinate& output_coord : output_transform)
-                {
-                    out[output_transform.index(output_coord)] = minval;
-                }
-
-                CoordinateTransform input_transform(in_shape);
-
-                for (const Coordinate& input_coord : input_transform)
+                void operator()(T x)
                 {
-                    Coordinate output_coord = reduce(input_coord, reduction_axes, false);
-
-                    T x = arg[input_transform.index(input_coord)];
-                    T min = out[output_transform.index(output_coord)];
                     if (x < min)
                     {
-                        out[output_transform.index(output_coord)] = x;
+                        min = x;
                     }
                 }
+                T result() const { return min; }
+                T min = std::numeric_limits<T>::has_infinity ? std::numeric_limits<T>::infinity()
+                                                             : std::numeric_limits<T>::max();
+            };
+
+            template <typename T>
+            void min(const T* arg, T* out, const Shape& in_shape, const AxisSet& reduction_axes)
+            {
+                reduce_by_output(arg, out, in_shape, reduction_axes, MinAccumulator<T>());
             }
         }
     }
@@ -0,0 +1,133 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <algorithm>
+#include <vector>
+
+#include "ngraph/axis_set.hpp"
+#include "ngraph/parallel.hpp"
+#include "ngraph/runtime/reference_fast_paths.hpp"
+#include "ngraph/shape.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace reference
+        {
+            /// \brief Reduces arg over reduction_axes computing every output element on its own,
+            ///        so output elements are computed concurrently.
+            ///
+            /// For every output element a copy of accumulator is called with the input values
+            /// reduced into the element, in row-major order like in a serial traversal of the
+            /// input, and the output is set to the accumulator's result().
+            /// Output elements are in row-major order of the non-reduced axes, which is valid
+            /// for both keep_dims values.
+            template <typename T, typename Accumulator>
+            void reduce_by_output(const T* arg,
+                                  T* out,
+                                  const Shape& in_shape,
+                                  const AxisSet& reduction_axes,
+                                  const Accumulator& accumulator)
+            {
+                Shape kept_shape;
+                Shape reduced_shape;
+                std::vector<size_t> kept_strides;
+                std::vector<size_t> reduced_strides;
+                size_t stride = shape_size(in_shape);
+                for (size_t axis = 0; axis < in_shape.size(); ++axis)
+                {
+                    stride = in_shape[axis] == 0 ? 0 : stride / in_shape[axis];
+                    if (reduction_axes.count(axis) != 0)
+                    {
+                        reduced_shape.push_back(in_shape[axis]);
+                        reduced_strides.push_back(stride);
+                    }
+                    else
+                    {
+                        kept_shape.push_back(in_shape[axis]);
+                        kept_strides.push_back(stride);
+                    }
+                }
+
+                const size_t out_count = shape_size(kept_shape);
+                const size_t reduced_count = shape_size(reduced_shape);
+                size_t grain = parallel_grain_size / std::max<size_t>(reduced_count, 1);
+                grain = std::max<size_t>(grain, 1);
+
+                // Reduction over the trailing axes reads a contiguous block per output element
+                bool trailing_axes = true;
+                for (size_t axis = in_shape.size() - reduced_shape.size(); axis < in_shape.size();
+                     ++axis)
+                {
+                    trailing_axes = trailing_axes && reduction_axes.count(axis) != 0;
+                }
+                if (trailing_axes && reference_fast_paths_enabled())
+                {
+                    parallel_for(out_count,
+                                 [&](size_t begin, size_t end) {
+                                     for (size_t out_index = begin; out_index < end; ++out_index)
+                                     {
+                                         const T* block = arg + out_index * reduced_count;
+                                         Accumulator acc(accumulator);
+                                         for (size_t r = 0; r < reduced_count; ++r)
+                                         {
+                                             acc(block[r]);
+                                         }
+                                         out[out_index] = acc.result();
+                                     }
+                                 },
+                                 grain);
+                    return;
+                }
+
+                auto reduce_range = [&](size_t begin, size_t end) {
+                    std::vector<size_t> reduced_coord(reduced_shape.size());
+                    for (size_t out_index = begin; out_index < end; ++out_index)
+                    {
+                        size_t offset = 0;
+                        for (size_t i = kept_shape.size(), rest = out_index; i-- > 0;)
+                        {
+                            offset += rest % kept_shape[i] * kept_strides[i];
+                            rest /= kept_shape[i];
+                        }
+
+                        Accumulator acc(accumulator);
+                        std::fill(reduced_coord.begin(), reduced_coord.end(), 0);
+                        for (size_t r = 0; r < reduced_count; ++r)
+                        {
+                            acc(arg[offset]);
+                            for (size_t i = reduced_shape.size(); i-- > 0;)
+                            {
+                                offset += reduced_strides[i];
+                                if (++reduced_coord[i] < reduced_shape[i])
+                                {
+                                    break;
+                                }
+                                offset -= reduced_strides[i] * reduced_shape[i];
+                                reduced_coord[i] = 0;
+                            }
+                        }
+                        out[out_index] = acc.result();
+                    }
+                };
+                parallel_for(out_count, reduce_range, grain);
+            }
+        }
+    }
+}
@@ -0,0 +1,48 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include "ngraph/shape.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace reference
+        {
+            /// \brief Copies a strided view of arg to out, densely in row-major order of shape.
+            ///
+            /// Element at coordinate c of shape is read from arg at element offset
+            /// sum(c[i] * in_strides[i]). Axes that are contiguous in arg are merged, so that
+            /// whole rows are copied at once where possible. Rows are copied concurrently.
+            ///
+            /// \param arg Pointer to the first element of the view.
+            /// \param out Pointer to the output buffer of shape_size(shape) elements.
+            /// \param shape Shape of the view.
+            /// \param in_strides Element strides of the view in arg, one per axis of shape.
+            /// \param elem_size Size of an element in bytes.
+            void strided_copy(const char* arg,
+                              char* out,
+                              const Shape& shape,
+                              const std::vector<size_t>& in_strides,
+                              size_t elem_size);
+        }
+    }
+}
@@ -19,6 +19,7 @@
 #include <cmath>
 
 #include "ngraph/coordinate_transform.hpp"
+#include "ngraph/runtime/reference/reduction.hpp"
 #include "ngraph/shape_util.hpp"
 #include "ngraph/type/bfloat16.hpp"
 #include "ngraph/type/float16.hpp"
@@ -52,44 +53,36 @@ namespace ngraph
                 return true;
             }
 
+            /// \brief Accumulates a sum with Kahan compensation
             template <typename T>
-            void sum(const T* arg,
-                     T* out,
-                     const Shape& in_shape,
-                     const AxisSet& reduction_axes,
-                     bool keep_dims)
+            struct SumAccumulator
             {
-                auto out_shape = reduce(in_shape, reduction_axes, keep_dims);
-                CoordinateTransform output_transform(out_shape);
-                std::vector<T> cs(shape_size(out_shape));
-
-                for (const Coordinate& output_coord : output_transform)
-                {
-                    out[output_transform.index(output_coord)] = 0;
-                    cs[output_transform.index(output_coord)] = 0;
-                }
-
-                CoordinateTransform input_transform(in_shape);
-
-                for (const Coordinate& input_coord : input_transform)
+                void operator()(T x)
                 {
-                    Coordinate output_coord = reduce(input_coord, reduction_axes, keep_dims);
-
-                    T x = arg[input_transform.index(input_coord)];
-                    T& z = out[output_transform.index(output_coord)];
-
-                    if (is_finite(x) && is_finite(z))
+                    if (is_finite(x) && is_finite(sum))
                     {
-                        T& c = cs[output_transform.index(output_coord)];
-                        T t = z + (x - c);
-                        c = (t - z) - (x - c);
-                        z = t;
+                        T t = sum + (x - compensation);
+                        compensation = (t - sum) - (x - compensation);
+                        sum = t;
                     }
                     else
                     {
-                        z = z + x;
+                        sum = sum + x;
                     }
                 }
+                T result() const { return sum; }
+                T sum = 0;
+                T compensation = 0;
+            };
+
+            template <typename T>
+            void sum(const T* arg,
+                     T* out,
+                     const Shape& in_shape,
+                     const AxisSet& reduction_axes,
+                     bool /* keep_dims */)
+            {
+                reduce_by_output(arg, out, in_shape, reduction_axes, SumAccumulator<T>());
             }
         }
     }
@@ -19,6 +19,7 @@
 
 #include "ngraph/check.hpp"
 #include "ngraph/runtime/opt_kernel/reshape.hpp"
+#include "ngraph/runtime/reference_fast_paths.hpp"
 
 using namespace ngraph;
 
@@ -253,6 +254,12 @@ void runtime::opt_kernel::reshape(const char* in,
                                   const Shape& out_shape,
                                   size_t elem_size)
 {
+    // Strided row copies of the reference kernel outperform the per element loops below
+    if (reference_fast_paths_enabled())
+    {
+        reference::reshape(in, out, in_shape, in_axis_order, out_shape, elem_size);
+        return;
+    }
     switch (in_shape.size())
     {
     case 0: reshape_in0(in, out, in_shape, in_axis_order, out_shape, elem_size); break;
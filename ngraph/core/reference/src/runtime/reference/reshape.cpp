@@ -19,6 +19,8 @@
 
 #include "ngraph/check.hpp"
 #include "ngraph/runtime/reference/reshape.hpp"
+#include "ngraph/runtime/reference/strided_copy.hpp"
+#include "ngraph/runtime/reference_fast_paths.hpp"
 
 using namespace ngraph;
 
@@ -29,6 +31,28 @@ void runtime::reference::reshape(const char* arg,
                                  const Shape& out_shape,
                                  size_t elem_size)
 {
+    if (reference_fast_paths_enabled())
+    {
+        NGRAPH_CHECK(in_axis_order.size() == in_shape.size() &&
+                     shape_size(in_shape) == shape_size(out_shape));
+        // Output is the input read along the permuted axes
+        std::vector<size_t> arg_strides(in_shape.size());
+        for (size_t i = in_shape.size(), stride = 1; i-- > 0;)
+        {
+            arg_strides[i] = stride;
+            stride *= in_shape[i];
+        }
+        Shape permuted_shape(in_shape.size());
+        std::vector<size_t> permuted_strides(in_shape.size());
+        for (size_t i = 0; i < in_axis_order.size(); ++i)
+        {
+            permuted_shape[i] = in_shape.at(in_axis_order[i]);
+            permuted_strides[i] = arg_strides.at(in_axis_order[i]);
+        }
+        strided_copy(arg, out, permuted_shape, permuted_strides, elem_size);
+        return;
+    }
+
     // Unfortunately we don't yet have a constructor for CoordinateTransform that lets
     // us pass only source_space_shape
     // and source_axis_order so we have to construct the defaults here.
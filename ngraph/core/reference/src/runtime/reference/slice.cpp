@@ -19,6 +19,8 @@
 
 #include "ngraph/check.hpp"
 #include "ngraph/runtime/reference/slice.hpp"
+#include "ngraph/runtime/reference/strided_copy.hpp"
+#include "ngraph/runtime/reference_fast_paths.hpp"
 
 namespace ngraph
 {
@@ -35,6 +37,34 @@ namespace ngraph
                        const Shape& out_shape,
                        size_t elem_size)
             {
+                if (reference_fast_paths_enabled())
+                {
+                    const size_t rank = arg_shape.size();
+                    NGRAPH_CHECK(lower_bounds.size() == rank && upper_bounds.size() == rank &&
+                                 strides.size() == rank);
+                    Shape slice_shape(rank);
+                    std::vector<size_t> slice_strides(rank);
+                    size_t offset = 0;
+                    for (size_t i = rank, arg_stride = 1; i-- > 0;)
+                    {
+                        NGRAPH_CHECK(strides[i] > 0 && upper_bounds[i] <= arg_shape[i]);
+                        size_t extent = upper_bounds[i] > lower_bounds[i]
+                                            ? upper_bounds[i] - lower_bounds[i]
+                                            : 0;
+                        slice_shape[i] = (extent + strides[i] - 1) / strides[i];
+                        slice_strides[i] = arg_stride * strides[i];
+                        offset += lower_bounds[i] * arg_stride;
+                        arg_stride *= arg_shape[i];
+                    }
+                    NGRAPH_CHECK(shape_size(slice_shape) == shape_size(out_shape));
+                    if (shape_size(slice_shape) != 0)
+                    {
+                        strided_copy(
+                            arg + offset * elem_size, out, slice_shape, slice_strides, elem_size);
+                    }
+                    return;
+                }
+
                 CoordinateTransform input_transform(arg_shape, lower_bounds, upper_bounds, strides);
                 CoordinateTransform output_transform(out_shape);
 
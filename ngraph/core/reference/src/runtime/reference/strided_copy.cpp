@@ -0,0 +1,119 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <algorithm>
+#include <cstring>
+
+#include "ngraph/check.hpp"
+#include "ngraph/parallel.hpp"
+#include "ngraph/runtime/reference/strided_copy.hpp"
+
+using namespace ngraph;
+
+namespace
+{
+    // Fixed size memcpy is compiled to a plain load and store
+    template <size_t ElemSize>
+    void copy_row(const char* in, char* out, size_t count, size_t stride)
+    {
+        for (size_t i = 0; i < count; ++i)
+        {
+            memcpy(out + i * ElemSize, in + i * stride * ElemSize, ElemSize);
+        }
+    }
+
+    void copy_row(const char* in, char* out, size_t count, size_t stride, size_t elem_size)
+    {
+        if (stride == 1)
+        {
+            memcpy(out, in, count * elem_size);
+            return;
+        }
+        switch (elem_size)
+        {
+        case 1: copy_row<1>(in, out, count, stride); break;
+        case 2: copy_row<2>(in, out, count, stride); break;
+        case 4: copy_row<4>(in, out, count, stride); break;
+        case 8: copy_row<8>(in, out, count, stride); break;
+        default:
+            for (size_t i = 0; i < count; ++i)
+            {
+                memcpy(out + i * elem_size, in + i * stride * elem_size, elem_size);
+            }
+            break;
+        }
+    }
+}
+
+void runtime::reference::strided_copy(const char* arg,
+                                      char* out,
+                                      const Shape& shape,
+                                      const std::vector<size_t>& in_strides,
+                                      size_t elem_size)
+{
+    NGRAPH_CHECK(shape.size() == in_strides.size(), "Strides do not match shape rank");
+    if (shape_size(shape) == 0)
+    {
+        return;
+    }
+
+    // Drop unit axes and merge axes that are contiguous in arg
+    Shape dims;
+    std::vector<size_t> strides;
+    for (size_t i = 0; i < shape.size(); ++i)
+    {
+        if (shape[i] == 1)
+        {
+            continue;
+        }
+        if (!dims.empty() && strides.back() == in_strides[i] * shape[i])
+        {
+            dims.back() *= shape[i];
+            strides.back() = in_strides[i];
+        }
+        else
+        {
+            dims.push_back(shape[i]);
+            strides.push_back(in_strides[i]);
+        }
+    }
+    if (dims.empty())
+    {
+        dims.push_back(1);
+        strides.push_back(1);
+    }
+
+    const size_t inner = dims.back();
+    const size_t inner_stride = strides.back();
+    const size_t rows = shape_size(dims) / inner;
+    auto copy_rows = [&](size_t begin, size_t end) {
+        for (size_t row = begin; row < end; ++row)
+        {
+            size_t offset = 0;
+            for (size_t i = dims.size() - 1, rest = row; i-- > 0;)
+            {
+                offset += rest % dims[i] * strides[i];
+                rest /= dims[i];
+            }
+            copy_row(arg + offset * elem_size,
+                     out + row * inner * elem_size,
+                     inner,
+                     inner_stride,
+                     elem_size);
+        }
+    };
+    parallel_for(rows, copy_rows, std::max<size_t>(parallel_grain_size / inner, 1));
+}
@@ -57,6 +57,8 @@ void descriptor::Input::replace_output(Output& new_output)
     new_output.add_input(this);
     m_output = &new_output;
     m_src_node = std::shared_ptr<Node>(new_output.get_node());
+    // the node is rewired: topological orders of the functions it belongs to are not valid anymore
+    m_node->invalidate_topological_cache();
 
     if (getenv_bool("NGRAPH_ENABLE_REPLACE_CHECK"))
     {
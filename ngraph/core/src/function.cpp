@@ -26,6 +26,7 @@
 #include "ngraph/op/util/op_types.hpp"
 #include "ngraph/util.hpp"
 #include "ngraph/validation_util.hpp"
+#include "shared_rt_info.hpp"
 
 using namespace std;
 using namespace ngraph;
@@ -42,6 +43,7 @@ Function::Function(const ResultVector& results,
     , m_name(name)
     , m_unique_name("Function_" + to_string(m_next_instance_id.fetch_add(1)))
     , m_topological_sorter(topological_sort<std::vector<std::shared_ptr<Node>>>)
+    , m_shared_rt_info(std::make_shared<SharedRTInfo>())
 {
     validate_nodes_and_infer_types();
 }
@@ -54,6 +56,7 @@ Function::Function(const OutputVector& results,
     , m_name(name)
     , m_unique_name("Function_" + to_string(m_next_instance_id.fetch_add(1)))
     , m_topological_sorter(topological_sort<std::vector<std::shared_ptr<Node>>>)
+    , m_shared_rt_info(std::make_shared<SharedRTInfo>())
 {
     validate_nodes_and_infer_types();
 }
@@ -66,6 +69,7 @@ Function::Function(const NodeVector& results,
     , m_name(name)
     , m_unique_name("Function_" + to_string(m_next_instance_id.fetch_add(1)))
     , m_topological_sorter(topological_sort<std::vector<std::shared_ptr<Node>>>)
+    , m_shared_rt_info(std::make_shared<SharedRTInfo>())
 {
     validate_nodes_and_infer_types();
 }
@@ -101,17 +105,54 @@ std::vector<shared_ptr<Node>> Function::get_ordered_ops() const
 {
     OV_ITT_SCOPED_TASK(itt::domains::nGraph, "Function::get_ordered_ops");
 
-    vector<shared_ptr<Node>> nodes;
-    for (auto& r : get_results())
+    lock_guard<mutex> lock(m_topological_sort_mutex);
+
+    vector<shared_ptr<Node>> order;
+    if (m_shared_rt_info->get_use_topological_cache())
     {
-        nodes.push_back(r);
+        order.reserve(m_cached_ordered_ops.size());
+        for (const auto& cached : m_cached_ordered_ops)
+        {
+            auto node = cached.lock();
+            if (!node)
+            {
+                // can't happen unless the graph has been changed bypassing the nodes' API
+                break;
+            }
+            order.push_back(node);
+        }
+        if (order.size() == m_cached_ordered_ops.size())
+        {
+            return order;
+        }
     }
-    for (auto& param : get_parameters())
+
+    {
+        OV_ITT_SCOPED_TASK(itt::domains::nGraph, "Function::topological_sort");
+        OV_ITT_COUNTER_INC(itt::domains::nGraph, "Function::topological_sort");
+
+        vector<shared_ptr<Node>> nodes;
+        for (auto& r : get_results())
+        {
+            nodes.push_back(r);
+        }
+        for (auto& param : get_parameters())
+        {
+            nodes.push_back(param);
+        }
+
+        order = m_topological_sorter(nodes);
+    }
+
+    // every node of the order invalidates it once the node is rewired
+    m_cached_ordered_ops.assign(order.begin(), order.end());
+    for (const auto& node : order)
     {
-        nodes.push_back(param);
+        node->insert_shared_rt_info(m_shared_rt_info);
     }
+    m_shared_rt_info->set_use_topological_cache(true);
 
-    return m_topological_sorter(nodes);
+    return order;
 }
 
 void Function::map_unordered_ops(std::function<void(Node*)> f) const
@@ -270,11 +311,13 @@ void Function::replace_parameter(size_t parameter_index, const shared_ptr<op::Pa
                  " parameters.");
     replace_node(m_parameters[parameter_index], parameter);
     m_parameters[parameter_index] = parameter;
+    m_shared_rt_info->set_use_topological_cache(false);
 }
 
 void Function::set_topological_sort(topological_sort_t sorter)
 {
     m_topological_sorter = sorter;
+    m_shared_rt_info->set_use_topological_cache(false);
 }
 
 int64_t Function::get_parameter_index(const std::shared_ptr<op::Parameter>& parameter) const
@@ -27,6 +27,7 @@
 #include "ngraph/op/parameter.hpp"
 #include "ngraph/op/result.hpp"
 #include "ngraph/pattern/matcher.hpp"
+#include "shared_rt_info.hpp"
 
 using namespace std;
 using namespace ngraph;
@@ -197,6 +198,7 @@ void Node::set_arguments(const OutputVector& arguments)
         auto& output_descriptor = output_node->m_outputs.at(output.get_index());
         m_inputs.emplace_back(this, i++, output_descriptor);
     }
+    invalidate_topological_cache();
 }
 
 descriptor::Input& Node::get_input_descriptor(size_t position)
@@ -490,6 +492,7 @@ void Node::add_control_dependency(std::shared_ptr<Node> node)
     if (find(m_control_dependencies.begin(), m_control_dependencies.end(), node) ==
         m_control_dependencies.end())
     {
+        invalidate_topological_cache();
         m_control_dependencies.push_back(node);
         if (find(node->m_control_dependents.begin(), node->m_control_dependents.end(), this) ==
             node->m_control_dependents.end())
@@ -527,6 +530,7 @@ void Node::remove_control_dependency(std::shared_ptr<Node> node)
         auto it = find(m_control_dependencies.begin(), m_control_dependencies.end(), node);
         if (it != m_control_dependencies.end())
         {
+            invalidate_topological_cache();
             m_control_dependencies.erase(it);
         }
     }
@@ -549,6 +553,10 @@ void Node::clear_control_dependencies()
             node->m_control_dependents.erase(it);
         }
     }
+    if (!m_control_dependencies.empty())
+    {
+        invalidate_topological_cache();
+    }
     m_control_dependencies.clear();
 }
 
@@ -560,6 +568,34 @@ void Node::clear_control_dependents()
     }
 }
 
+void Node::insert_shared_rt_info(const std::shared_ptr<SharedRTInfo>& info)
+{
+    // forget the functions which don't exist anymore
+    m_shared_rt_info.erase(remove_if(m_shared_rt_info.begin(),
+                                     m_shared_rt_info.end(),
+                                     [](const weak_ptr<SharedRTInfo>& i) { return i.expired(); }),
+                           m_shared_rt_info.end());
+    for (const auto& existing : m_shared_rt_info)
+    {
+        if (existing.lock() == info)
+        {
+            return;
+        }
+    }
+    m_shared_rt_info.push_back(info);
+}
+
+void Node::invalidate_topological_cache()
+{
+    for (const auto& weak_info : m_shared_rt_info)
+    {
+        if (auto info = weak_info.lock())
+        {
+            info->set_use_topological_cache(false);
+        }
+    }
+}
+
 const op::AutoBroadcastSpec& Node::get_autob() const
 {
     static op::AutoBroadcastSpec s_spec;
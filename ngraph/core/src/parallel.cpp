@@ -0,0 +1,292 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+#include "ngraph/env_util.hpp"
+#include "ngraph/parallel.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+namespace
+{
+    thread_local bool s_parallel_enabled = false;
+    thread_local bool s_in_parallel_region = false;
+    atomic<size_t> s_parallel_threads{0};
+
+    size_t default_parallel_threads()
+    {
+        static const size_t threads = []() -> size_t {
+            int32_t env_threads = getenv_int("NGRAPH_PARALLEL_THREADS", 0);
+            if (env_threads > 0)
+            {
+                return static_cast<size_t>(env_threads);
+            }
+            return max<size_t>(thread::hardware_concurrency(), 1);
+        }();
+        return threads;
+    }
+
+    // A single parallel call, workers are claimed one by one by the calling thread and the
+    // threads helping it, whoever comes first
+    class ParallelCall
+    {
+    public:
+        ParallelCall(size_t workers, const function<void(size_t)>& body)
+            : m_workers(workers)
+            , m_body(body)
+            , m_errors(workers)
+        {
+        }
+
+        void work()
+        {
+            for (size_t worker = m_next_worker++; worker < m_workers; worker = m_next_worker++)
+            {
+                bool in_parallel_region = s_in_parallel_region;
+                s_in_parallel_region = true;
+                try
+                {
+                    m_body(worker);
+                }
+                catch (...)
+                {
+                    m_errors[worker] = current_exception();
+                }
+                s_in_parallel_region = in_parallel_region;
+
+                lock_guard<mutex> lock(m_mutex);
+                if (++m_done_workers == m_workers)
+                {
+                    m_done.notify_all();
+                }
+            }
+        }
+
+        void wait()
+        {
+            unique_lock<mutex> lock(m_mutex);
+            m_done.wait(lock, [this] { return m_done_workers == m_workers; });
+            for (auto& error : m_errors)
+            {
+                if (error)
+                {
+                    rethrow_exception(error);
+                }
+            }
+        }
+
+    private:
+        const size_t m_workers;
+        // Not used once all workers are claimed, so a late pool thread never touches it
+        const function<void(size_t)>& m_body;
+        vector<exception_ptr> m_errors;
+        atomic<size_t> m_next_worker{0};
+        mutex m_mutex;
+        condition_variable m_done;
+        size_t m_done_workers = 0;
+    };
+
+    atomic<parallel_executor> s_parallel_executor{nullptr};
+}
+
+// Threads of a ParallelScope, they are started on the first parallel call needing them and
+// joined when the scope is closed
+class ngraph::ParallelScope::WorkerPool
+{
+public:
+    WorkerPool() = default;
+
+    ~WorkerPool()
+    {
+        {
+            lock_guard<mutex> lock(m_mutex);
+            m_stop = true;
+        }
+        m_ready.notify_all();
+        for (auto& thread : m_threads)
+        {
+            thread.join();
+        }
+    }
+
+    // Runs the call, the calling thread takes part in the work, so all workers are done even if
+    // no thread of the pool is free
+    void run(const shared_ptr<ParallelCall>& call, size_t workers)
+    {
+        {
+            lock_guard<mutex> lock(m_mutex);
+            size_t helpers = start_threads(workers - 1);
+            for (size_t i = 0; i < helpers; ++i)
+            {
+                m_tasks.push_back(call);
+            }
+        }
+        m_ready.notify_all();
+        call->work();
+    }
+
+private:
+    // Returns the number of threads available, up to count
+    size_t start_threads(size_t count)
+    {
+        try
+        {
+            while (m_threads.size() < count)
+            {
+                m_threads.emplace_back(&WorkerPool::worker_loop, this);
+            }
+        }
+        catch (const system_error&)
+        {
+        }
+        return min(count, m_threads.size());
+    }
+
+    void worker_loop()
+    {
+        while (true)
+        {
+            shared_ptr<ParallelCall> call;
+            {
+                unique_lock<mutex> lock(m_mutex);
+                m_ready.wait(lock, [this] { return m_stop || !m_tasks.empty(); });
+                if (m_tasks.empty())
+                {
+                    return;
+                }
+                call = move(m_tasks.front());
+                m_tasks.pop_front();
+            }
+            call->work();
+        }
+    }
+
+    mutex m_mutex;
+    condition_variable m_ready;
+    deque<shared_ptr<ParallelCall>> m_tasks;
+    vector<thread> m_threads;
+    bool m_stop = false;
+};
+
+namespace
+{
+    // Pool of the outermost ParallelScope of the current thread
+    thread_local ParallelScope::WorkerPool* s_worker_pool = nullptr;
+
+    void run_workers(size_t workers, const function<void(size_t)>& body)
+    {
+        auto call = make_shared<ParallelCall>(workers, body);
+        if (auto executor = s_parallel_executor.load())
+        {
+            executor(workers, [&call](size_t) { call->work(); });
+        }
+        else
+        {
+            s_worker_pool->run(call, workers);
+        }
+        call->wait();
+    }
+}
+
+ParallelScope::ParallelScope()
+    : m_was_enabled(s_parallel_enabled)
+{
+    s_parallel_enabled = true;
+    if (!s_worker_pool)
+    {
+        m_worker_pool.reset(new WorkerPool());
+        s_worker_pool = m_worker_pool.get();
+    }
+}
+
+ParallelScope::~ParallelScope()
+{
+    if (m_worker_pool)
+    {
+        s_worker_pool = nullptr;
+    }
+    s_parallel_enabled = m_was_enabled;
+}
+
+size_t ngraph::get_parallel_threads()
+{
+    size_t threads = s_parallel_threads;
+    return threads == 0 ? default_parallel_threads() : threads;
+}
+
+void ngraph::set_parallel_threads(size_t threads)
+{
+    s_parallel_threads = threads;
+}
+
+void ngraph::set_parallel_executor(parallel_executor executor)
+{
+    s_parallel_executor = executor;
+}
+
+void ngraph::parallel_for(size_t count,
+                          const function<void(size_t begin, size_t end)>& body,
+                          size_t grain)
+{
+    if (count == 0)
+    {
+        return;
+    }
+    size_t workers = min(get_parallel_threads(), count / max<size_t>(grain, 1));
+    if (workers <= 1 || s_in_parallel_region || !s_parallel_enabled)
+    {
+        body(0, count);
+        return;
+    }
+    const size_t chunk = count / workers;
+    const size_t remainder = count % workers;
+    run_workers(workers, [&](size_t worker) {
+        size_t begin = worker * chunk + min(worker, remainder);
+        size_t end = begin + chunk + (worker < remainder ? 1 : 0);
+        body(begin, end);
+    });
+}
+
+void ngraph::parallel_for_each(size_t count, const function<void(size_t index)>& body)
+{
+    size_t workers = min(get_parallel_threads(), count);
+    if (workers <= 1 || s_in_parallel_region || !s_parallel_enabled)
+    {
+        for (size_t index = 0; index < count; ++index)
+        {
+            body(index);
+        }
+        return;
+    }
+    atomic<size_t> next_index{0};
+    run_workers(workers, [&](size_t) {
+        for (size_t index = next_index++; index < count; index = next_index++)
+        {
+            body(index);
+        }
+    });
+}
@@ -14,11 +14,47 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <unordered_set>
+
 #include "constant_folding.hpp"
+#include "ngraph/op/constant.hpp"
+#include "ngraph/op/util/op_types.hpp"
+#include "ngraph/op/util/sub_graph_base.hpp"
+#include "ngraph/parallel.hpp"
 
 using namespace std;
 using namespace ngraph;
 
+namespace
+{
+    // Memory taken while a node is folded: copies of the inputs and the results, which are
+    // first evaluated into tensors and then copied into constants.
+    size_t folding_memory(const shared_ptr<Node>& node)
+    {
+        size_t bytes = 0;
+        for (const auto& input : node->inputs())
+        {
+            bytes += shape_size(input.get_shape()) * input.get_element_type().size();
+        }
+        for (const auto& output : node->outputs())
+        {
+            bytes += 2 * shape_size(output.get_shape()) * output.get_element_type().size();
+        }
+        return bytes;
+    }
+
+    void add_consumers(const shared_ptr<Node>& node, vector<shared_ptr<Node>>& consumers)
+    {
+        for (const auto& output : node->outputs())
+        {
+            for (const auto& input : output.get_target_inputs())
+            {
+                consumers.push_back(input.get_node()->shared_from_this());
+            }
+        }
+    }
+}
+
 bool ngraph::pass::revalidate_and_ensure_static(shared_ptr<Node> n)
 {
     n->revalidate_and_infer_types();
@@ -67,3 +103,126 @@ void ngraph::pass::ConstantFolding::construct_constant_default()
         },
         PassProperty::CHANGE_DYNAMIC_STATE));
 }
+
+bool ngraph::pass::ConstantFolding::is_foldable(const shared_ptr<Node>& node)
+{
+    if (node->get_input_size() == 0 || op::is_output(node) || cf_is_disabled(node) ||
+        dynamic_pointer_cast<op::util::SubGraphOp>(node))
+    {
+        return false;
+    }
+    for (const auto& input_value : node->input_values())
+    {
+        if (!op::is_constant(input_value.get_node()))
+        {
+            return false;
+        }
+    }
+    // Skip nodes already replaced
+    bool is_used = false;
+    for (const auto& output : node->outputs())
+    {
+        is_used |= !output.get_target_inputs().empty();
+    }
+    return is_used && revalidate_and_ensure_static(node);
+}
+
+// Nodes whose inputs are all constants do not depend on each other, so every wave of them is
+// folded concurrently. Folded nodes make their consumers the candidates of the next wave. Nodes
+// matched by the specific constant folding matchers keep being folded by them, serially.
+bool ngraph::pass::ConstantFolding::fold_independent_nodes(const shared_ptr<Function>& f)
+{
+    bool rewritten = false;
+
+    vector<shared_ptr<Node>> candidates = f->get_ordered_ops();
+    while (!candidates.empty())
+    {
+        vector<shared_ptr<Node>> next_candidates;
+        vector<shared_ptr<Node>> wave;
+        unordered_set<Node*> visited;
+        for (const auto& node : candidates)
+        {
+            if (!visited.insert(node.get()).second || !is_foldable(node))
+            {
+                continue;
+            }
+
+            vector<shared_ptr<Node>> consumers;
+            add_consumers(node, consumers);
+            bool matched = false;
+            for (const auto& m_pass : m_matchers)
+            {
+                if (!m_has_default_callback)
+                {
+                    m_pass->set_callback(m_transformation_callback);
+                }
+                // Matchers without a pattern do the default folding, done concurrently below
+                if (m_pass->get_matcher() && m_pass->apply(node))
+                {
+                    matched = true;
+                    break;
+                }
+            }
+            if (matched)
+            {
+                rewritten = true;
+                next_candidates.insert(next_candidates.end(), consumers.begin(), consumers.end());
+            }
+            else
+            {
+                wave.push_back(node);
+            }
+        }
+
+        for (size_t begin = 0, end = 0; begin < wave.size(); begin = end)
+        {
+            size_t memory = folding_memory(wave[end++]);
+            while (end < wave.size() && memory + folding_memory(wave[end]) <= m_memory_budget)
+            {
+                memory += folding_memory(wave[end++]);
+            }
+
+            vector<OutputVector> replacements(end - begin);
+            vector<char> folded(end - begin, 0);
+            parallel_for_each(end - begin, [&](size_t index) {
+                const auto& node = wave[begin + index];
+                replacements[index].resize(node->get_output_size());
+                folded[index] = node->constant_fold(replacements[index], node->input_values());
+            });
+
+            for (size_t index = 0; index < end - begin; ++index)
+            {
+                const auto& node = wave[begin + index];
+                if (!folded[index])
+                {
+                    continue;
+                }
+                NGRAPH_CHECK(replacements[index].size() == node->get_output_size(),
+                             "constant_fold_default returned incorrect number of replacements for ",
+                             node);
+                add_consumers(node, next_candidates);
+                for (size_t i = 0; i < replacements[index].size(); ++i)
+                {
+                    auto node_output = node->output(i);
+                    auto replacement = replacements[index].at(i);
+                    if (replacement.get_node_shared_ptr() && (node_output != replacement))
+                    {
+                        node_output.replace(replacement);
+                        rewritten = true;
+                    }
+                }
+            }
+        }
+        candidates.swap(next_candidates);
+    }
+    return rewritten;
+}
+
+bool ngraph::pass::ConstantFolding::run_on_function(shared_ptr<Function> f)
+{
+    // Reference kernels run by folding may use the worker threads, other users of the kernels
+    // are not affected
+    ParallelScope parallel_scope;
+    bool rewritten = fold_independent_nodes(f);
+    return GraphRewrite::run_on_function(f) || rewritten;
+}
@@ -15,6 +15,7 @@
 //*****************************************************************************
 
 #include <algorithm>
+#include <chrono>
 #include <deque>
 #include <iostream>
 #include <pattern/op/wrap_type.hpp>
@@ -27,6 +28,7 @@
 #include "ngraph/env_util.hpp"
 #include "ngraph/log.hpp"
 #include "ngraph/op/util/sub_graph_base.hpp"
+#include "ngraph/pass/profiler.hpp"
 
 using namespace std;
 using namespace ngraph;
@@ -123,11 +125,22 @@ bool pass::GraphRewrite::run_on_function(shared_ptr<Function> f)
         // including ones triggered by parent type info.
     }
 
+    // Matcher statistics are attributed to the innermost pass being profiled
+    pass::Profiler* profiler = pass::Profiler::get_current();
+    std::vector<size_t> profiled_matchers;
+    if (profiler)
+    {
+        for (const auto& m_pass : m_matchers)
+        {
+            profiled_matchers.push_back(profiler->register_matcher(m_pass->get_name()));
+        }
+    }
+
     // This lambda preforms execution of particular MatcherPass on given node.
     // It automatically handles nodes registered by MatcherPass during transformation and set
     // transformation callback.
-    auto run_matcher_pass = [&](std::shared_ptr<MatcherPass> m_pass,
-                                std::shared_ptr<Node> node) -> bool {
+    auto run_matcher_pass = [&](size_t matcher_index, std::shared_ptr<Node> node) -> bool {
+        const auto& m_pass = m_matchers[matcher_index];
         // Keep this property check for backward compatibility. In future transformation property
         // will be deprecated and removed.
         if (m_pass->get_property(PassProperty::REQUIRE_STATIC_SHAPE) && f->is_dynamic())
@@ -146,7 +159,20 @@ bool pass::GraphRewrite::run_on_function(shared_ptr<Function> f)
 
         // Apply MatcherPass. In case if it returns true no other MatcherPasses will apply
         // to this node
-        bool status = m_pass->apply(node);
+        bool status = false;
+        if (profiler)
+        {
+            auto start = chrono::steady_clock::now();
+            status = m_pass->apply(node);
+            auto time = chrono::steady_clock::now() - start;
+            profiler->add_matcher_run(profiled_matchers[matcher_index],
+                                      chrono::duration_cast<chrono::microseconds>(time).count(),
+                                      status);
+        }
+        else
+        {
+            status = m_pass->apply(node);
+        }
 
         // In case if MatcherPass registered nodes they will be added to the beginning of execution
         // queue
@@ -212,7 +238,7 @@ bool pass::GraphRewrite::run_on_function(shared_ptr<Function> f)
 
             for (size_t matcher_index : matcher_passes_to_run)
             {
-                if (run_matcher_pass(m_matchers[matcher_index], node))
+                if (run_matcher_pass(matcher_index, node))
                 {
                     rewritten = true;
                     break;
@@ -222,9 +248,9 @@ bool pass::GraphRewrite::run_on_function(shared_ptr<Function> f)
         // Otherwise we use default algorithm that iterates over all registered matcher passes
         else
         {
-            for (auto& m_pass : m_matchers)
+            for (size_t matcher_index = 0; matcher_index < m_matchers.size(); ++matcher_index)
             {
-                if (run_matcher_pass(m_pass, node))
+                if (run_matcher_pass(matcher_index, node))
                 {
                     rewritten = true;
                     break;
@@ -49,6 +49,18 @@ void pass::Manager::run_passes(shared_ptr<Function> func)
 
     static bool profile_enabled = getenv_bool("NGRAPH_PROFILE_PASS_ENABLE");
 
+    // A profiler of the enclosing pass::Manager is kept for passes running nested managers
+    Profiler* profiler = m_profiler ? m_profiler.get() : Profiler::get_current();
+    struct CurrentProfiler
+    {
+        explicit CurrentProfiler(Profiler* profiler)
+            : previous(Profiler::set_current(profiler))
+        {
+        }
+        ~CurrentProfiler() { Profiler::set_current(previous); }
+        Profiler* previous;
+    } current_profiler(profiler);
+
     size_t index = 0;
     stopwatch pass_timer;
     stopwatch overall_timer;
@@ -57,6 +69,7 @@ void pass::Manager::run_passes(shared_ptr<Function> func)
     for (auto& pass : m_pass_list)
     {
         pass_timer.start();
+        Profiler::ScopedPass profiled_pass(profiler, pass->get_name(), func);
         if (!m_has_default_callback)
         {
             pass->set_callback(m_transformation_callback);
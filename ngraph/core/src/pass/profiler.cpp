@@ -0,0 +1,223 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <chrono>
+#include <exception>
+#include <sstream>
+
+#include "ngraph/chrome_trace.hpp"
+#include "ngraph/function.hpp"
+#include "ngraph/pass/profiler.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+namespace
+{
+    thread_local pass::Profiler* s_current_profiler = nullptr;
+
+    string escape_json(const string& value)
+    {
+        string result;
+        result.reserve(value.size());
+        for (char c : value)
+        {
+            if (c == '"' || c == '\\')
+            {
+                result += '\\';
+            }
+            result += c;
+        }
+        return result;
+    }
+
+    void write_matchers(ostream& out, const vector<pass::Profiler::MatcherRecord>& matchers)
+    {
+        out << "[";
+        for (size_t i = 0; i < matchers.size(); ++i)
+        {
+            const auto& matcher = matchers[i];
+            out << (i == 0 ? "" : ",") << R"({"name":")" << escape_json(matcher.name)
+                << R"(","attempts":)" << matcher.attempts << R"(,"matches":)" << matcher.matches
+                << R"(,"time_us":)" << matcher.time_us << "}";
+        }
+        out << "]";
+    }
+}
+
+pass::Profiler::Profiler()
+{
+}
+
+pass::Profiler::~Profiler()
+{
+}
+
+void pass::Profiler::clear()
+{
+    m_records.clear();
+    m_open_passes.clear();
+    m_origin_us = -1;
+}
+
+pass::Profiler* pass::Profiler::get_current()
+{
+    return s_current_profiler;
+}
+
+pass::Profiler* pass::Profiler::set_current(Profiler* profiler)
+{
+    Profiler* previous = s_current_profiler;
+    s_current_profiler = profiler;
+    return previous;
+}
+
+int64_t pass::Profiler::now_us() const
+{
+    return chrono::duration_cast<chrono::microseconds>(
+               chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+
+void pass::Profiler::begin_pass(const string& name, const shared_ptr<Function>& f)
+{
+    PassRecord record;
+    record.name = name;
+    record.depth = m_open_passes.size();
+    record.nodes_before = f->get_ordered_ops().size();
+    m_records.push_back(move(record));
+
+    // Counting nodes may sort the function, keep it out of the pass time
+    OpenPass open_pass;
+    open_pass.record = m_records.size() - 1;
+    open_pass.trace_event.reset(new event::Duration(name, "Pass"));
+    open_pass.start_us = now_us();
+    if (m_origin_us < 0)
+    {
+        m_origin_us = open_pass.start_us;
+    }
+    m_records.back().start_us = open_pass.start_us - m_origin_us;
+    m_open_passes.push_back(move(open_pass));
+}
+
+void pass::Profiler::end_pass(const shared_ptr<Function>& f, bool count_nodes)
+{
+    if (m_open_passes.empty())
+    {
+        return;
+    }
+    // The pass is closed before counting nodes, so the profiler stays consistent if it throws
+    OpenPass open_pass = move(m_open_passes.back());
+    m_open_passes.pop_back();
+    PassRecord& record = m_records[open_pass.record];
+    record.time_us = now_us() - open_pass.start_us;
+    open_pass.trace_event->stop();
+    if (count_nodes)
+    {
+        record.nodes_after = f->get_ordered_ops().size();
+    }
+
+    stringstream args;
+    args << R"({"nodes_before":)" << record.nodes_before << R"(,"nodes_after":)"
+         << record.nodes_after;
+    if (!record.matchers.empty())
+    {
+        args << R"(,"matchers":)";
+        write_matchers(args, record.matchers);
+    }
+    args << "}";
+    open_pass.trace_event->set_args(args.str());
+}
+
+size_t pass::Profiler::register_matcher(const string& name)
+{
+    if (m_open_passes.empty())
+    {
+        return 0;
+    }
+    auto& matchers = m_records[m_open_passes.back().record].matchers;
+    for (size_t i = 0; i < matchers.size(); ++i)
+    {
+        if (matchers[i].name == name)
+        {
+            return i;
+        }
+    }
+    MatcherRecord matcher;
+    matcher.name = name;
+    matchers.push_back(matcher);
+    return matchers.size() - 1;
+}
+
+void pass::Profiler::add_matcher_run(size_t matcher, int64_t time_us, bool matched)
+{
+    if (m_open_passes.empty())
+    {
+        return;
+    }
+    auto& matchers = m_records[m_open_passes.back().record].matchers;
+    if (matcher < matchers.size())
+    {
+        auto& record = matchers[matcher];
+        record.attempts++;
+        record.matches += matched ? 1 : 0;
+        record.time_us += time_us;
+    }
+}
+
+void pass::Profiler::write_json(ostream& out) const
+{
+    out << R"({"passes":[)";
+    for (size_t i = 0; i < m_records.size(); ++i)
+    {
+        const auto& record = m_records[i];
+        out << (i == 0 ? "\n" : ",\n") << R"({"name":")" << escape_json(record.name)
+            << R"(","depth":)" << record.depth << R"(,"start_us":)" << record.start_us
+            << R"(,"time_us":)" << record.time_us << R"(,"nodes_before":)" << record.nodes_before
+            << R"(,"nodes_after":)" << record.nodes_after << R"(,"matchers":)";
+        write_matchers(out, record.matchers);
+        out << "}";
+    }
+    out << "\n]}\n";
+}
+
+pass::Profiler::ScopedPass::ScopedPass(Profiler* profiler,
+                                       const string& name,
+                                       const shared_ptr<Function>& f)
+    : m_profiler(profiler)
+    , m_function(f)
+{
+    if (m_profiler)
+    {
+        m_profiler->begin_pass(name, m_function);
+    }
+}
+
+pass::Profiler::ScopedPass::~ScopedPass()
+{
+    if (m_profiler)
+    {
+        // The function may be left broken by a throwing pass, so its nodes are not counted
+        // while unwinding. Any other failure must not escape the destructor either.
+        try
+        {
+            m_profiler->end_pass(m_function, !uncaught_exception());
+        }
+        catch (...)
+        {
+        }
+    }
+}
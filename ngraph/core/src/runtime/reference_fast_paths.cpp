@@ -0,0 +1,41 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <atomic>
+
+#include "ngraph/env_util.hpp"
+#include "ngraph/runtime/reference_fast_paths.hpp"
+
+using namespace ngraph;
+
+namespace
+{
+    std::atomic<bool>& fast_paths_enabled()
+    {
+        static std::atomic<bool> enabled{getenv_bool("NGRAPH_REFERENCE_FAST_PATHS", true)};
+        return enabled;
+    }
+}
+
+bool runtime::reference_fast_paths_enabled()
+{
+    return fast_paths_enabled();
+}
+
+void runtime::set_reference_fast_paths(bool enabled)
+{
+    fast_paths_enabled() = enabled;
+}
@@ -0,0 +1,34 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+namespace ngraph
+{
+    /// \brief State shared by a function and all of its nodes.
+    ///
+    /// A node doesn't know the functions it belongs to, so it notifies them about the changes of
+    /// the graph topology through this state, e.g. to invalidate the cached topological order.
+    class SharedRTInfo
+    {
+    public:
+        bool get_use_topological_cache() const { return m_use_topological_cache; }
+        void set_use_topological_cache(bool use) { m_use_topological_cache = use; }
+
+    private:
+        bool m_use_topological_cache = false;
+    };
+}
@@ -16,6 +16,7 @@
 
 #pragma once
 
+#include <memory>
 #include <onnx/onnx_pb.h>
 #include <ostream>
 #include <string>
@@ -34,6 +35,9 @@ namespace ngraph
         public:
             Model() = delete;
             explicit Model(const ONNX_NAMESPACE::ModelProto& model_proto);
+            /// \brief Constructs a model which shares ownership of the model proto, so that
+            ///        Constants made from initializers may refer to its data.
+            explicit Model(std::shared_ptr<const ONNX_NAMESPACE::ModelProto> model_proto);
 
             Model(const Model&) = default;
             Model(Model&&) = default;
@@ -44,6 +48,11 @@ namespace ngraph
             const std::string& get_producer_name() const { return m_model_proto->producer_name(); }
             const ONNX_NAMESPACE::GraphProto& get_graph() const { return m_model_proto->graph(); }
             std::int64_t get_model_version() const { return m_model_proto->model_version(); }
+            /// \brief Returns the model proto if its ownership is shared, nullptr otherwise
+            const std::shared_ptr<const ONNX_NAMESPACE::ModelProto>& get_shared_model_proto() const
+            {
+                return m_shared_model_proto;
+            }
             const std::string& get_producer_version() const
             {
                 return m_model_proto->producer_version();
@@ -76,6 +85,7 @@ namespace ngraph
 
         private:
             const ONNX_NAMESPACE::ModelProto* m_model_proto;
+            std::shared_ptr<const ONNX_NAMESPACE::ModelProto> m_shared_model_proto;
             std::unordered_map<std::string, OperatorSet> m_opset;
         };
 
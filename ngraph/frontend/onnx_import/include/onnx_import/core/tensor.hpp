@@ -16,11 +16,15 @@
 
 #pragma once
 
+#include <cstdint>
+#include <memory>
 #include <onnx/onnx_pb.h>
+#include <string>
 #include <utility>
 #include <vector>
 
 #include "ngraph/op/constant.hpp"
+#include "ngraph/runtime/shared_buffer.hpp"
 #include "ngraph/shape.hpp"
 #include "ngraph/type/element_type.hpp"
 #include "tensor_external_data.hpp"
@@ -476,8 +480,13 @@ namespace ngraph
             };
 
             Tensor() = delete;
-            explicit Tensor(const ONNX_NAMESPACE::TensorProto& tensor)
+            /// \param tensor       The tensor proto.
+            /// \param model_proto  Optional owner of the tensor proto. If provided, Constants
+            ///                     made from raw data refer to the proto instead of copying it.
+            explicit Tensor(const ONNX_NAMESPACE::TensorProto& tensor,
+                            std::shared_ptr<const ONNX_NAMESPACE::ModelProto> model_proto = nullptr)
                 : m_tensor_proto{&tensor}
+                , m_model_proto{std::move(model_proto)}
                 , m_shape{std::begin(tensor.dims()), std::end(tensor.dims())}
             {
                 if (m_shape == Shape{0})
@@ -599,8 +608,11 @@ namespace ngraph
             template <typename T>
             std::shared_ptr<ngraph::op::Constant> make_ng_constant(const element::Type& type) const
             {
-                auto constant =
-                    std::make_shared<ngraph::op::Constant>(type, m_shape, get_data<T>());
+                auto constant = make_shared_ng_constant(type, alignof(T));
+                if (!constant)
+                {
+                    constant = std::make_shared<ngraph::op::Constant>(type, m_shape, get_data<T>());
+                }
                 if (m_tensor_proto->has_name())
                 {
                     constant->set_friendly_name(get_name());
@@ -608,7 +620,48 @@ namespace ngraph
                 return constant;
             }
 
+            /// \brief Makes a Constant which refers to the tensor data in the mapped external file
+            ///        or in the raw data of the model proto, without copying it.
+            ///
+            /// \return The Constant or nullptr if the data has to be copied, e.g. because it is
+            ///         stored in typed fields, is misaligned or does not match the tensor shape.
+            std::shared_ptr<ngraph::op::Constant>
+                make_shared_ng_constant(const element::Type& type, size_t alignment) const
+            {
+                if (m_tensor_proto->has_segment())
+                {
+                    return nullptr;
+                }
+                const size_t byte_size = shape_size(m_shape) * type.size();
+                auto fits = [&](const char* data, size_t size) {
+                    return byte_size != 0 && size == byte_size &&
+                           reinterpret_cast<uintptr_t>(data) % alignment == 0;
+                };
+                if (detail::tensor::detail::has_tensor_external_data(*m_tensor_proto))
+                {
+                    auto buffer = detail::TensorExternalData(*m_tensor_proto).map_external_data();
+                    if (buffer && fits(buffer->get_ptr<char>(), buffer->size()))
+                    {
+                        return std::make_shared<ngraph::op::Constant>(type, m_shape, buffer);
+                    }
+                }
+                else if (m_model_proto && m_tensor_proto->has_raw_data())
+                {
+                    const std::string& raw_data = m_tensor_proto->raw_data();
+                    if (fits(raw_data.data(), raw_data.size()))
+                    {
+                        // The model proto outlives the Constant and is not modified anymore
+                        auto buffer = std::make_shared<runtime::SharedBuffer<
+                            std::shared_ptr<const ONNX_NAMESPACE::ModelProto>>>(
+                            const_cast<char*>(raw_data.data()), raw_data.size(), m_model_proto);
+                        return std::make_shared<ngraph::op::Constant>(type, m_shape, buffer);
+                    }
+                }
+                return nullptr;
+            }
+
             const ONNX_NAMESPACE::TensorProto* m_tensor_proto;
+            std::shared_ptr<const ONNX_NAMESPACE::ModelProto> m_model_proto;
             Shape m_shape;
         };
 
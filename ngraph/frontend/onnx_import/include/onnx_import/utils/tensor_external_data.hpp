@@ -16,7 +16,11 @@
 
 #pragma once
 
+#include <memory>
 #include <onnx/onnx_pb.h>
+#include <string>
+
+#include "ngraph/runtime/shared_buffer.hpp"
 
 namespace ngraph
 {
@@ -24,6 +28,31 @@ namespace ngraph
     {
         namespace detail
         {
+            /// \brief  Read-only (copy-on-write) memory mapping of a whole file
+            class MappedMemory
+            {
+            public:
+                /// \brief      Maps the file, returns nullptr if the file cannot be mapped
+                ///
+                /// \note       Mappings of a file are shared while any of them is alive, so
+                ///             initializers stored in one external file use a single mapping.
+                static std::shared_ptr<MappedMemory> map(const std::string& path);
+
+                MappedMemory(const MappedMemory&) = delete;
+                MappedMemory& operator=(const MappedMemory&) = delete;
+                ~MappedMemory();
+
+                char* data() const { return m_data; }
+                size_t size() const { return m_size; }
+            private:
+                MappedMemory() = default;
+
+                char* m_data = nullptr;
+                size_t m_size = 0;
+            };
+
+            using MappedBuffer = runtime::SharedBuffer<std::shared_ptr<MappedMemory>>;
+
             /// \brief  Helper class used to load tensor data from external files
             class TensorExternalData
             {
@@ -38,6 +67,15 @@ namespace ngraph
                 /// \return     External binary data loaded into a std::string
                 std::string load_external_data() const;
 
+                /// \brief      Map external data from tensor passed to constructor into memory
+                ///
+                /// \note       If the data is out of the external file bounds,
+                ///             the invalid_external_data is thrown
+                ///
+                /// \return     Buffer referring to the mapped data which keeps the mapping alive,
+                ///             nullptr if the file cannot be mapped
+                std::shared_ptr<MappedBuffer> map_external_data() const;
+
                 /// \brief      Represets parameter of external data as string
                 ///
                 /// \return     State of TensorExternalData as string representation
@@ -45,8 +83,8 @@ namespace ngraph
 
             private:
                 std::string m_data_location;
-                int m_offset = 0;
-                int m_data_lenght = 0;
+                size_t m_offset = 0;
+                size_t m_data_lenght = 0;
                 int m_sha1_digest = 0;
             };
         }
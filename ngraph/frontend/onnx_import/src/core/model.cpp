@@ -49,6 +49,12 @@ namespace ngraph
             }
         }
 
+        Model::Model(std::shared_ptr<const ONNX_NAMESPACE::ModelProto> model_proto)
+            : Model(*model_proto)
+        {
+            m_shared_model_proto = std::move(model_proto);
+        }
+
         const Operator& Model::get_operator(const std::string& name,
                                             const std::string& domain) const
         {
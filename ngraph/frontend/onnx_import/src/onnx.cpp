@@ -129,11 +129,13 @@ namespace ngraph
                 }
             }
 
-            std::shared_ptr<Function>
-                convert_to_ng_function(const ONNX_NAMESPACE::ModelProto& model_proto)
+            std::shared_ptr<Function> convert_to_ng_function(
+                std::shared_ptr<const ONNX_NAMESPACE::ModelProto> model_proto)
             {
+                // Constants made from initializers keep the model proto alive and refer to
+                // its raw data instead of copying it
                 Model model{model_proto};
-                Graph graph{model_proto.graph(), model};
+                Graph graph{model_proto->graph(), model};
                 auto function = std::make_shared<Function>(
                     graph.get_ng_outputs(), graph.get_ng_parameters(), graph.get_name());
                 for (std::size_t i{0}; i < function->get_output_size(); ++i)
@@ -158,9 +160,9 @@ namespace ngraph
                 }
             }
 
-            ONNX_NAMESPACE::ModelProto model_proto;
+            auto model_proto = std::make_shared<ONNX_NAMESPACE::ModelProto>();
             // Try parsing input as a binary protobuf message
-            if (!model_proto.ParseFromIstream(&stream))
+            if (!model_proto->ParseFromIstream(&stream))
             {
 #ifdef NGRAPH_USE_PROTOBUF_LITE
                 throw detail::error::stream_parse_binary();
@@ -170,17 +172,17 @@ namespace ngraph
                 stream.seekg(0);
                 google::protobuf::io::IstreamInputStream iistream(&stream);
                 // Try parsing input as a prototxt message
-                if (!google::protobuf::TextFormat::Parse(&iistream, &model_proto))
+                if (!google::protobuf::TextFormat::Parse(&iistream, model_proto.get()))
                 {
                     throw detail::error::stream_parse_text();
                 }
 #endif
             }
 
-            detail::fixup_legacy_operators(model_proto.mutable_graph());
-            detail::update_external_data_paths(model_proto, model_path);
+            detail::fixup_legacy_operators(model_proto->mutable_graph());
+            detail::update_external_data_paths(*model_proto, model_path);
 
-            return detail::convert_to_ng_function(model_proto);
+            return detail::convert_to_ng_function(std::move(model_proto));
         }
 
         std::shared_ptr<Function> import_onnx_model(const std::string& file_path)
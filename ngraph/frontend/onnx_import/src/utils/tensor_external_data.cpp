@@ -15,8 +15,23 @@
 //*****************************************************************************
 
 #include <fstream>
+#include <iterator>
+#include <map>
+#include <mutex>
 #include <sstream>
 
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#else
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#endif
+
 #include "ngraph/log.hpp"
 #include "onnx_import/exceptions.hpp"
 #include "tensor_external_data.hpp"
@@ -27,6 +42,103 @@ namespace ngraph
     {
         namespace detail
         {
+            std::shared_ptr<MappedMemory> MappedMemory::map(const std::string& path)
+            {
+                static std::mutex mappings_mutex;
+                static std::map<std::string, std::weak_ptr<MappedMemory>> mappings;
+
+                std::lock_guard<std::mutex> lock(mappings_mutex);
+                // Entries of unmapped files are dropped, so the cache does not grow with every
+                // model ever read. Files which cannot be mapped are never added.
+                for (auto it = mappings.begin(); it != mappings.end();)
+                {
+                    it = it->second.expired() ? mappings.erase(it) : std::next(it);
+                }
+                auto cached = mappings.find(path);
+                if (cached != mappings.end())
+                {
+                    if (auto memory = cached->second.lock())
+                    {
+                        return memory;
+                    }
+                }
+
+                std::shared_ptr<MappedMemory> memory{new MappedMemory()};
+#ifndef _WIN32
+                int fd = open(path.c_str(), O_RDONLY);
+                if (fd == -1)
+                {
+                    return nullptr;
+                }
+                struct stat sb = {};
+                if (fstat(fd, &sb) == -1 || sb.st_size <= 0)
+                {
+                    close(fd);
+                    return nullptr;
+                }
+                // Private mapping: pages are shared with the page cache until written to
+                void* addr = mmap(nullptr,
+                                  static_cast<size_t>(sb.st_size),
+                                  PROT_READ | PROT_WRITE,
+                                  MAP_PRIVATE,
+                                  fd,
+                                  0);
+                close(fd);
+                if (addr == MAP_FAILED)
+                {
+                    return nullptr;
+                }
+                memory->m_size = static_cast<size_t>(sb.st_size);
+#else
+                HANDLE file = CreateFileA(path.c_str(),
+                                          GENERIC_READ,
+                                          FILE_SHARE_READ,
+                                          nullptr,
+                                          OPEN_EXISTING,
+                                          FILE_ATTRIBUTE_NORMAL,
+                                          nullptr);
+                if (file == INVALID_HANDLE_VALUE)
+                {
+                    return nullptr;
+                }
+                LARGE_INTEGER file_size = {};
+                if (!GetFileSizeEx(file, &file_size) || file_size.QuadPart <= 0)
+                {
+                    CloseHandle(file);
+                    return nullptr;
+                }
+                HANDLE mapping = CreateFileMapping(file, nullptr, PAGE_WRITECOPY, 0, 0, nullptr);
+                CloseHandle(file);
+                if (mapping == nullptr)
+                {
+                    return nullptr;
+                }
+                void* addr = MapViewOfFile(mapping, FILE_MAP_COPY, 0, 0, 0);
+                CloseHandle(mapping);
+                if (addr == nullptr)
+                {
+                    return nullptr;
+                }
+                memory->m_size = static_cast<size_t>(file_size.QuadPart);
+#endif
+                memory->m_data = static_cast<char*>(addr);
+                mappings[path] = memory;
+                return memory;
+            }
+
+            MappedMemory::~MappedMemory()
+            {
+                if (m_data == nullptr)
+                {
+                    return;
+                }
+#ifndef _WIN32
+                munmap(m_data, m_size);
+#else
+                UnmapViewOfFile(m_data);
+#endif
+            }
+
             TensorExternalData::TensorExternalData(const ONNX_NAMESPACE::TensorProto& tensor)
             {
                 for (const auto& entry : tensor.external_data())
@@ -34,9 +146,9 @@ namespace ngraph
                     if (entry.key() == "location")
                         m_data_location = entry.value();
                     if (entry.key() == "offset")
-                        m_offset = std::stoi(entry.value());
+                        m_offset = std::stoull(entry.value());
                     if (entry.key() == "length")
-                        m_data_lenght = std::stoi(entry.value());
+                        m_data_lenght = std::stoull(entry.value());
                     if (entry.key() == "checksum")
                         m_sha1_digest = std::stoi(entry.value());
                 }
@@ -55,13 +167,6 @@ namespace ngraph
                 else
                     read_data_lenght = m_data_lenght;
 
-                const auto page_size = 4096;
-                if (m_offset != 0 && m_offset % page_size != 0)
-                {
-                    NGRAPH_WARN << "offset should be multiples 4096 (page size) to enable mmap "
-                                   "support, current value is "
-                                << m_offset;
-                }
                 // default value of m_offset is 0
                 external_data_stream.seekg(m_offset, std::ios::beg);
 
@@ -78,6 +183,28 @@ namespace ngraph
                 return read_data;
             }
 
+            std::shared_ptr<MappedBuffer> TensorExternalData::map_external_data() const
+            {
+                auto memory = MappedMemory::map(m_data_location);
+                if (!memory)
+                {
+                    return nullptr;
+                }
+                if (m_offset > memory->size() || m_data_lenght > memory->size() - m_offset)
+                {
+                    throw error::invalid_external_data{*this};
+                }
+                if (m_sha1_digest != 0)
+                {
+                    NGRAPH_WARN << "SHA1 checksum is not supported";
+                }
+
+                // read the rest of the file if length is not specified
+                const size_t length =
+                    m_data_lenght == 0 ? memory->size() - m_offset : m_data_lenght;
+                return std::make_shared<MappedBuffer>(memory->data() + m_offset, length, memory);
+            }
+
             std::string TensorExternalData::to_string() const
             {
                 std::stringstream s;
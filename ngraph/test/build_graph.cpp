@@ -203,3 +203,80 @@ TEST(build_graph, default_output_checks)
         FAIL() << "nullptr initialization of Output failed";
     }
 }
+
+TEST(build_graph, topological_sort_cached)
+{
+    auto arg0 = make_shared<op::Parameter>(element::f32, Shape{7});
+    auto arg1 = make_shared<op::Parameter>(element::f32, Shape{7});
+    auto add = make_shared<op::v1::Add>(arg0, arg1);
+    auto relu = make_shared<op::Relu>(add);
+    auto f = make_shared<Function>(relu, ParameterVector{arg0, arg1});
+
+    size_t sorts = 0;
+    f->set_topological_sort([&sorts](const std::vector<std::shared_ptr<Node>>& root_nodes) {
+        sorts++;
+        return topological_sort(root_nodes);
+    });
+
+    auto order = f->get_ordered_ops();
+    auto position = [&order](const std::shared_ptr<Node>& node) {
+        return std::find(order.begin(), order.end(), node) - order.begin();
+    };
+    EXPECT_EQ(order.size(), 5);
+    EXPECT_EQ(sorts, 1);
+
+    // unchanged graph is not sorted again
+    EXPECT_EQ(f->get_ordered_ops(), order);
+    f->validate_nodes_and_infer_types();
+    EXPECT_EQ(sorts, 1);
+
+    // node replacement invalidates the order
+    auto abs = make_shared<op::Abs>(add);
+    replace_node(relu, abs);
+    order = f->get_ordered_ops();
+    EXPECT_EQ(sorts, 2);
+    EXPECT_EQ(order.size(), 5);
+    EXPECT_EQ(std::count(order.begin(), order.end(), relu), 0);
+    EXPECT_LT(position(add), position(abs));
+
+    // as well as rewiring of an input
+    auto neg = make_shared<op::Negative>(arg1);
+    add->input(1).replace_source_output(neg);
+    order = f->get_ordered_ops();
+    EXPECT_EQ(sorts, 3);
+    EXPECT_EQ(order.size(), 6);
+    EXPECT_LT(position(neg), position(add));
+
+    // and a new control dependency
+    auto cdep = make_shared<op::Abs>(arg0);
+    abs->add_control_dependency(cdep);
+    order = f->get_ordered_ops();
+    EXPECT_EQ(sorts, 4);
+    EXPECT_EQ(order.size(), 7);
+    EXPECT_LT(position(cdep), position(abs));
+
+    f->get_ordered_ops();
+    EXPECT_EQ(sorts, 4);
+}
+
+TEST(build_graph, topological_sort_cached_shared_nodes)
+{
+    auto arg = make_shared<op::Parameter>(element::f32, Shape{7});
+    auto relu = make_shared<op::Relu>(arg);
+    auto abs = make_shared<op::Abs>(relu);
+    auto f0 = make_shared<Function>(abs, ParameterVector{arg});
+    auto f1 = make_shared<Function>(relu, ParameterVector{arg});
+    EXPECT_EQ(f0->get_ordered_ops().size(), 4);
+    EXPECT_EQ(f1->get_ordered_ops().size(), 3);
+
+    // the shared node invalidates both functions
+    auto neg = make_shared<op::Negative>(arg);
+    relu->input(0).replace_source_output(neg);
+    EXPECT_EQ(f0->get_ordered_ops().size(), 5);
+    EXPECT_EQ(f1->get_ordered_ops().size(), 4);
+
+    // nodes outlive the functions they belonged to
+    f1.reset();
+    relu->input(0).replace_source_output(arg);
+    EXPECT_EQ(f0->get_ordered_ops().size(), 4);
+}
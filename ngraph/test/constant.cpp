@@ -1389,3 +1389,23 @@ TEST(constant, bad_get_data_ptr)
         EXPECT_HAS_SUBSTRING(error.what(), std::string("get_data_ptr"));
     }
 }
+
+TEST(constant, shared_buffer)
+{
+    auto owner = make_shared<vector<float>>(vector<float>{1.0f, 2.0f, 3.0f, 4.0f});
+    auto buffer = make_shared<runtime::SharedBuffer<shared_ptr<vector<float>>>>(
+        reinterpret_cast<char*>(owner->data()), owner->size() * sizeof(float), owner);
+    auto c = make_shared<op::Constant>(element::f32, Shape{2, 2}, buffer);
+    weak_ptr<vector<float>> weak_owner = owner;
+    auto data = owner->data();
+    owner.reset();
+
+    // the constant refers to the original memory and keeps its owner alive
+    EXPECT_FALSE(weak_owner.expired());
+    EXPECT_EQ(c->get_data_ptr(), data);
+    EXPECT_EQ(c->get_vector<float>(), (vector<float>{1.0f, 2.0f, 3.0f, 4.0f}));
+
+    c.reset();
+    buffer.reset();
+    EXPECT_TRUE(weak_owner.expired());
+}
@@ -17,6 +17,7 @@
 #include "gtest/gtest.h"
 
 #include "ngraph/ngraph.hpp"
+#include "ngraph/parallel.hpp"
 #include "ngraph/pass/constant_folding.hpp"
 #include "ngraph/pass/manager.hpp"
 #include "util/all_close_f.hpp"
@@ -3264,3 +3265,124 @@ TEST(constant_folding, disable_constant_folding)
     ASSERT_EQ(count_ops_of_type<op::v1::Reshape>(f), 1);
     ASSERT_EQ(count_ops_of_type<op::Constant>(f), 1);
 }
+
+namespace
+{
+    // Runs a test body with the given number of threads for the parallel algorithms
+    class ParallelThreads
+    {
+    public:
+        explicit ParallelThreads(size_t threads) { set_parallel_threads(threads); }
+        ~ParallelThreads() { set_parallel_threads(0); }
+    };
+}
+
+TEST(constant_folding, parallel_independent_subgraphs)
+{
+    ParallelThreads threads(4);
+
+    // Dequantization of several weights, every subgraph folds independently of the others
+    const size_t subgraphs = 6;
+    const Shape shape{64, 1024};
+    NodeVector results;
+    vector<vector<float>> expected(subgraphs);
+    for (size_t i = 0; i < subgraphs; ++i)
+    {
+        vector<uint8_t> weights(shape_size(shape));
+        vector<float> zero_points(shape[0]);
+        vector<float> scales(shape[0]);
+        for (size_t j = 0; j < weights.size(); ++j)
+        {
+            weights[j] = static_cast<uint8_t>((i * 31 + j * 7) % 256);
+        }
+        for (size_t j = 0; j < shape[0]; ++j)
+        {
+            zero_points[j] = static_cast<float>((i + j) % 16);
+            scales[j] = 0.5f / (i + j + 1);
+        }
+        for (size_t j = 0; j < weights.size(); ++j)
+        {
+            size_t row = j / shape[1];
+            expected[i].push_back((weights[j] - zero_points[row]) * scales[row]);
+        }
+
+        auto convert = make_shared<op::Convert>(
+            op::Constant::create(element::u8, shape, weights), element::f32);
+        auto subtract = make_shared<op::v1::Subtract>(
+            convert, op::Constant::create(element::f32, Shape{shape[0], 1}, zero_points));
+        auto multiply = make_shared<op::v1::Multiply>(
+            subtract, op::Constant::create(element::f32, Shape{shape[0], 1}, scales));
+        results.push_back(multiply);
+    }
+    auto f = make_shared<Function>(results, ParameterVector{});
+
+    pass::Manager pass_manager;
+    auto constant_folding = pass_manager.register_pass<pass::ConstantFolding>();
+    // Fold at most two subgraphs at once
+    constant_folding->set_memory_budget(2 * shape_size(shape) * (1 + 2 * sizeof(float)));
+    pass_manager.run_passes(f);
+
+    EXPECT_EQ(count_ops_of_type<op::Convert>(f), 0);
+    EXPECT_EQ(count_ops_of_type<op::v1::Subtract>(f), 0);
+    EXPECT_EQ(count_ops_of_type<op::v1::Multiply>(f), 0);
+    for (size_t i = 0; i < subgraphs; ++i)
+    {
+        auto values_out = get_result_constant<float>(f, i);
+        EXPECT_TRUE(test::all_close_f(expected[i], values_out, MIN_FLOAT_TOLERANCE_BITS));
+    }
+}
+
+TEST(constant_folding, parallel_reductions)
+{
+    ParallelThreads threads(4);
+
+    const Shape shape{64, 40, 64};
+    vector<float> values(shape_size(shape));
+    for (size_t i = 0; i < values.size(); ++i)
+    {
+        values[i] = 1.0f + static_cast<float>((i * 13) % 101) / 1000.0f;
+    }
+    auto value = [&](size_t i, size_t j, size_t k) {
+        return values[(i * shape[1] + j) * shape[2] + k];
+    };
+
+    vector<float> expected_sum(shape[1], 0.0f);
+    vector<float> expected_max(shape[0] * shape[2], 0.0f);
+    vector<float> expected_mean(shape[0] * shape[1], 0.0f);
+    vector<float> expected_prod(shape[0] * shape[2], 1.0f);
+    for (size_t i = 0; i < shape[0]; ++i)
+    {
+        for (size_t j = 0; j < shape[1]; ++j)
+        {
+            for (size_t k = 0; k < shape[2]; ++k)
+            {
+                expected_sum[j] += value(i, j, k);
+                auto& max = expected_max[i * shape[2] + k];
+                max = std::max(max, value(i, j, k));
+                expected_mean[i * shape[1] + j] += value(i, j, k) / shape[2];
+                expected_prod[i * shape[2] + k] *= value(i, j, k);
+            }
+        }
+    }
+
+    auto constant = op::Constant::create(element::f32, shape, values);
+    auto axes = [](const vector<int64_t>& axes) {
+        return op::Constant::create(element::i64, Shape{axes.size()}, axes);
+    };
+    auto sum = make_shared<op::v1::ReduceSum>(constant, axes({0, 2}));
+    auto max = make_shared<op::v1::ReduceMax>(constant, axes({1}));
+    auto mean = make_shared<op::v1::ReduceMean>(constant, axes({2}), true);
+    auto prod = make_shared<op::v1::ReduceProd>(constant, axes({1}));
+    auto f = make_shared<Function>(NodeVector{sum, max, mean, prod}, ParameterVector{});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::ConstantFolding>();
+    pass_manager.run_passes(f);
+
+    ASSERT_EQ(count_ops_of_type<op::Constant>(f), 4);
+    EXPECT_EQ(f->get_output_shape(2), (Shape{64, 40, 1}));
+    EXPECT_TRUE(test::all_close_f(expected_sum, get_result_constant<float>(f, 0), 20));
+    EXPECT_EQ(expected_max, get_result_constant<float>(f, 1));
+    EXPECT_TRUE(test::all_close_f(expected_mean, get_result_constant<float>(f, 2), 20));
+    EXPECT_TRUE(test::all_close_f(expected_prod, get_result_constant<float>(f, 3), 20));
+}
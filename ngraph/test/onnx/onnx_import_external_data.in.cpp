@@ -14,11 +14,15 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <sstream>
+
 #include "gtest/gtest.h"
 #include "ngraph/file_util.hpp"
 #include "ngraph/type/element_type.hpp"
 #include "onnx_import/default_opset.hpp"
+#include "onnx_import/exceptions.hpp"
 #include "onnx_import/onnx.hpp"
+#include "onnx_import/utils/tensor_external_data.hpp"
 #include "util/engine/test_engines.hpp"
 #include "util/test_case.hpp"
 #include "util/test_control.hpp"
@@ -33,6 +37,31 @@ static std::string s_manifest = "${MANIFEST}";
 
 using TestEngine = test::ENGINE_CLASS_NAME(${BACKEND_NAME});
 
+namespace
+{
+    std::shared_ptr<op::Constant> get_initializer(const std::shared_ptr<Function>& function,
+                                                  const std::string& name)
+    {
+        for (const auto& node : function->get_ops())
+        {
+            auto constant = as_type_ptr<op::Constant>(node);
+            if (constant && constant->get_friendly_name() == name)
+            {
+                return constant;
+            }
+        }
+        return nullptr;
+    }
+
+    std::string external_data_path(const std::string& model, const std::string& data)
+    {
+        // the importer resolves the locations relative to the model directory
+        return file_util::path_join(
+            file_util::get_directory(file_util::path_join(SERIALIZED_ZOO, model)),
+            "../../files/onnx/external_data/" + data);
+    }
+}
+
 NGRAPH_TEST(${BACKEND_NAME}, onnx_external_data)
 {
     const auto function = onnx_import::import_onnx_model(
@@ -119,3 +148,96 @@ NGRAPH_TEST(${BACKEND_NAME}, onnx_external_invalid_external_data_exception)
         FAIL() << "Importing onnx model failed for unexpected reason";
     }
 }
+
+NGRAPH_TEST(${BACKEND_NAME}, onnx_external_data_mapped)
+{
+    const auto function = onnx_import::import_onnx_model(
+        file_util::path_join(SERIALIZED_ZOO, "onnx/external_data.prototxt"));
+
+    // the Constant refers to the mapping of the external file, which is kept alive by it
+    const auto constant = get_initializer(function, "A");
+    ASSERT_TRUE(constant);
+    const auto memory = onnx_import::detail::MappedMemory::map(
+        external_data_path("onnx/external_data.prototxt", "tensor.data"));
+    ASSERT_TRUE(memory);
+    EXPECT_EQ(memory->data(), constant->get_data_ptr<char>());
+
+    auto test_case = test::TestCase<TestEngine>(function);
+    test_case.add_input<float>({1.f, 2.f, 3.f, 4.f});
+    test_case.add_expected_output<float>(Shape{2, 2}, {3.f, 6.f, 9.f, 12.f});
+
+    test_case.run();
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, onnx_external_data_misaligned)
+{
+    const auto function = onnx_import::import_onnx_model(
+        file_util::path_join(SERIALIZED_ZOO, "onnx/external_data_misaligned.prototxt"));
+
+    // the floats start at offset 2 of the file, so they are copied
+    const auto constant = get_initializer(function, "A");
+    ASSERT_TRUE(constant);
+    const auto memory = onnx_import::detail::MappedMemory::map(
+        external_data_path("onnx/external_data_misaligned.prototxt", "tensor_misaligned.data"));
+    ASSERT_TRUE(memory);
+    EXPECT_NE(memory->data() + 2, constant->get_data_ptr<char>());
+
+    auto test_case = test::TestCase<TestEngine>(function);
+    test_case.add_input<float>({1.f, 2.f, 3.f, 4.f});
+    test_case.add_expected_output<float>(Shape{2, 2}, {3.f, 6.f, 9.f, 12.f});
+
+    test_case.run();
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, onnx_external_data_wrong_size)
+{
+    // a single float {2.f} read from the external file is broadcast to the initializer shape
+    const auto function = onnx_import::import_onnx_model(
+        file_util::path_join(SERIALIZED_ZOO, "onnx/external_data_wrong_size.prototxt"));
+
+    auto test_case = test::TestCase<TestEngine>(function);
+    test_case.add_input<float>({1.f, 2.f, 3.f, 4.f});
+    test_case.add_expected_output<float>(Shape{2, 2}, {4.f, 6.f, 8.f, 10.f});
+
+    test_case.run();
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, onnx_external_data_out_of_bounds_exception)
+{
+    try
+    {
+        auto function = onnx_import::import_onnx_model(
+            file_util::path_join(SERIALIZED_ZOO, "onnx/external_data_out_of_bounds.prototxt"));
+        FAIL() << "External data out of the file bounds not detected";
+    }
+    catch (const onnx_import::error::invalid_external_data& error)
+    {
+        EXPECT_PRED_FORMAT2(testing::IsSubstring,
+                            std::string("tensor.data, offset: 8, data_lenght: 16, sha1_digest: 0)"),
+                            error.what());
+    }
+    catch (...)
+    {
+        FAIL() << "Importing onnx model failed for unexpected reason";
+    }
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, onnx_raw_data_outlives_stream)
+{
+    std::shared_ptr<Function> function;
+    {
+        std::ifstream file{
+            file_util::path_join(SERIALIZED_ZOO, "onnx/add_abc_initializers.prototxt")};
+        ASSERT_TRUE(file.is_open());
+        std::stringstream stream;
+        stream << file.rdbuf();
+        // the parsed model proto is released by the importer unless Constants refer to it
+        function = onnx_import::import_onnx_model(stream);
+    }
+
+    auto test_case = test::TestCase<TestEngine>(function);
+    test_case.add_input<float>({1.f, 2.f, 3.f, 4.f});
+    test_case.add_expected_output<float>(Shape{2, 2}, {3.f, 6.f, 9.f, 12.f});
+
+    test_case.run();
+}
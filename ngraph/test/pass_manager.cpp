@@ -23,7 +23,10 @@
 
 #include "ngraph/graph_util.hpp"
 #include "ngraph/ngraph.hpp"
+#include "ngraph/opsets/opset3.hpp"
+#include "ngraph/pass/graph_rewrite.hpp"
 #include "ngraph/pass/manager.hpp"
+#include "ngraph/pattern/op/wrap_type.hpp"
 #include "util/test_tools.hpp"
 
 using namespace ngraph;
@@ -53,4 +56,144 @@ namespace
         }
         bool run_on_function(std::shared_ptr<ngraph::Function> /* f */) override { return false; }
     };
+
+    // Removes Relu operations
+    class RemoveRelu : public pass::MatcherPass
+    {
+    public:
+        RemoveRelu()
+        {
+            auto relu = pattern::wrap_type<opset3::Relu>();
+            matcher_pass_callback callback = [](pattern::Matcher& m) {
+                auto root = m.get_match_root();
+                return replace_output_update_name(root->output(0), root->input_value(0));
+            };
+            register_matcher(make_shared<pattern::Matcher>(relu, "RemoveRelu"), callback);
+        }
+    };
+
+    // Runs RemoveRelu in a nested pass::Manager
+    class NestedRemoveRelu : public pass::FunctionPass
+    {
+    public:
+        bool run_on_function(std::shared_ptr<ngraph::Function> f) override
+        {
+            pass::Manager manager;
+            manager.set_per_pass_validation(false);
+            manager.register_pass<RemoveRelu>();
+            manager.run_passes(f);
+            return true;
+        }
+    };
+
+    class ThrowingPass : public pass::FunctionPass
+    {
+    public:
+        bool run_on_function(std::shared_ptr<ngraph::Function> /* f */) override
+        {
+            throw ngraph_error("ThrowingPass failed");
+        }
+    };
+}
+
+TEST(pass_manager, profiler)
+{
+    auto a = make_shared<opset3::Parameter>(element::f32, Shape{2});
+    auto b = make_shared<opset3::Relu>(a);
+    auto c = make_shared<opset3::Abs>(b);
+    auto d = make_shared<opset3::Relu>(c);
+    auto f = make_shared<Function>(NodeVector{d}, ParameterVector{a});
+
+    auto profiler = make_shared<pass::Profiler>();
+    pass::Manager pass_manager;
+    pass_manager.set_per_pass_validation(false);
+    pass_manager.set_profiler(profiler);
+    pass_manager.register_pass<DummyPass>();
+    pass_manager.register_pass<NestedRemoveRelu>();
+    pass_manager.run_passes(f);
+
+    EXPECT_EQ(pass::Profiler::get_current(), nullptr);
+
+    const auto& records = profiler->get_records();
+    ASSERT_EQ(records.size(), 3);
+
+    EXPECT_EQ(records[0].depth, 0);
+    EXPECT_EQ(records[0].nodes_before, 5);
+    EXPECT_EQ(records[0].nodes_after, 5);
+    EXPECT_TRUE(records[0].matchers.empty());
+
+    EXPECT_EQ(records[1].depth, 0);
+    EXPECT_EQ(records[1].nodes_before, 5);
+    EXPECT_EQ(records[1].nodes_after, 3);
+    EXPECT_TRUE(records[1].matchers.empty());
+
+    // RemoveRelu ran by the nested manager
+    EXPECT_EQ(records[2].depth, 1);
+    EXPECT_EQ(records[2].nodes_before, 5);
+    EXPECT_EQ(records[2].nodes_after, 3);
+    EXPECT_GE(records[2].start_us, records[1].start_us);
+    EXPECT_LE(records[2].time_us, records[1].time_us);
+    ASSERT_EQ(records[2].matchers.size(), 1);
+    EXPECT_EQ(records[2].matchers[0].attempts, 2);
+    EXPECT_EQ(records[2].matchers[0].matches, 2);
+
+    stringstream json;
+    profiler->write_json(json);
+    EXPECT_NE(json.str().find(R"("nodes_after":3,"matchers":[{"name":)"), string::npos);
+    EXPECT_NE(json.str().find(R"("attempts":2,"matches":2)"), string::npos);
+}
+
+TEST(pass_manager, profiler_throwing_pass)
+{
+    auto a = make_shared<opset3::Parameter>(element::f32, Shape{2});
+    auto b = make_shared<opset3::Relu>(a);
+    auto f = make_shared<Function>(NodeVector{b}, ParameterVector{a});
+
+    auto profiler = make_shared<pass::Profiler>();
+    {
+        pass::Manager pass_manager;
+        pass_manager.set_per_pass_validation(false);
+        pass_manager.set_profiler(profiler);
+        pass_manager.register_pass<ThrowingPass>();
+        EXPECT_THROW(pass_manager.run_passes(f), ngraph_error);
+    }
+    EXPECT_EQ(pass::Profiler::get_current(), nullptr);
+
+    // the failed pass is closed without counting nodes, so the next pass is not nested into it
+    pass::Manager pass_manager;
+    pass_manager.set_per_pass_validation(false);
+    pass_manager.set_profiler(profiler);
+    pass_manager.register_pass<DummyPass>();
+    pass_manager.run_passes(f);
+
+    const auto& records = profiler->get_records();
+    ASSERT_EQ(records.size(), 2);
+    EXPECT_EQ(records[0].depth, 0);
+    EXPECT_EQ(records[0].nodes_before, 3);
+    EXPECT_EQ(records[0].nodes_after, 0);
+    EXPECT_EQ(records[1].depth, 0);
+    EXPECT_EQ(records[1].nodes_after, 3);
+}
+
+TEST(pass_manager, profiler_disabled)
+{
+    auto a = make_shared<opset3::Parameter>(element::f32, Shape{2});
+    auto b = make_shared<opset3::Abs>(a);
+    auto c = make_shared<opset3::Relu>(b);
+    auto f = make_shared<Function>(NodeVector{c}, ParameterVector{a});
+
+    auto profiler = make_shared<pass::Profiler>();
+    {
+        pass::Manager pass_manager;
+        pass_manager.set_profiler(profiler);
+        pass_manager.register_pass<DummyPass>();
+        pass_manager.run_passes(f);
+    }
+    profiler->clear();
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<NestedRemoveRelu>();
+    pass_manager.run_passes(f);
+    EXPECT_TRUE(profiler->get_records().empty());
+    EXPECT_EQ(f->get_ordered_ops().size(), 3);
 }
@@ -0,0 +1,320 @@
+//*****************************************************************************
+// Copyright 2017-2020 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <cstdint>
+#include <functional>
+#include <numeric>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "ngraph/parallel.hpp"
+#include "ngraph/runtime/opt_kernel/reshape.hpp"
+#include "ngraph/runtime/reference/add.hpp"
+#include "ngraph/runtime/reference/dot.hpp"
+#include "ngraph/runtime/reference/gather.hpp"
+#include "ngraph/runtime/reference/matmul.hpp"
+#include "ngraph/runtime/reference/max.hpp"
+#include "ngraph/runtime/reference/select.hpp"
+#include "ngraph/runtime/reference/slice.hpp"
+#include "ngraph/runtime/reference/sum.hpp"
+#include "ngraph/runtime/reference_fast_paths.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+namespace
+{
+    // Runs the kernel with fast paths enabled and disabled and returns both outputs
+    template <typename T>
+    pair<vector<T>, vector<T>> run_both(size_t out_size, const function<void(T*)>& kernel)
+    {
+        pair<vector<T>, vector<T>> results{vector<T>(out_size), vector<T>(out_size)};
+        runtime::set_reference_fast_paths(true);
+        kernel(results.first.data());
+        runtime::set_reference_fast_paths(false);
+        kernel(results.second.data());
+        runtime::set_reference_fast_paths(true);
+        return results;
+    }
+
+    // Integer valued data keeps floating point results exact in any summation order
+    vector<float> iota_data(const Shape& shape, int modulo = 17)
+    {
+        vector<float> data(shape_size(shape));
+        for (size_t i = 0; i < data.size(); ++i)
+        {
+            data[i] = static_cast<float>(static_cast<int>(i % modulo) - modulo / 2);
+        }
+        return data;
+    }
+
+    class ParallelThreads
+    {
+    public:
+        ParallelThreads(size_t threads) { set_parallel_threads(threads); }
+        ~ParallelThreads() { set_parallel_threads(0); }
+
+    private:
+        ParallelScope m_parallel_scope;
+    };
+}
+
+TEST(reference_fast_paths, broadcast_binop)
+{
+    ParallelThreads threads(4);
+    const vector<pair<Shape, Shape>> numpy_shapes{{Shape{2, 3, 4}, Shape{2, 3, 4}},
+                                                  {Shape{3, 1}, Shape{1, 4}},
+                                                  {Shape{2, 3, 1}, Shape{4}},
+                                                  {Shape{5, 1, 6}, Shape{1, 7, 1}},
+                                                  {Shape{}, Shape{2, 3}},
+                                                  {Shape{2, 1, 3}, Shape{4, 1}},
+                                                  {Shape{300, 1, 1}, Shape{1, 300}}};
+    for (const auto& shapes : numpy_shapes)
+    {
+        const auto arg0 = iota_data(shapes.first);
+        const auto arg1 = iota_data(shapes.second, 13);
+        Shape out_shape = runtime::reference::internal::numpy_broadcast_shape(
+            {shapes.first, shapes.second});
+        auto results = run_both<float>(shape_size(out_shape), [&](float* out) {
+            runtime::reference::add(arg0.data(),
+                                    arg1.data(),
+                                    out,
+                                    shapes.first,
+                                    shapes.second,
+                                    op::AutoBroadcastSpec::NUMPY);
+        });
+        EXPECT_EQ(results.first, results.second) << shapes.first << " + " << shapes.second;
+    }
+
+    const Shape pdpd_shape0{2, 3, 4, 5};
+    const vector<pair<Shape, int64_t>> pdpd_shapes{
+        {Shape{3, 4}, 1}, {Shape{4, 5}, -1}, {Shape{2, 1}, 0}, {Shape{5}, 3}};
+    const auto pdpd_arg0 = iota_data(pdpd_shape0);
+    for (const auto& shape : pdpd_shapes)
+    {
+        const auto arg1 = iota_data(shape.first, 7);
+        const op::AutoBroadcastSpec spec(op::AutoBroadcastType::PDPD, shape.second);
+        auto results = run_both<float>(shape_size(pdpd_shape0), [&](float* out) {
+            runtime::reference::add(
+                pdpd_arg0.data(), arg1.data(), out, pdpd_shape0, shape.first, spec);
+        });
+        EXPECT_EQ(results.first, results.second) << shape.first << " axis " << shape.second;
+    }
+}
+
+TEST(reference_fast_paths, broadcast_select)
+{
+    const Shape cond_shape{3, 1};
+    const Shape then_shape{1, 4};
+    const Shape else_shape{2, 1, 1};
+    vector<char> cond{1, 0, 1};
+    const auto then_data = iota_data(then_shape);
+    const auto else_data = iota_data(else_shape, 5);
+    auto results = run_both<float>(24, [&](float* out) {
+        runtime::reference::select(cond.data(),
+                                   then_data.data(),
+                                   else_data.data(),
+                                   out,
+                                   cond_shape,
+                                   then_shape,
+                                   else_shape,
+                                   op::AutoBroadcastSpec::NUMPY);
+    });
+    EXPECT_EQ(results.first, results.second);
+
+    const Shape pdpd_then_shape{2, 3, 4};
+    const auto pdpd_then = iota_data(pdpd_then_shape);
+    const Shape pdpd_cond_shape{3};
+    vector<char> pdpd_cond(3);
+    for (size_t i = 0; i < pdpd_cond.size(); ++i)
+    {
+        pdpd_cond[i] = i % 2 == 0;
+    }
+    const Shape pdpd_else_shape{3};
+    const auto pdpd_else = iota_data(pdpd_else_shape, 5);
+    auto pdpd_results = run_both<float>(24, [&](float* out) {
+        runtime::reference::select(pdpd_cond.data(),
+                                   pdpd_then.data(),
+                                   pdpd_else.data(),
+                                   out,
+                                   pdpd_cond_shape,
+                                   pdpd_then_shape,
+                                   pdpd_else_shape,
+                                   op::AutoBroadcastSpec(op::AutoBroadcastType::PDPD, 1));
+    });
+    EXPECT_EQ(pdpd_results.first, pdpd_results.second);
+}
+
+TEST(reference_fast_paths, reductions)
+{
+    ParallelThreads threads(4);
+    const Shape shape{4, 5, 6, 7};
+    const auto arg = iota_data(shape);
+    const vector<AxisSet> axes_sets{
+        {3}, {2, 3}, {1, 2, 3}, {0, 1, 2, 3}, {0}, {1, 3}, {0, 2}, {}};
+    for (const auto& axes : axes_sets)
+    {
+        const size_t out_size = shape_size(reduce(shape, axes, false));
+        auto sums = run_both<float>(out_size, [&](float* out) {
+            runtime::reference::sum(arg.data(), out, shape, axes, false);
+        });
+        EXPECT_EQ(sums.first, sums.second) << axes;
+        auto maxima = run_both<float>(out_size, [&](float* out) {
+            runtime::reference::max(arg.data(), out, shape, axes, false);
+        });
+        EXPECT_EQ(maxima.first, maxima.second) << axes;
+    }
+}
+
+TEST(reference_fast_paths, reshape)
+{
+    ParallelThreads threads(4);
+    const vector<pair<Shape, AxisVector>> cases{{Shape{}, AxisVector{}},
+                                                {Shape{6}, AxisVector{0}},
+                                                {Shape{3, 4}, AxisVector{1, 0}},
+                                                {Shape{2, 3, 4}, AxisVector{0, 2, 1}},
+                                                {Shape{2, 1, 4, 3}, AxisVector{3, 0, 1, 2}},
+                                                {Shape{2, 3, 1, 4, 5}, AxisVector{0, 1, 2, 3, 4}},
+                                                {Shape{2, 2, 3, 1, 2, 3, 2},
+                                                 AxisVector{6, 5, 4, 3, 2, 1, 0}},
+                                                {Shape{256, 512}, AxisVector{1, 0}}};
+    for (const auto& reshape : cases)
+    {
+        const Shape& in_shape = reshape.first;
+        const AxisVector& order = reshape.second;
+        Shape out_shape(in_shape.size());
+        for (size_t i = 0; i < order.size(); ++i)
+        {
+            out_shape[i] = in_shape[order[i]];
+        }
+        const auto arg = iota_data(in_shape, 1031);
+        auto results = run_both<float>(shape_size(in_shape), [&](float* out) {
+            runtime::opt_kernel::reshape(reinterpret_cast<const char*>(arg.data()),
+                                         reinterpret_cast<char*>(out),
+                                         in_shape,
+                                         order,
+                                         out_shape,
+                                         sizeof(float));
+        });
+        EXPECT_EQ(results.first, results.second) << in_shape << " " << order;
+    }
+}
+
+TEST(reference_fast_paths, slice)
+{
+    const Shape shape{5, 6, 7};
+    vector<int16_t> arg(shape_size(shape));
+    iota(arg.begin(), arg.end(), 0);
+    struct SliceCase
+    {
+        Coordinate lower;
+        Coordinate upper;
+        Strides strides;
+    };
+    const vector<SliceCase> cases{{{0, 0, 0}, {5, 6, 7}, {1, 1, 1}},
+                                  {{1, 2, 3}, {4, 6, 7}, {1, 1, 1}},
+                                  {{0, 1, 0}, {5, 6, 7}, {2, 3, 2}},
+                                  {{4, 0, 6}, {5, 6, 7}, {1, 4, 1}},
+                                  {{2, 2, 2}, {2, 6, 7}, {1, 1, 1}}};
+    for (const auto& slice : cases)
+    {
+        Shape out_shape(shape.size());
+        for (size_t i = 0; i < shape.size(); ++i)
+        {
+            out_shape[i] = (slice.upper[i] - slice.lower[i] + slice.strides[i] - 1) /
+                           slice.strides[i];
+        }
+        auto results = run_both<int16_t>(shape_size(out_shape), [&](int16_t* out) {
+            runtime::reference::slice(reinterpret_cast<const char*>(arg.data()),
+                                      reinterpret_cast<char*>(out),
+                                      shape,
+                                      slice.lower,
+                                      slice.upper,
+                                      slice.strides,
+                                      out_shape,
+                                      sizeof(int16_t));
+        });
+        EXPECT_EQ(results.first, results.second) << slice.lower << " " << slice.strides;
+    }
+}
+
+TEST(reference_fast_paths, gather)
+{
+    const Shape params_shape{3, 4, 5};
+    const auto params = iota_data(params_shape, 61);
+    const vector<int64_t> indices{3, -1, 0, -4, 2, 2};
+    const Shape indices_shape{2, 3};
+    for (size_t axis = 0; axis < params_shape.size(); ++axis)
+    {
+        if (params_shape[axis] < 4)
+        {
+            continue;
+        }
+        Shape out_shape(params_shape.begin(), params_shape.begin() + axis);
+        out_shape.insert(out_shape.end(), indices_shape.begin(), indices_shape.end());
+        out_shape.insert(out_shape.end(), params_shape.begin() + axis + 1, params_shape.end());
+        auto results = run_both<float>(shape_size(out_shape), [&](float* out) {
+            runtime::reference::gather(
+                params.data(), indices.data(), out, params_shape, indices_shape, out_shape, axis);
+        });
+        EXPECT_EQ(results.first, results.second) << "axis " << axis;
+    }
+}
+
+TEST(reference_fast_paths, dot)
+{
+    ParallelThreads threads(4);
+    struct DotCase
+    {
+        Shape arg0;
+        Shape arg1;
+        size_t reduction_axes;
+    };
+    const vector<DotCase> cases{{{3, 4}, {4, 5}, 1},
+                                {{2, 3, 4}, {3, 4, 6}, 2},
+                                {{7}, {7}, 1},
+                                {{2, 3}, {}, 0},
+                                {{16, 300}, {300, 270}, 1}};
+    for (const auto& dot : cases)
+    {
+        Shape out_shape(dot.arg0.begin(), dot.arg0.end() - dot.reduction_axes);
+        out_shape.insert(out_shape.end(), dot.arg1.begin() + dot.reduction_axes, dot.arg1.end());
+        const auto arg0 = iota_data(dot.arg0, 7);
+        const auto arg1 = iota_data(dot.arg1, 5);
+        auto results = run_both<float>(shape_size(out_shape), [&](float* out) {
+            runtime::reference::dot(arg0.data(),
+                                    arg1.data(),
+                                    out,
+                                    dot.arg0,
+                                    dot.arg1,
+                                    out_shape,
+                                    dot.reduction_axes);
+        });
+        EXPECT_EQ(results.first, results.second) << dot.arg0 << " . " << dot.arg1;
+    }
+
+    const Shape arg0_shape{2, 3, 4};
+    const Shape arg1_shape{2, 5, 4};
+    const Shape out_shape{2, 3, 5};
+    const auto arg0 = iota_data(arg0_shape, 7);
+    const auto arg1 = iota_data(arg1_shape, 5);
+    auto results = run_both<float>(shape_size(out_shape), [&](float* out) {
+        runtime::reference::matmul(
+            arg0.data(), arg1.data(), out, arg0_shape, arg1_shape, out_shape, false, true);
+    });
+    EXPECT_EQ(results.first, results.second);
+}
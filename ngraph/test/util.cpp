@@ -14,9 +14,12 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <algorithm>
+#include <atomic>
 #include <fstream>
 #include <sstream>
 #include <string>
+#include <thread>
 #include <vector>
 
 #include "gtest/gtest.h"
@@ -26,6 +29,7 @@
 #include "ngraph/graph_util.hpp"
 #include "ngraph/ngraph.hpp"
 #include "ngraph/op/util/op_annotations.hpp"
+#include "ngraph/parallel.hpp"
 #include "ngraph/pass/manager.hpp"
 #include "ngraph/pass/visualize_tree.hpp"
 #include "util/all_close.hpp"
@@ -883,3 +887,131 @@ TEST(util_host_tensor_2_vector, ht_u64_2_vec_uint64)
     host_tensor_2_vector_test<decltype(input)::value_type, decltype(output)::value_type>(
         input, output, element::u64);
 }
+
+TEST(util, parallel_for)
+{
+    set_parallel_threads(4);
+    ParallelScope parallel_scope;
+
+    const size_t count = 4 * parallel_grain_size + 3;
+    vector<int> visits(count, 0);
+    parallel_for(count, [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i)
+        {
+            visits[i]++;
+        }
+        // nested calls run serially in the calling thread
+        parallel_for(count, [&](size_t nested_begin, size_t nested_end) {
+            EXPECT_EQ(nested_begin, 0);
+            EXPECT_EQ(nested_end, count);
+        });
+    });
+    EXPECT_EQ(count, std::count(visits.begin(), visits.end(), 1));
+
+    vector<int> items(100, 0);
+    parallel_for_each(items.size(), [&](size_t index) { items[index]++; });
+    EXPECT_EQ(items.size(), std::count(items.begin(), items.end(), 1));
+
+    EXPECT_THROW(parallel_for_each(items.size(),
+                                   [&](size_t index) {
+                                       if (index == 42)
+                                       {
+                                           throw ngraph_error("item failed");
+                                       }
+                                   }),
+                 ngraph_error);
+
+    // callers on different threads run their calls in the worker threads of their own scopes
+    vector<vector<int>> caller_items(3, vector<int>(count, 0));
+    vector<thread> callers;
+    for (auto& items_of_caller : caller_items)
+    {
+        callers.emplace_back([&items_of_caller]() {
+            ParallelScope caller_scope;
+            for (int call = 0; call < 10; ++call)
+            {
+                parallel_for(items_of_caller.size(), [&](size_t begin, size_t end) {
+                    for (size_t i = begin; i < end; ++i)
+                    {
+                        items_of_caller[i]++;
+                    }
+                });
+            }
+        });
+    }
+    for (auto& caller : callers)
+    {
+        caller.join();
+    }
+    for (const auto& items_of_caller : caller_items)
+    {
+        EXPECT_EQ(count, std::count(items_of_caller.begin(), items_of_caller.end(), 10));
+    }
+
+    set_parallel_threads(0);
+}
+
+namespace
+{
+    atomic<size_t> s_executor_calls{0};
+
+    void serial_executor(size_t workers, const function<void(size_t)>& body)
+    {
+        s_executor_calls++;
+        for (size_t worker = 0; worker < workers; ++worker)
+        {
+            body(worker);
+        }
+    }
+}
+
+TEST(util, parallel_for_with_executor)
+{
+    set_parallel_threads(4);
+    set_parallel_executor(serial_executor);
+    s_executor_calls = 0;
+    {
+        ParallelScope parallel_scope;
+
+        const auto caller_id = this_thread::get_id();
+        const size_t count = 4 * parallel_grain_size;
+        vector<int> visits(count, 0);
+        parallel_for(count, [&](size_t begin, size_t end) {
+            EXPECT_EQ(this_thread::get_id(), caller_id);
+            for (size_t i = begin; i < end; ++i)
+            {
+                visits[i]++;
+            }
+        });
+        EXPECT_EQ(count, std::count(visits.begin(), visits.end(), 1));
+
+        EXPECT_THROW(parallel_for_each(100,
+                                       [&](size_t index) {
+                                           if (index == 42)
+                                           {
+                                               throw ngraph_error("item failed");
+                                           }
+                                       }),
+                     ngraph_error);
+    }
+    EXPECT_EQ(s_executor_calls, 2);
+
+    set_parallel_executor(nullptr);
+    set_parallel_threads(0);
+}
+
+TEST(util, parallel_for_outside_of_scope)
+{
+    set_parallel_threads(4);
+
+    const auto caller_id = this_thread::get_id();
+    const size_t count = 4 * parallel_grain_size;
+    parallel_for(count, [&](size_t begin, size_t end) {
+        EXPECT_EQ(begin, 0);
+        EXPECT_EQ(end, count);
+        EXPECT_EQ(this_thread::get_id(), caller_id);
+    });
+    parallel_for_each(100, [&](size_t) { EXPECT_EQ(this_thread::get_id(), caller_id); });
+
+    set_parallel_threads(0);
+}
@@ -42,6 +42,13 @@ namespace openvino
          */
         typedef struct handle_ {} *handle_t;
 
+        /**
+         * @typedef counter_t
+         * @ingroup ie_dev_profiling
+         * @brief A named counter whose values are displayed on the timeline of a trace.
+         */
+        typedef struct counter_ {} *counter_t;
+
 /**
  * @cond
  */
@@ -52,6 +59,8 @@ namespace openvino
             void taskBegin(domain_t d, handle_t t);
             void taskEnd(domain_t d);
             void threadName(const char* name);
+            counter_t counter(char const* name, domain_t d);
+            void counterInc(counter_t c);
         }
 /**
  * @endcond
@@ -109,6 +118,31 @@ namespace openvino
             return h;
         }
 
+        /**
+         * @fn counter_t counter(char const *name)
+         * @ingroup ie_dev_profiling
+         * @brief Create a counter with a given name in a given domain.
+         * @details The counter is created as a singleton for every tag the template function is instantiated with.
+         * @param name [in] The counter name
+         */
+        template <typename Tag, domain_t(*domain)()>
+        counter_t counter(char const *name)
+        {
+            static auto c = internal::counter(name, domain());
+            return c;
+        }
+
+        /**
+         * @fn void counterInc(counter_t c)
+         * @ingroup ie_dev_profiling
+         * @brief Increment the counter value by one.
+         * @param c [in] The counter
+         */
+        inline void counterInc(counter_t c)
+        {
+            internal::counterInc(c);
+        }
+
         /**
          * @class ScopedTask
          * @ingroup ie_dev_profiling
@@ -188,5 +222,19 @@ inline openvino::itt::domain_t domainName() noexcept
 /**
  * @endcond
  */
+
+/**
+ * @def OV_ITT_COUNTER_INC(domain, counterName)
+ * @ingroup ie_dev_profiling
+ * @brief Increment a counter which is displayed in Intel VTune, e.g. to count events that are expected to be rare.
+ * @param domainName [in] Known at compile time name of module or library (the domain name).
+ * @param counterName [in] The counter name.
+ */
+#define OV_ITT_COUNTER_INC(domain, counterName)                                                     \
+        {                                                                                           \
+            struct Counter ## __LINE__ {};                                                          \
+            openvino::itt::counterInc(                                                              \
+                    openvino::itt::counter<Counter ## __LINE__, domain>(counterName));              \
+        }
     } // namespace itt
 } // namespace openvino
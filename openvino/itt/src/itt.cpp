@@ -66,6 +66,18 @@ namespace openvino
             {
                 __itt_thread_set_name(name);
             }
+
+            counter_t counter(char const* name, domain_t d)
+            {
+                auto domain = reinterpret_cast<__itt_domain*>(d);
+                return reinterpret_cast<counter_t>(
+                    __itt_counter_create(name, domain ? domain->nameA : nullptr));
+            }
+
+            void counterInc(counter_t c)
+            {
+                __itt_counter_inc(reinterpret_cast<__itt_counter>(c));
+            }
 #else
             domain_t domain(char const *) { return nullptr; }
 
@@ -76,6 +88,10 @@ namespace openvino
             void taskEnd(domain_t) { }
 
             void threadName(const char *) { }
+
+            counter_t counter(char const *, domain_t) { return nullptr; }
+
+            void counterInc(counter_t) { }
 #endif
         }
     }